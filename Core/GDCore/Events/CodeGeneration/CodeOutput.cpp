@@ -0,0 +1,61 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/CodeOutput.h"
+
+#include <cstring>
+
+namespace gd {
+
+const std::size_t CodeOutput::minimumChunkSize = 1024;
+
+CodeOutput& CodeOutput::operator+=(const gd::String& code) {
+  pendingCode += code;
+  codeSize += code.size();
+  return *this;
+}
+
+CodeOutput& CodeOutput::operator+=(gd::String&& code) {
+  if (code.size() < minimumChunkSize) return *this += code;
+
+  FlushPendingCode();
+  codeSize += code.size();
+  chunks.push_back(std::make_shared<const gd::String>(std::move(code)));
+  return *this;
+}
+
+CodeOutput& CodeOutput::operator+=(const char* code) {
+  std::size_t length = std::strlen(code);
+  pendingCode.Raw().append(code, length);
+  codeSize += length;
+  return *this;
+}
+
+CodeOutput& CodeOutput::operator+=(const CodeOutput& code) {
+  if (&code == this) return *this += CodeOutput(code);
+
+  FlushPendingCode();
+  chunks.insert(chunks.end(), code.chunks.begin(), code.chunks.end());
+  pendingCode = code.pendingCode;
+  codeSize += code.codeSize;
+  return *this;
+}
+
+gd::String CodeOutput::ToString() const {
+  gd::String output;
+  output.reserve(codeSize);
+  for (const auto& chunk : chunks) output += *chunk;
+  output += pendingCode;
+  return output;
+}
+
+void CodeOutput::FlushPendingCode() {
+  if (pendingCode.empty()) return;
+
+  chunks.push_back(std::make_shared<const gd::String>(std::move(pendingCode)));
+  pendingCode = gd::String();
+}
+
+}  // namespace gd
@@ -0,0 +1,83 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An append-only buffer of generated code.
+ *
+ * Code is stored as a list of chunks that are only concatenated once, when the
+ * whole code is needed (see ToString). Large strings given as rvalues are moved
+ * into their own chunk, and the chunks of another CodeOutput are shared instead
+ * of being copied: appending a large piece of code to a CodeOutput does not
+ * copy it, contrary to concatenating gd::String.
+ *
+ * \ingroup CodeGeneration
+ */
+class GD_CORE_API CodeOutput {
+ public:
+  CodeOutput() : codeSize(0){};
+  virtual ~CodeOutput(){};
+
+  /**
+   * \brief Append a copy of the code.
+   */
+  CodeOutput& operator+=(const gd::String& code);
+
+  /**
+   * \brief Append the code, moving it into its own chunk if it's large enough.
+   */
+  CodeOutput& operator+=(gd::String&& code);
+
+  /**
+   * \brief Append a copy of the code.
+   */
+  CodeOutput& operator+=(const char* code);
+
+  /**
+   * \brief Append the code of another output, sharing its chunks.
+   */
+  CodeOutput& operator+=(const CodeOutput& code);
+
+  /**
+   * \brief Return the size of the code, in bytes.
+   */
+  std::size_t size() const { return codeSize; }
+
+  /**
+   * \brief Return true if there is no code.
+   */
+  bool empty() const { return codeSize == 0; }
+
+  /**
+   * \brief Return the whole code in a single string.
+   */
+  gd::String ToString() const;
+
+ private:
+  /**
+   * \brief Move the pending code into a chunk, so that chunks can be added
+   * after it.
+   */
+  void FlushPendingCode();
+
+  std::vector<std::shared_ptr<const gd::String>>
+      chunks;               ///< The code, not modified anymore once added.
+  gd::String pendingCode;   ///< The code appended after the chunks.
+  std::size_t codeSize;     ///< The size of the whole code, in bytes.
+
+  static const std::size_t minimumChunkSize;  ///< The minimum size of a moved
+                                              ///< string to be kept in its own
+                                              ///< chunk.
+};
+
+}  // namespace gd
@@ -20,24 +20,13 @@ void EventsCodeGenerationContext::InheritsFrom(
   parent = &parent_;
 
   // Objects lists declared by parent became "already declared" in the child
-  // context.
-  alreadyDeclaredObjectsLists = parent_.alreadyDeclaredObjectsLists;
-  std::copy(parent_.objectsListsToBeDeclared.begin(),
-            parent_.objectsListsToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
-  std::copy(parent_.objectsListsOrEmptyToBeDeclared.begin(),
-            parent_.objectsListsOrEmptyToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
-  std::copy(parent_.emptyObjectsListsToBeDeclared.begin(),
-            parent_.emptyObjectsListsToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
+  // context. The scope of the parent is shared rather than copied.
+  parentScope = parent_.GetScope();
+  depthOfLastUse.clear();
+  scope.reset();
 
   nearestAsyncParent = parent_.IsAsyncCallback() ? &parent_ : parent_.nearestAsyncParent;
   asyncDepth = parent_.asyncDepth;
-  depthOfLastUse = parent_.depthOfLastUse;
   customConditionDepth = parent_.customConditionDepth;
   contextDepth = parent_.GetContextDepth() + 1;
   if (parent_.maxDepthLevel) {
@@ -60,6 +49,25 @@ void EventsCodeGenerationContext::Reuse(
     contextDepth = parent_.GetContextDepth();  // Keep same context depth
 }
 
+const std::shared_ptr<const EventsCodeGenerationContext::Scope>&
+EventsCodeGenerationContext::GetScope() {
+  if (scope) return scope;
+
+  // A context not declaring or using any object has the same scope as its
+  // parent.
+  if (objectsListsToBeDeclared.empty() &&
+      objectsListsOrEmptyToBeDeclared.empty() &&
+      emptyObjectsListsToBeDeclared.empty() && depthOfLastUse.empty())
+    return parentScope;
+
+  auto newScope = std::make_shared<Scope>();
+  newScope->declaredObjectsLists = GetAllObjectsToBeDeclared();
+  newScope->depthOfLastUse = depthOfLastUse;
+  newScope->parent = parentScope;
+  scope = std::move(newScope);
+  return scope;
+}
+
 void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName) {
   gd::EventsCodeGenerationContext* asyncContext = IsAsyncCallback() ? this : nearestAsyncParent;
   for (;
@@ -79,6 +87,7 @@ void EventsCodeGenerationContext::ObjectsListNeeded(
   }
 
   depthOfLastUse[objectName] = GetContextDepth();
+  scope.reset();
 }
 
 void EventsCodeGenerationContext::ObjectsListNeededOrEmptyIfJustDeclared(
@@ -92,6 +101,7 @@ void EventsCodeGenerationContext::ObjectsListNeededOrEmptyIfJustDeclared(
   }
 
   depthOfLastUse[objectName] = GetContextDepth();
+  scope.reset();
 }
 
 void EventsCodeGenerationContext::EmptyObjectsListNeeded(
@@ -101,6 +111,7 @@ void EventsCodeGenerationContext::EmptyObjectsListNeeded(
   }
 
   depthOfLastUse[objectName] = GetContextDepth();
+  scope.reset();
 }
 
 std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
@@ -115,9 +126,41 @@ std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
   return allObjectListsToBeDeclared;
 }
 
+bool EventsCodeGenerationContext::ObjectAlreadyDeclaredByParents(
+    const gd::String& objectName) const {
+  for (const Scope* ancestorScope = parentScope.get(); ancestorScope;
+       ancestorScope = ancestorScope->parent.get()) {
+    if (ancestorScope->declaredObjectsLists.count(objectName) != 0) return true;
+  }
+
+  return false;
+}
+
+std::set<gd::String>
+EventsCodeGenerationContext::GetObjectsListsAlreadyDeclaredByParents() const {
+  std::set<gd::String> alreadyDeclaredObjectsLists;
+  for (const Scope* ancestorScope = parentScope.get(); ancestorScope;
+       ancestorScope = ancestorScope->parent.get()) {
+    alreadyDeclaredObjectsLists.insert(
+        ancestorScope->declaredObjectsLists.begin(),
+        ancestorScope->declaredObjectsLists.end());
+  }
+
+  return alreadyDeclaredObjectsLists;
+}
+
 unsigned int EventsCodeGenerationContext::GetLastDepthObjectListWasNeeded(
     const gd::String& name) const {
-  if (depthOfLastUse.count(name) != 0) return depthOfLastUse.find(name)->second;
+  auto it = depthOfLastUse.find(name);
+  if (it != depthOfLastUse.end()) return it->second;
+
+  // Look for the last use in the parents, the nearest one being the last.
+  for (const Scope* ancestorScope = parentScope.get(); ancestorScope;
+       ancestorScope = ancestorScope->parent.get()) {
+    auto parentIt = ancestorScope->depthOfLastUse.find(name);
+    if (parentIt != ancestorScope->depthOfLastUse.end())
+      return parentIt->second;
+  }
 
   std::cout << "WARNING: During code generation, the last depth of an object "
                "list was 0."
@@ -139,10 +139,7 @@ class GD_CORE_API EventsCodeGenerationContext {
   /**
    * Return true if an object list has already been declared by the parent contexts.
    */
-  bool ObjectAlreadyDeclaredByParents(const gd::String& objectName) const {
-    return (alreadyDeclaredObjectsLists.find(objectName) !=
-            alreadyDeclaredObjectsLists.end());
-  };
+  bool ObjectAlreadyDeclaredByParents(const gd::String& objectName) const;
 
   /**
    * Return all the objects lists which will be declared by the current context
@@ -178,10 +175,11 @@ class GD_CORE_API EventsCodeGenerationContext {
   /**
    * Return the objects lists which are already declared and can be used in the
    * current context without declaration.
+   *
+   * \note The set is built from the scopes of all the parents, prefer
+   * ObjectAlreadyDeclaredByParents to check a single object.
    */
-  const std::set<gd::String>& GetObjectsListsAlreadyDeclaredByParents() const {
-    return alreadyDeclaredObjectsLists;
-  };
+  std::set<gd::String> GetObjectsListsAlreadyDeclaredByParents() const;
 
   /**
    * \brief Get the depth of the context that was in effect when \a objectName
@@ -269,11 +267,33 @@ class GD_CORE_API EventsCodeGenerationContext {
   };
 
  private:
+  /**
+   * \brief The objects lists declared by a context and the depths at which
+   * objects were used in it, as they were when a child context was created.
+   *
+   * Scopes are immutable and chained to the scope of the parent of the
+   * context, so that children contexts share them instead of copying all the
+   * objects lists declared by their parents.
+   */
+  struct Scope {
+    std::set<gd::String> declaredObjectsLists;
+    std::map<gd::String, unsigned int> depthOfLastUse;
+    std::shared_ptr<const Scope> parent;
+  };
+
+  /**
+   * \brief Return the scope of this context, to be used by a child context.
+   */
+  const std::shared_ptr<const Scope>& GetScope();
+
   void NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName);
 
-  std::set<gd::String>
-      alreadyDeclaredObjectsLists;  ///< Objects lists already needed in a
-                                    ///< parent context.
+  std::shared_ptr<const Scope>
+      parentScope;  ///< The scope of the parent, containing the objects lists
+                    ///< already needed in the parent contexts.
+  std::shared_ptr<const Scope>
+      scope;  ///< The scope of this context, created when needed by a child
+              ///< context and reset when the context is modified.
   std::set<gd::String>
       objectsListsToBeDeclared;  ///< Objects lists that will be declared in
                                  ///< this context.
@@ -298,7 +318,8 @@ class GD_CORE_API EventsCodeGenerationContext {
                                                  ///< backed up.
 
   std::map<gd::String, unsigned int>
-      depthOfLastUse;  ///< The context depth when an object was last used.
+      depthOfLastUse;  ///< The context depth when an object was last used in
+                       ///< this context (see also parentScope).
   gd::String
       currentObject;  ///< The object being used by an action or condition.
   unsigned int contextDepth = 0;  ///< The depth of the context: 0 for a newly
@@ -312,7 +312,8 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
   gd::String conditionCode;
 
   const gd::InstructionMetadata& instrInfos =
-      MetadataProvider::GetConditionMetadata(platform, condition.GetType());
+      MetadataProvider::GetConditionMetadata(platform,
+                                             condition.GetTypeSymbol());
   if (MetadataProvider::IsBadInstructionMetadata(instrInfos)) {
     return "/* Unknown instruction - skipped. */";
   }
@@ -600,7 +601,8 @@ gd::String EventsCodeGenerator::GenerateActionCode(
   gd::String actionCode;
 
   const gd::InstructionMetadata& instrInfos =
-      MetadataProvider::GetActionMetadata(platform, action.GetType());
+      MetadataProvider::GetActionMetadata(platform,
+                                          action.GetTypeSymbol());
   if (MetadataProvider::IsBadInstructionMetadata(instrInfos)) {
     return "/* Unknown instruction - skipped. */";
   }
@@ -807,11 +809,12 @@ EventsCodeGenerator::GenerateCallback(
   const gd::String clearLocalVariablesCode =
       GenerateLocalVariablesStackAccessor() + ".length = 0;\n";
 
-  const gd::String callbackCode = callbackFunctionName + " = function (" +
-                                  GenerateEventsParameters(callbackContext) +
-                                  ") {\n" + restoreLocalVariablesCode +
-                                  actionsDeclarationsCode + actionsCode +
-                                  clearLocalVariablesCode + "}\n";
+  gd::CodeOutput callbackCode;
+  callbackCode += callbackFunctionName + " = function (" +
+                  GenerateEventsParameters(callbackContext) + ") {\n" +
+                  restoreLocalVariablesCode + actionsDeclarationsCode;
+  callbackCode += std::move(actionsCode);
+  callbackCode += clearLocalVariablesCode + "}\n";
 
   AddCustomCodeOutsideMain(callbackCode);
 
@@ -1089,7 +1092,9 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
  */
 gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::EventsList& events, EventsCodeGenerationContext& parentContext) {
-  gd::String output;
+  // The code of each event is appended without being copied, and the whole
+  // code is only concatenated once at the end.
+  gd::CodeOutput output;
   for (std::size_t eId = 0; eId < events.size(); ++eId) {
     auto& event = events[eId];
     if (event.HasVariables()) {
@@ -1097,13 +1102,6 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
           event.GetVariables());
     }
 
-    // Each event has its own context : Objects picked in an event are totally
-    // different than the one picked in another.
-    gd::EventsCodeGenerationContext newContext;
-    newContext.InheritsFrom(
-        parentContext);  // Events in the same "level" share
-                         // the same context as their parent.
-
     //*Optimization*: when the event is the last of a list, we can use the
     // same lists of objects as the parent (as they will be discarded just
     // after). This avoids a copy of the lists of objects which is an expensive
@@ -1111,26 +1109,31 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
     bool reuseParentContext =
         parentContext.CanReuse() && eId == events.size() - 1;
 
-    // TODO: avoid creating if useless.
-    gd::EventsCodeGenerationContext reusedContext;
-    reusedContext.Reuse(parentContext);
-
-    auto& context = reuseParentContext ? reusedContext : newContext;
+    // Otherwise, each event has its own context : Objects picked in an event
+    // are totally different than the one picked in another.
+    gd::EventsCodeGenerationContext context;
+    if (reuseParentContext)
+      context.Reuse(parentContext);
+    else
+      context.InheritsFrom(parentContext);  // Events in the same "level"
+                                            // share the same context as
+                                            // their parent.
 
     gd::String eventCoreCode = event.GenerateEventCode(*this, context);
     gd::String scopeBegin = GenerateScopeBegin(context);
     gd::String scopeEnd = GenerateScopeEnd(context);
     gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
 
-    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
-              eventCoreCode + "\n" + scopeEnd + "\n";
+    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n";
+    output += std::move(eventCoreCode);
+    output += "\n" + scopeEnd + "\n";
 
     if (event.HasVariables()) {
       GetProjectScopedContainers().GetVariablesContainersList().Pop();
     }
   }
 
-  return output;
+  return output.ToString();
 }
 
 gd::String EventsCodeGenerator::ConvertToString(gd::String plainString) {
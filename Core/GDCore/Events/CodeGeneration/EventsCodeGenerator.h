@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "GDCore/Events/CodeGeneration/CodeOutput.h"
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/Instruction.h"
@@ -283,6 +284,13 @@ class GD_CORE_API EventsCodeGenerator {
    * \brief Add some code before events outside the main function.
    */
   void AddCustomCodeOutsideMain(gd::String code) {
+    customCodeOutsideMain += std::move(code);
+  };
+
+  /**
+   * \brief Add some code before events outside the main function.
+   */
+  void AddCustomCodeOutsideMain(const gd::CodeOutput& code) {
     customCodeOutsideMain += code;
   };
 
@@ -292,7 +300,7 @@ class GD_CORE_API EventsCodeGenerator {
 
   /** \brief Get the custom code to be inserted outside main.
    */
-  const gd::String& GetCustomCodeOutsideMain() const {
+  const gd::CodeOutput& GetCustomCodeOutsideMain() const {
     return customCodeOutsideMain;
   }
 
@@ -864,8 +872,9 @@ class GD_CORE_API EventsCodeGenerator {
       includeFiles;  ///< List of headers files used by instructions. A (shared)
                      ///< pointer is used so as context created from another one
                      ///< can share the same list.
-  gd::String customCodeOutsideMain;  ///< Custom code inserted before events (
-                                     ///< and not in events function )
+  gd::CodeOutput customCodeOutsideMain;  ///< Custom code inserted before
+                                         ///< events (and not in events
+                                         ///< function)
   std::set<gd::String>
       customGlobalDeclarations;     ///< Custom global C++ declarations inserted
                                     ///< after includes
@@ -76,7 +76,8 @@ void BaseEvent::PreprocessAsyncActions(const gd::Platform& platform) {
     for (std::size_t aId = 0; aId < actionsList->size(); ++aId) {
       const auto& action = actionsList->at(aId);
       const gd::InstructionMetadata& actionMetadata =
-          gd::MetadataProvider::GetActionMetadata(platform, action.GetType());
+          gd::MetadataProvider::GetActionMetadata(platform,
+                                                  action.GetTypeSymbol());
       if (actionMetadata.IsAsync() &&
           (!actionMetadata.IsOptionallyAsync() || action.IsAwaited())) {
         gd::InstructionsList remainingActions;
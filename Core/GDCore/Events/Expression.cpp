@@ -6,9 +6,15 @@
 
 #include "GDCore/Events/Expression.h"
 
+#include <atomic>
+
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/String.h"
 
+namespace {
+std::atomic<std::size_t> parsesCount(0);
+}
+
 namespace gd {
 
 Expression::Expression() : node(nullptr) {};
@@ -20,22 +26,45 @@ Expression::Expression(const char* plainString_)
     : node(nullptr), plainString(plainString_) {};
 
 Expression::Expression(const Expression& copy)
-    : node(nullptr), plainString{copy.plainString} {};
+    : node(std::atomic_load(&copy.node)), plainString{copy.plainString} {};
 
 Expression& Expression::operator=(const Expression& expression) {
+  if (&expression == this) return *this;
+
   plainString = expression.plainString;
-  node = nullptr;
+  std::atomic_store(&node, std::atomic_load(&expression.node));
   return *this;
 };
 
 Expression::~Expression(){};
 
 ExpressionNode* Expression::GetRootNode() const {
-  if (!node) {
+  std::shared_ptr<gd::ExpressionNode> currentNode = std::atomic_load(&node);
+  if (!currentNode) {
     gd::ExpressionParser2 parser = ExpressionParser2();
-    node = std::move(parser.ParseExpression(plainString));
+    std::shared_ptr<gd::ExpressionNode> parsedNode =
+        parser.ParseExpression(plainString);
+    parsesCount++;
+
+    // The expression can be read by different threads (for example when
+    // generating the code of scenes in parallel): only keep the first tree
+    // that was parsed.
+    if (std::atomic_compare_exchange_strong(&node, &currentNode, parsedNode))
+      currentNode = parsedNode;
   }
-  return node.get();
+  return currentNode.get();
 }
 
+ExpressionNode* Expression::GetRootNodeForModification() const {
+  if (node && node.use_count() > 1) {
+    // Don't modify the tree used by the copies of this expression.
+    node = nullptr;
+  }
+  return GetRootNode();
+}
+
+std::size_t Expression::GetParsesCount() { return parsesCount; }
+
+void Expression::ResetParsesCount() { parsesCount = 0; }
+
 }  // namespace gd
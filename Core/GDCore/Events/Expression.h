@@ -20,8 +20,16 @@ namespace gd {
 
 /**
  * \brief Class representing an expression used as a parameter of a
- * gd::Instruction. This class is nothing more than a wrapper around a
- * gd::String.
+ * gd::Instruction. This class is a wrapper around a gd::String, also
+ * caching the tree of nodes of the parsed expression.
+ *
+ * The tree is parsed the first time it's requested and is shared between
+ * copies of the expression (it's only parsed again if the expression is
+ * changed). For this reason, the tree returned by GetRootNode must not be
+ * modified: use GetRootNodeForModification instead.
+ *
+ * GetRootNode can be called by several threads at the same time (but the
+ * expression must not be modified meanwhile).
  *
  * \see gd::Instruction
  *
@@ -61,10 +69,38 @@ class GD_CORE_API Expression {
 
   /**
    * @brief Get the expression node.
-   * @return std::unique_ptr<gd::ExpressionNode>
+   *
+   * The tree is shared with the copies of this expression and must not be
+   * modified.
+   *
+   * @return The root node of the parsed expression.
    */
   gd::ExpressionNode* GetRootNode() const;
 
+  /**
+   * @brief Get the expression node, to be modified (for example by a worker
+   * renaming something before printing the expression back).
+   *
+   * If the tree was shared with copies of this expression, the expression is
+   * parsed again so that the copies are not modified.
+   *
+   * @return The root node of the parsed expression.
+   */
+  gd::ExpressionNode* GetRootNodeForModification() const;
+
+  /**
+   * \brief Return the number of times an expression was parsed by
+   * gd::Expression since the start (or the last call to ResetParsesCount).
+   *
+   * \note Useful for tests and benchmarks.
+   */
+  static std::size_t GetParsesCount();
+
+  /**
+   * \brief Reset the number of times expressions were parsed.
+   */
+  static void ResetParsesCount();
+
   /**
    * \brief Mimics std::string::c_str
    */
@@ -74,7 +110,9 @@ class GD_CORE_API Expression {
 
  private:
   gd::String plainString;  ///< The expression string
-  mutable std::unique_ptr<gd::ExpressionNode> node;
+  mutable std::shared_ptr<gd::ExpressionNode>
+      node;  ///< The parsed expression, lazily created and shared between
+             ///< copies of the expression.
 };
 
 }  // namespace gd
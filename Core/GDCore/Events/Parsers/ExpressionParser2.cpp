@@ -29,7 +29,7 @@ namespace gd {
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
 
 ExpressionParser2::ExpressionParser2()
-    : expression(""),
+    : expression(),
       currentPosition(0) {}
 
 std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
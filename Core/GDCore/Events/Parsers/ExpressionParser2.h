@@ -6,7 +6,9 @@
 #ifndef GDCORE_EXPRESSIONPARSER2_H
 #define GDCORE_EXPRESSIONPARSER2_H
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -38,6 +40,12 @@ using namespace gd::GrammarTerminals;
  * parser by refactoring out the dependency on gd::MetadataProvider (injecting
  * instead functions to be called to query supported functions).
  *
+ * The expression is decoded once into a buffer of code points before parsing,
+ * so that reading a character at the current position is done in constant
+ * time (gd::String indexing is linear as it's walking the UTF-8 string).
+ * Positions stored in gd::ExpressionParserLocation are still indices of code
+ * points in the expression.
+ *
  * \see gd::ExpressionParserError
  * \see gd::ExpressionNode
  */
@@ -51,11 +59,13 @@ class GD_CORE_API ExpressionParser2 {
    *
    * \param expression The expression to parse.
    *
-   * \return The node representing the expression as a parsed tree.
+   * \return The node representing the expression as a parsed tree. Its nodes
+   * are allocated in their own gd::ExpressionNodeArena.
    */
   std::unique_ptr<ExpressionNode> ParseExpression(
       const gd::String &expression_) {
-    expression = expression_;
+    gd::ExpressionNodeArena arena;
+    expression = expression_.ToUTF32();
 
     currentPosition = 0;
     return Start();
@@ -622,8 +632,9 @@ class GD_CORE_API ExpressionParser2 {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
     return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+            std::equal(NAMESPACE_SEPARATOR.begin(),
+                       NAMESPACE_SEPARATOR.end(),
+                       expression.begin() + currentPosition));
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -635,35 +646,29 @@ class GD_CORE_API ExpressionParser2 {
   };
 
   IdentifierAndLocation ReadIdentifierName(bool allowDeprecatedSpacesInName = true) {
-    gd::String name;
     size_t startPosition = currentPosition;
     while (currentPosition < expression.size() &&
            (CheckIfChar(IsAllowedInIdentifier)
             // Allow whitespace in identifier name for compatibility
             || (allowDeprecatedSpacesInName && expression[currentPosition] == ' '))) {
-      name += expression[currentPosition];
       currentPosition++;
     }
 
     // Trim whitespace at the end (we allow them for compatibility inside
     // the name, but after the last character that is not whitespace, they
     // should be ignore again).
-    if (!name.empty() && IsWhitespace(name[name.size() - 1])) {
-      size_t lastCharacterPos = name.size() - 1;
-      while (lastCharacterPos < name.size() &&
-             IsWhitespace(name[lastCharacterPos])) {
-        lastCharacterPos--;
-      }
-      if ((lastCharacterPos + 1) < name.size()) {
-        name.erase(lastCharacterPos + 1);
-      }
+    size_t endPosition = currentPosition;
+    while (endPosition > startPosition &&
+           IsWhitespace(expression[endPosition - 1])) {
+      endPosition--;
     }
 
     IdentifierAndLocation identifierAndLocation{
-        name,
+        gd::String::FromUTF32(
+            expression.substr(startPosition, endPosition - startPosition)),
         // The location is ignoring the trailing whitespace (only whitespace
         // inside the identifier are allowed for compatibility).
-        ExpressionParserLocation(startPosition, startPosition + name.size())};
+        ExpressionParserLocation(startPosition, endPosition)};
     return identifierAndLocation;
   }
 
@@ -673,14 +678,13 @@ class GD_CORE_API ExpressionParser2 {
 
   std::unique_ptr<EmptyNode> ReadUntilWhitespace() {
     size_t startPosition = GetCurrentPosition();
-    gd::String text;
     while (currentPosition < expression.size() &&
            !IsWhitespace(expression[currentPosition])) {
-      text += expression[currentPosition];
       currentPosition++;
     }
 
-    auto node = gd::make_unique<EmptyNode>(text);
+    auto node = gd::make_unique<EmptyNode>(gd::String::FromUTF32(
+        expression.substr(startPosition, currentPosition - startPosition)));
     node->location =
         ExpressionParserLocation(startPosition, GetCurrentPosition());
     return node;
@@ -688,13 +692,10 @@ class GD_CORE_API ExpressionParser2 {
 
   std::unique_ptr<EmptyNode> ReadUntilEnd() {
     size_t startPosition = GetCurrentPosition();
-    gd::String text;
-    while (currentPosition < expression.size()) {
-      text += expression[currentPosition];
-      currentPosition++;
-    }
+    currentPosition = expression.size();
 
-    auto node = gd::make_unique<EmptyNode>(text);
+    auto node = gd::make_unique<EmptyNode>(
+        gd::String::FromUTF32(expression.substr(startPosition)));
     node->location =
         ExpressionParserLocation(startPosition, GetCurrentPosition());
     return node;
@@ -731,7 +732,7 @@ class GD_CORE_API ExpressionParser2 {
   }
   ///@}
 
-  gd::String expression;
+  std::u32string expression;  ///< The expression being parsed, as code points.
   std::size_t currentPosition;
 
   static gd::String NAMESPACE_SEPARATOR;
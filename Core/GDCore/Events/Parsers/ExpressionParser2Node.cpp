@@ -5,6 +5,146 @@
  */
 #include "ExpressionParser2Node.h"
 
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+namespace {
+
+const std::size_t firstBlockSize = 1024;
+const std::size_t maxBlockSize = 16 * 1024;
+const std::size_t alignment = alignof(std::max_align_t);
+
+std::size_t AlignSize(std::size_t size) {
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * The header of a block of memory containing nodes.
+ */
+struct Block {
+  Block *previous;
+  std::size_t size;
+};
+
+/**
+ * The blocks of an arena. They are referenced by the arena and by each node
+ * allocated in them, so that they are freed only when all of them are
+ * destroyed (which can happen on any thread).
+ */
+struct Storage {
+  std::atomic<std::size_t> references{1};
+  Block *block = nullptr;  ///< The block where nodes are allocated.
+  std::size_t usedSize = 0;  ///< The used size of the block.
+};
+
+// Each allocation is prefixed by a pointer to its storage (or nullptr if it
+// was not allocated in an arena).
+const std::size_t allocationHeaderSize = AlignSize(sizeof(Storage *));
+const std::size_t blockHeaderSize = AlignSize(sizeof(Block));
+
+std::atomic<std::size_t> allocationsCount(0);
+std::atomic<std::size_t> systemAllocationsCount(0);
+std::atomic<std::size_t> allocatedBlocksCount(0);
+
+void ReleaseStorage(Storage *storage) {
+  if (--storage->references != 0) return;
+
+  Block *block = storage->block;
+  while (block) {
+    Block *previous = block->previous;
+    block->~Block();
+    ::operator delete(block);
+    allocatedBlocksCount--;
+    block = previous;
+  }
+  delete storage;
+}
+
+/**
+ * The storage of the arena where the thread allocates new nodes, if any.
+ */
+thread_local Storage *currentStorage = nullptr;
+
+}  // namespace
+
 namespace gd {
 
-}
\ No newline at end of file
+ExpressionNodeArena::ExpressionNodeArena()
+    : storage(new Storage()), previous(currentStorage) {
+  currentStorage = static_cast<Storage *>(storage);
+}
+
+ExpressionNodeArena::~ExpressionNodeArena() {
+  currentStorage = static_cast<Storage *>(previous);
+  ReleaseStorage(static_cast<Storage *>(storage));
+}
+
+void *ExpressionNodeArena::Allocate(std::size_t size) {
+  std::size_t allocationSize = allocationHeaderSize + AlignSize(size);
+  Storage *storage = currentStorage;
+  if (!storage || allocationSize > maxBlockSize - blockHeaderSize) {
+    char *memory = static_cast<char *>(::operator new(allocationSize));
+    if (storage) {
+      allocationsCount++;
+      systemAllocationsCount++;
+    }
+    *reinterpret_cast<Storage **>(memory) = nullptr;
+    return memory + allocationHeaderSize;
+  }
+
+  allocationsCount++;
+  Block *block = storage->block;
+  if (!block || storage->usedSize + allocationSize > block->size) {
+    // Blocks are larger and larger, so that small expressions use little
+    // memory and large ones few blocks.
+    std::size_t newBlockSize =
+        block ? std::min(block->size * 2, maxBlockSize) : firstBlockSize;
+    while (newBlockSize < blockHeaderSize + allocationSize) newBlockSize *= 2;
+
+    block = new (::operator new(newBlockSize)) Block();
+    systemAllocationsCount++;
+    allocatedBlocksCount++;
+    block->previous = storage->block;
+    block->size = newBlockSize;
+    storage->block = block;
+    storage->usedSize = blockHeaderSize;
+  }
+
+  char *memory = reinterpret_cast<char *>(block) + storage->usedSize;
+  storage->usedSize += allocationSize;
+  storage->references++;
+  *reinterpret_cast<Storage **>(memory) = storage;
+  return memory + allocationHeaderSize;
+}
+
+void ExpressionNodeArena::Deallocate(void *pointer) {
+  if (!pointer) return;
+
+  char *memory = static_cast<char *>(pointer) - allocationHeaderSize;
+  Storage *storage = *reinterpret_cast<Storage **>(memory);
+  if (storage) {
+    ReleaseStorage(storage);
+  } else {
+    ::operator delete(memory);
+  }
+}
+
+std::size_t ExpressionNodeArena::GetAllocationsCount() {
+  return allocationsCount;
+}
+
+std::size_t ExpressionNodeArena::GetSystemAllocationsCount() {
+  return systemAllocationsCount;
+}
+
+std::size_t ExpressionNodeArena::GetAllocatedBlocksCount() {
+  return allocatedBlocksCount;
+}
+
+void ExpressionNodeArena::ResetCounters() {
+  allocationsCount = 0;
+  systemAllocationsCount = 0;
+}
+
+}  // namespace gd
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -40,6 +41,64 @@ struct GD_CORE_API ExpressionParserLocation {
   size_t endPosition = 0;
 };
 
+/**
+ * \brief An arena where the nodes of the tree of a parsed expression (and
+ * their diagnostics) are allocated.
+ *
+ * While an arena exists, the nodes created by its thread are allocated one
+ * after the other in blocks of memory owned by the arena, instead of each
+ * node being a separate allocation. The blocks are given back to the system
+ * in one step, once the arena and all the nodes allocated in it are
+ * destroyed: an arena is used for each parsed expression, so that its memory
+ * is freed with its tree. Nodes created without an arena (for example, by the
+ * refactoring tools) are allocated as usual.
+ *
+ * Nodes are still owned by std::unique_ptr so that the trees and the workers
+ * visiting them are the same as with any other allocation.
+ *
+ * \see gd::ExpressionParser2::ParseExpression
+ */
+class GD_CORE_API ExpressionNodeArena {
+ public:
+  /**
+   * \brief Allocate the nodes created by the thread in a new arena, until
+   * the arena is destroyed.
+   */
+  ExpressionNodeArena();
+  ~ExpressionNodeArena();
+
+  ExpressionNodeArena(const ExpressionNodeArena &) = delete;
+  ExpressionNodeArena &operator=(const ExpressionNodeArena &) = delete;
+
+  static void *Allocate(std::size_t size);
+  static void Deallocate(void *pointer);
+
+  /**
+   * \brief Return the number of nodes (and diagnostics) allocated in arenas
+   * since the start (or the last call to ResetCounters).
+   */
+  static std::size_t GetAllocationsCount();
+
+  /**
+   * \brief Return the number of allocations done on the system for them
+   * (i.e: the number of blocks, plus nodes too large to be stored in a
+   * block) since the start (or the last call to ResetCounters).
+   */
+  static std::size_t GetSystemAllocationsCount();
+
+  /**
+   * \brief Return the number of blocks that are not yet given back to the
+   * system.
+   */
+  static std::size_t GetAllocatedBlocksCount();
+
+  static void ResetCounters();
+
+ private:
+  void *storage;   ///< The blocks of the arena, freed after its nodes.
+  void *previous;  ///< The storage of the arena used before this one.
+};
+
 /**
  * \brief An error that can be attached to a gd::ExpressionNode.
  */
@@ -78,6 +137,13 @@ struct GD_CORE_API ExpressionParserError {
         location(startPosition_, endPosition_){};
   virtual ~ExpressionParserError(){};
 
+  static void *operator new(std::size_t size) {
+    return ExpressionNodeArena::Allocate(size);
+  }
+  static void operator delete(void *pointer) {
+    ExpressionNodeArena::Deallocate(pointer);
+  }
+
   gd::ExpressionParserError::ErrorType GetType() { return type; }
   const gd::String &GetMessage() { return message; }
   const gd::String &GetObjectName() { return objectName; }
@@ -102,6 +168,13 @@ struct GD_CORE_API ExpressionNode {
   virtual ~ExpressionNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker){};
 
+  static void *operator new(std::size_t size) {
+    return ExpressionNodeArena::Allocate(size);
+  }
+  static void operator delete(void *pointer) {
+    ExpressionNodeArena::Deallocate(pointer);
+  }
+
   std::unique_ptr<ExpressionParserError> diagnostic;
   ExpressionParserLocation location;  ///< The location of the entire node. Some
                                       /// nodes might have other locations
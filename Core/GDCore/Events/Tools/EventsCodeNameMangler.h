@@ -6,6 +6,7 @@
 #if defined(GD_IDE_ONLY)
 #ifndef EVENTSCODENAMEMANGLER_H
 #define EVENTSCODENAMEMANGLER_H
+#include <mutex>
 #include <unordered_map>
 #include "GDCore/String.h"
 
@@ -54,6 +55,8 @@ class GD_CORE_API EventsCodeNameMangler {
   std::unordered_map<gd::String, gd::String>
       mangledExternalEventsNames;  ///< Memoized results of mangling for
                                    /// external events
+  std::mutex mangledNamesMutex;  ///< Protect the memoized results, as names
+                                 ///< can be mangled by different threads.
 };
 
 /**
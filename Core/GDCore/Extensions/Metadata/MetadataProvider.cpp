@@ -11,6 +11,7 @@
 #include "GDCore/Extensions/Metadata/EffectMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Metadata/PlatformMetadataIndex.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Layout.h"  // For GetTypeOfObject and GetTypeOfBehavior
@@ -29,14 +30,38 @@ gd::InstructionMetadata MetadataProvider::badInstructionMetadata;
 gd::ExpressionMetadata MetadataProvider::badExpressionMetadata;
 gd::PlatformExtension MetadataProvider::badExtension;
 
+namespace {
+/**
+ * \brief Search metadata with \a find in the index of the platform, declaring
+ * first the extensions not declared yet that could provide the type.
+ *
+ * \see gd::Platform::DeclareLazyExtensionsBefore
+ */
+template <class Find>
+auto FindInMetadataIndex(const gd::Platform& platform,
+                         const gd::String& type,
+                         Find find)
+    -> decltype(find(platform.GetMetadataIndex(type))) {
+  auto* extensionAndMetadata = find(platform.GetMetadataIndex(type));
+  if (platform.DeclareLazyExtensionsBefore(
+          type,
+          extensionAndMetadata ? &extensionAndMetadata->GetExtension()
+                               : nullptr))
+    extensionAndMetadata = find(platform.GetMetadataIndex(type));
+
+  return extensionAndMetadata;
+}
+}  // namespace
+
 ExtensionAndMetadata<BehaviorMetadata>
 MetadataProvider::GetExtensionAndBehaviorMetadata(const gd::Platform& platform,
                                                   gd::String behaviorType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    if (extension->HasBehavior(behaviorType))
-      return ExtensionAndMetadata<BehaviorMetadata>(
-          *extension, extension->GetBehaviorMetadata(behaviorType));
-  }
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, behaviorType, [&](const PlatformMetadataIndex& index) {
+            return index.FindBehavior(behaviorType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
 
   return ExtensionAndMetadata<BehaviorMetadata>(badExtension, badBehaviorMetadata);
 }
@@ -49,14 +74,12 @@ const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
 ExtensionAndMetadata<ObjectMetadata>
 MetadataProvider::GetExtensionAndObjectMetadata(const gd::Platform& platform,
                                                 gd::String objectType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionObjectsTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == objectType)
-        return ExtensionAndMetadata<ObjectMetadata>(
-            *extension, extension->GetObjectMetadata(objectType));
-    }
-  }
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, objectType, [&](const PlatformMetadataIndex& index) {
+            return index.FindObject(objectType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
 
   return ExtensionAndMetadata<ObjectMetadata>(badExtension, badObjectInfo);
 }
@@ -69,14 +92,12 @@ const ObjectMetadata& MetadataProvider::GetObjectMetadata(
 ExtensionAndMetadata<EffectMetadata>
 MetadataProvider::GetExtensionAndEffectMetadata(const gd::Platform& platform,
                                                 gd::String type) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionEffectTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == type)
-        return ExtensionAndMetadata<EffectMetadata>(
-            *extension, extension->GetEffectMetadata(type));
-    }
-  }
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, type, [&](const PlatformMetadataIndex& index) {
+            return index.FindEffect(type);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
 
   return ExtensionAndMetadata<EffectMetadata>(badExtension, badEffectMetadata);
 }
@@ -89,34 +110,22 @@ const EffectMetadata& MetadataProvider::GetEffectMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
                                                 gd::String actionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allActions = extension->GetAllActions();
-    if (allActions.find(actionType) != allActions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allActions.find(actionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsActions =
-          extension->GetAllActionsForObject(extObjectType);
-      if (allObjectsActions.find(actionType) != allObjectsActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsActions.find(actionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosActions =
-          extension->GetAllActionsForBehavior(autos[j]);
-      if (allAutosActions.find(actionType) != allAutosActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosActions.find(actionType)->second);
-    }
-  }
+  return GetExtensionAndActionMetadata(platform, gd::Symbol(actionType));
+}
+
+ExtensionAndMetadata<InstructionMetadata>
+MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
+                                                const gd::Symbol& actionType) {
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform,
+          actionType.GetString(),
+          [&](const PlatformMetadataIndex& index) {
+            return index.FindAction(actionType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
 
-  return ExtensionAndMetadata<InstructionMetadata>(badExtension,
-                                                   badInstructionMetadata);
+  return ExtensionAndMetadata<InstructionMetadata>(badExtension, badInstructionMetadata);
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
@@ -124,37 +133,30 @@ const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
   return GetExtensionAndActionMetadata(platform, actionType).GetMetadata();
 }
 
+const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
+    const gd::Platform& platform, const gd::Symbol& actionType) {
+  return GetExtensionAndActionMetadata(platform, actionType).GetMetadata();
+}
+
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                                    gd::String conditionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allConditions = extension->GetAllConditions();
-    if (allConditions.find(conditionType) != allConditions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allConditions.find(conditionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsConditions =
-          extension->GetAllConditionsForObject(extObjectType);
-      if (allObjectsConditions.find(conditionType) != allObjectsConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsConditions.find(conditionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosConditions =
-          extension->GetAllConditionsForBehavior(autos[j]);
-      if (allAutosConditions.find(conditionType) != allAutosConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosConditions.find(conditionType)->second);
-    }
-  }
+  return GetExtensionAndConditionMetadata(platform, gd::Symbol(conditionType));
+}
 
-  return ExtensionAndMetadata<InstructionMetadata>(badExtension,
-                                                   badInstructionMetadata);
+ExtensionAndMetadata<InstructionMetadata>
+MetadataProvider::GetExtensionAndConditionMetadata(
+    const gd::Platform& platform, const gd::Symbol& conditionType) {
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform,
+          conditionType.GetString(),
+          [&](const PlatformMetadataIndex& index) {
+            return index.FindCondition(conditionType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
+
+  return ExtensionAndMetadata<InstructionMetadata>(badExtension, badInstructionMetadata);
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
@@ -163,32 +165,23 @@ const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
       .GetMetadata();
 }
 
+const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
+    const gd::Platform& platform, const gd::Symbol& conditionType) {
+  return GetExtensionAndConditionMetadata(platform, conditionType)
+      .GetMetadata();
+}
+
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectExpressions =
-          extension->GetAllExpressionsForObject(objectType);
-      if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allObjectExpressions =
-        extension->GetAllExpressionsForObject("");
-    if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, objectType, [&](const PlatformMetadataIndex& index) {
+            return index.FindObjectExpression(objectType, exprType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
+
+  return ExtensionAndMetadata<ExpressionMetadata>(badExtension, badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
@@ -200,28 +193,14 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    if (extension->HasBehavior(autoType)) {
-      const auto& allAutoExpressions =
-          extension->GetAllExpressionsForBehavior(autoType);
-      if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allAutoExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allAutoExpressions =
-        extension->GetAllExpressionsForBehavior("");
-    if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allAutoExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, autoType, [&](const PlatformMetadataIndex& index) {
+            return index.FindBehaviorExpression(autoType, exprType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
+
+  return ExtensionAndMetadata<ExpressionMetadata>(badExtension, badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
@@ -233,16 +212,14 @@ const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, exprType, [&](const PlatformMetadataIndex& index) {
+            return index.FindExpression(exprType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
+
+  return ExtensionAndMetadata<ExpressionMetadata>(badExtension, badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
@@ -253,30 +230,14 @@ const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectStrExpressions =
-          extension->GetAllStrExpressionsForObject(objectType);
-      if (allObjectStrExpressions.find(exprType) !=
-          allObjectStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allObjectStrExpressions =
-        extension->GetAllStrExpressionsForObject("");
-    if (allObjectStrExpressions.find(exprType) != allObjectStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectStrExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, objectType, [&](const PlatformMetadataIndex& index) {
+            return index.FindObjectStrExpression(objectType, exprType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
+
+  return ExtensionAndMetadata<ExpressionMetadata>(badExtension, badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
@@ -289,30 +250,14 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorStrExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    if (extension->HasBehavior(autoType)) {
-      const auto& allBehaviorStrExpressions =
-          extension->GetAllStrExpressionsForBehavior(autoType);
-      if (allBehaviorStrExpressions.find(exprType) !=
-          allBehaviorStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allBehaviorStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allBehaviorStrExpressions =
-        extension->GetAllStrExpressionsForBehavior("");
-    if (allBehaviorStrExpressions.find(exprType) !=
-        allBehaviorStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allBehaviorStrExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, autoType, [&](const PlatformMetadataIndex& index) {
+            return index.FindBehaviorStrExpression(autoType, exprType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
+
+  return ExtensionAndMetadata<ExpressionMetadata>(badExtension, badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata&
@@ -327,16 +272,14 @@ MetadataProvider::GetBehaviorStrExpressionMetadata(const gd::Platform& platform,
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndStrExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllStrExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  const auto* extensionAndMetadata =
+      FindInMetadataIndex(
+          platform, exprType, [&](const PlatformMetadataIndex& index) {
+            return index.FindStrExpression(exprType);
+          });
+  if (extensionAndMetadata) return *extensionAndMetadata;
+
+  return ExtensionAndMetadata<ExpressionMetadata>(badExtension, badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetStrExpressionMetadata(
@@ -7,6 +7,7 @@
 #define METADATAPROVIDER_H
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
 namespace gd {
 class BehaviorMetadata;
 class ObjectMetadata;
@@ -43,12 +44,12 @@ class ExtensionAndMetadata {
   /**
    * \brief Get the associated extension.
    */
-  const gd::PlatformExtension& GetExtension() { return *extension; };
+  const gd::PlatformExtension& GetExtension() const { return *extension; };
 
   /**
    * \brief Get the metadata.
    */
-  const T& GetMetadata() { return *metadata; };
+  const T& GetMetadata() const { return *metadata; };
 
  private:
   const gd::PlatformExtension* extension;
@@ -89,6 +90,14 @@ class GD_CORE_API MetadataProvider {
   GetExtensionAndActionMetadata(const gd::Platform& platform,
                                 gd::String actionType);
 
+  /**
+   * Get the metadata of an action, and its associated extension, from the
+   * symbol of its type (see gd::Instruction::GetTypeSymbol).
+   */
+  static ExtensionAndMetadata<InstructionMetadata>
+  GetExtensionAndActionMetadata(const gd::Platform& platform,
+                                const gd::Symbol& actionType);
+
   /**
    * Get the metadata of a condition, and its associated extension.
    * Works for object, behaviors and static conditions.
@@ -97,6 +106,14 @@ class GD_CORE_API MetadataProvider {
   GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                    gd::String conditionType);
 
+  /**
+   * Get the metadata of a condition, and its associated extension, from the
+   * symbol of its type (see gd::Instruction::GetTypeSymbol).
+   */
+  static ExtensionAndMetadata<InstructionMetadata>
+  GetExtensionAndConditionMetadata(const gd::Platform& platform,
+                                   const gd::Symbol& conditionType);
+
   /**
    * Get information about an expression, and its associated extension.
    * Works for free expressions.
@@ -174,6 +191,13 @@ class GD_CORE_API MetadataProvider {
   static const gd::InstructionMetadata& GetActionMetadata(
       const gd::Platform& platform, gd::String actionType);
 
+  /**
+   * Get the metadata of an action from the symbol of its type (see
+   * gd::Instruction::GetTypeSymbol).
+   */
+  static const gd::InstructionMetadata& GetActionMetadata(
+      const gd::Platform& platform, const gd::Symbol& actionType);
+
   /**
    * Get the metadata of a condition.
    * Works for object, behaviors and static conditions.
@@ -181,6 +205,13 @@ class GD_CORE_API MetadataProvider {
   static const gd::InstructionMetadata& GetConditionMetadata(
       const gd::Platform& platform, gd::String conditionType);
 
+  /**
+   * Get the metadata of a condition from the symbol of its type (see
+   * gd::Instruction::GetTypeSymbol).
+   */
+  static const gd::InstructionMetadata& GetConditionMetadata(
+      const gd::Platform& platform, const gd::Symbol& conditionType);
+
   /**
    * Get information about an expression from its type
    * Works for free expressions.
@@ -208,18 +208,24 @@ void ParameterMetadataTools::IterateOverParametersWithIndex(
                        size_t parameterIndex,
                        const gd::String& lastObjectName,
                        size_t lastObjectIndex)> fn) {
+  static const gd::Expression emptyExpression;
+
   gd::String lastObjectName = "";
   size_t lastObjectIndex = 0;
   for (std::size_t pNb = 0; pNb < parametersMetadata.GetParametersCount();
        ++pNb) {
     const gd::ParameterMetadata &parameterMetadata =
         parametersMetadata.GetParameter(pNb);
+    // Refer to the parameter rather than copying it, so that the parsed tree
+    // of the expression is kept by the instruction.
     const gd::Expression &parameterValue =
-        pNb < parameters.size() ? parameters[pNb].GetPlainString() : "";
+        pNb < parameters.size() ? parameters[pNb] : emptyExpression;
+    const bool useDefaultValue =
+        parameterValue.GetPlainString().empty() && parameterMetadata.IsOptional();
+    const gd::Expression defaultValue(
+        useDefaultValue ? parameterMetadata.GetDefaultValue() : "");
     const gd::Expression& parameterValueOrDefault =
-        parameterValue.GetPlainString().empty() && parameterMetadata.IsOptional()
-            ? Expression(parameterMetadata.GetDefaultValue())
-            : parameterValue;
+        useDefaultValue ? defaultValue : parameterValue;
 
     fn(parameterMetadata, parameterValueOrDefault, pNb, lastObjectName, lastObjectIndex);
 
@@ -0,0 +1,115 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Metadata/PlatformMetadataIndex.h"
+
+#include <map>
+
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/EffectMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * Add all the metadata to the index, without overwriting metadata already
+ * indexed for the same type (so that the first extension declaring a type
+ * is the one that is found).
+ */
+template <class Key, class T>
+void AddToIndex(std::unordered_map<Key, ExtensionAndMetadata<T>>& index,
+                const gd::PlatformExtension& extension,
+                const std::map<gd::String, T>& allMetadata) {
+  for (const auto& it : allMetadata) {
+    index.emplace(Key(it.first), ExtensionAndMetadata<T>(extension, it.second));
+  }
+}
+
+}  // namespace
+
+void PlatformMetadataIndex::AddExtension(gd::PlatformExtension& extension) {
+  const std::vector<gd::String> objectsTypes =
+      extension.GetExtensionObjectsTypes();
+  const std::vector<gd::String> behaviorsTypes =
+      extension.GetBehaviorsTypes();
+
+  for (const gd::String& objectType : objectsTypes) {
+    objects.emplace(objectType,
+                    ExtensionAndMetadata<ObjectMetadata>(
+                        extension, extension.GetObjectMetadata(objectType)));
+  }
+  for (const gd::String& behaviorType : behaviorsTypes) {
+    behaviors.emplace(
+        behaviorType,
+        ExtensionAndMetadata<BehaviorMetadata>(
+            extension, extension.GetBehaviorMetadata(behaviorType)));
+  }
+  for (const gd::String& effectType : extension.GetExtensionEffectTypes()) {
+    effects.emplace(effectType,
+                    ExtensionAndMetadata<EffectMetadata>(
+                        extension, extension.GetEffectMetadata(effectType)));
+  }
+
+  // Instructions are searched in the free instructions of the extension
+  // first, then in the instructions of its objects and of its behaviors.
+  AddToIndex(actions, extension, extension.GetAllActions());
+  AddToIndex(conditions, extension, extension.GetAllConditions());
+  for (const gd::String& objectType : objectsTypes) {
+    AddToIndex(
+        actions, extension, extension.GetAllActionsForObject(objectType));
+    AddToIndex(conditions,
+               extension,
+               extension.GetAllConditionsForObject(objectType));
+  }
+  for (const gd::String& behaviorType : behaviorsTypes) {
+    AddToIndex(
+        actions, extension, extension.GetAllActionsForBehavior(behaviorType));
+    AddToIndex(conditions,
+               extension,
+               extension.GetAllConditionsForBehavior(behaviorType));
+  }
+
+  AddToIndex(expressions, extension, extension.GetAllExpressions());
+  AddToIndex(strExpressions, extension, extension.GetAllStrExpressions());
+  for (const gd::String& objectType : objectsTypes) {
+    AddToIndex(objectsExpressions[objectType],
+               extension,
+               extension.GetAllExpressionsForObject(objectType));
+    AddToIndex(objectsStrExpressions[objectType],
+               extension,
+               extension.GetAllStrExpressionsForObject(objectType));
+  }
+  for (const gd::String& behaviorType : behaviorsTypes) {
+    AddToIndex(behaviorsExpressions[behaviorType],
+               extension,
+               extension.GetAllExpressionsForBehavior(behaviorType));
+    AddToIndex(behaviorsStrExpressions[behaviorType],
+               extension,
+               extension.GetAllStrExpressionsForBehavior(behaviorType));
+  }
+
+  // Expressions of the base object and base behavior are used for any
+  // object or behavior.
+  AddToIndex(baseObjectExpressions,
+             extension,
+             extension.GetAllExpressionsForObject(""));
+  AddToIndex(baseObjectStrExpressions,
+             extension,
+             extension.GetAllStrExpressionsForObject(""));
+  AddToIndex(baseBehaviorExpressions,
+             extension,
+             extension.GetAllExpressionsForBehavior(""));
+  AddToIndex(baseBehaviorStrExpressions,
+             extension,
+             extension.GetAllStrExpressionsForBehavior(""));
+}
+
+}  // namespace gd
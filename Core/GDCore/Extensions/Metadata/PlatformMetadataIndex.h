@@ -0,0 +1,190 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PLATFORMMETADATAINDEX_H
+#define GDCORE_PLATFORMMETADATAINDEX_H
+#include <unordered_map>
+
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
+namespace gd {
+class PlatformExtension;
+class BehaviorMetadata;
+class ObjectMetadata;
+class EffectMetadata;
+class InstructionMetadata;
+class ExpressionMetadata;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An index of all the metadata declared by the extensions of a
+ * platform, by type, so that gd::MetadataProvider can find them without
+ * iterating on every extension.
+ *
+ * The index is built by gd::Platform the first time it's needed and thrown
+ * away when an extension is added, removed or declared (see
+ * gd::Platform::AddLazyExtension). Extensions must not declare new objects,
+ * behaviors, effects, instructions or expressions after being added to the
+ * platform.
+ *
+ * When the same type is declared by more than one extension, the metadata of
+ * the first extension (in the platform loading order) is kept, like a linear
+ * search would do.
+ *
+ * Actions and conditions, which are the most searched, are indexed by the
+ * symbols of their types (so that they can be found without hashing or
+ * comparing strings).
+ *
+ * \see gd::MetadataProvider
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API PlatformMetadataIndex {
+ public:
+  PlatformMetadataIndex(){};
+  virtual ~PlatformMetadataIndex(){};
+
+  /**
+   * \brief Add the metadata declared by an extension to the index.
+   *
+   * Extensions must be added in the platform loading order.
+   */
+  void AddExtension(gd::PlatformExtension& extension);
+
+  /** \name Lookups
+   * Return a pointer to the metadata (and its extension), or nullptr if not
+   * found.
+   */
+  ///@{
+  const ExtensionAndMetadata<BehaviorMetadata>* FindBehavior(
+      const gd::String& behaviorType) const {
+    return Find(behaviors, behaviorType);
+  }
+
+  const ExtensionAndMetadata<ObjectMetadata>* FindObject(
+      const gd::String& objectType) const {
+    return Find(objects, objectType);
+  }
+
+  const ExtensionAndMetadata<EffectMetadata>* FindEffect(
+      const gd::String& effectType) const {
+    return Find(effects, effectType);
+  }
+
+  /**
+   * \brief Find a free, object or behavior action.
+   */
+  const ExtensionAndMetadata<InstructionMetadata>* FindAction(
+      const gd::Symbol& actionType) const {
+    return Find(actions, actionType);
+  }
+
+  /**
+   * \brief Find a free, object or behavior condition.
+   */
+  const ExtensionAndMetadata<InstructionMetadata>* FindCondition(
+      const gd::Symbol& conditionType) const {
+    return Find(conditions, conditionType);
+  }
+
+  const ExtensionAndMetadata<ExpressionMetadata>* FindExpression(
+      const gd::String& expressionType) const {
+    return Find(expressions, expressionType);
+  }
+
+  const ExtensionAndMetadata<ExpressionMetadata>* FindStrExpression(
+      const gd::String& expressionType) const {
+    return Find(strExpressions, expressionType);
+  }
+
+  /**
+   * \brief Find an expression of an object, falling back to the expressions
+   * of the base object.
+   */
+  const ExtensionAndMetadata<ExpressionMetadata>* FindObjectExpression(
+      const gd::String& objectType, const gd::String& expressionType) const {
+    return Find(objectsExpressions, baseObjectExpressions, objectType,
+                expressionType);
+  }
+
+  const ExtensionAndMetadata<ExpressionMetadata>* FindObjectStrExpression(
+      const gd::String& objectType, const gd::String& expressionType) const {
+    return Find(objectsStrExpressions, baseObjectStrExpressions, objectType,
+                expressionType);
+  }
+
+  /**
+   * \brief Find an expression of a behavior, falling back to the expressions
+   * of the base behavior.
+   */
+  const ExtensionAndMetadata<ExpressionMetadata>* FindBehaviorExpression(
+      const gd::String& behaviorType, const gd::String& expressionType) const {
+    return Find(behaviorsExpressions, baseBehaviorExpressions, behaviorType,
+                expressionType);
+  }
+
+  const ExtensionAndMetadata<ExpressionMetadata>* FindBehaviorStrExpression(
+      const gd::String& behaviorType, const gd::String& expressionType) const {
+    return Find(behaviorsStrExpressions, baseBehaviorStrExpressions,
+                behaviorType, expressionType);
+  }
+  ///@}
+
+ private:
+  typedef std::unordered_map<gd::Symbol,
+                             ExtensionAndMetadata<InstructionMetadata>>
+      InstructionsIndex;
+  typedef std::unordered_map<gd::String,
+                             ExtensionAndMetadata<ExpressionMetadata>>
+      ExpressionsIndex;
+
+  template <class Key, class T>
+  static const T* Find(const std::unordered_map<Key, T>& index,
+                       const Key& type) {
+    auto it = index.find(type);
+    return it != index.end() ? &it->second : nullptr;
+  }
+
+  static const ExtensionAndMetadata<ExpressionMetadata>* Find(
+      const std::unordered_map<gd::String, ExpressionsIndex>& index,
+      const ExpressionsIndex& baseIndex,
+      const gd::String& ownerType,
+      const gd::String& expressionType) {
+    auto it = index.find(ownerType);
+    if (it != index.end()) {
+      auto* metadata = Find(it->second, expressionType);
+      if (metadata) return metadata;
+    }
+
+    return Find(baseIndex, expressionType);
+  }
+
+  std::unordered_map<gd::String, ExtensionAndMetadata<BehaviorMetadata>>
+      behaviors;
+  std::unordered_map<gd::String, ExtensionAndMetadata<ObjectMetadata>> objects;
+  std::unordered_map<gd::String, ExtensionAndMetadata<EffectMetadata>> effects;
+  InstructionsIndex actions;
+  InstructionsIndex conditions;
+  ExpressionsIndex expressions;
+  ExpressionsIndex strExpressions;
+  std::unordered_map<gd::String, ExpressionsIndex>
+      objectsExpressions;  ///< Expressions, by object type.
+  std::unordered_map<gd::String, ExpressionsIndex>
+      objectsStrExpressions;  ///< String expressions, by object type.
+  std::unordered_map<gd::String, ExpressionsIndex>
+      behaviorsExpressions;  ///< Expressions, by behavior type.
+  std::unordered_map<gd::String, ExpressionsIndex>
+      behaviorsStrExpressions;  ///< String expressions, by behavior type.
+  ExpressionsIndex baseObjectExpressions;
+  ExpressionsIndex baseObjectStrExpressions;
+  ExpressionsIndex baseBehaviorExpressions;
+  ExpressionsIndex baseBehaviorStrExpressions;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PLATFORMMETADATAINDEX_H
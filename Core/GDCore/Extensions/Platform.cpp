@@ -5,22 +5,58 @@
  */
 #include "Platform.h"
 
+#include <atomic>
+
+#include "GDCore/Extensions/Metadata/PlatformMetadataIndex.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectConfiguration.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
 
 using namespace std;
 
 #undef CreateEvent
 
+namespace {
+std::size_t NewExtensionsVersion() {
+  static std::atomic<std::size_t> lastExtensionsVersion(0);
+  return ++lastExtensionsVersion;
+}
+}  // namespace
+
 namespace gd {
 
 InstructionOrExpressionGroupMetadata
     Platform::badInstructionOrExpressionGroupMetadata;
 
-Platform::Platform() : enableExtensionLoadingLogs(false) {}
+Platform::Platform()
+    : extensionsVersion(NewExtensionsVersion()),
+      enableExtensionLoadingLogs(false) {}
+
+Platform::Platform(const Platform& other)
+    : extensionsLoaded(other.extensionsLoaded),
+      lazyExtensions(other.lazyExtensions),
+      creationFunctionTable(other.creationFunctionTable),
+      instructionOrExpressionGroupMetadata(
+          other.instructionOrExpressionGroupMetadata),
+      extensionsVersion(other.extensionsVersion),
+      enableExtensionLoadingLogs(other.enableExtensionLoadingLogs) {}
+
+Platform& Platform::operator=(const Platform& other) {
+  if (this != &other) {
+    extensionsLoaded = other.extensionsLoaded;
+    lazyExtensions = other.lazyExtensions;
+    creationFunctionTable = other.creationFunctionTable;
+    instructionOrExpressionGroupMetadata =
+        other.instructionOrExpressionGroupMetadata;
+    extensionsVersion = other.extensionsVersion;
+    enableExtensionLoadingLogs = other.enableExtensionLoadingLogs;
+    metadataIndex = nullptr;  // The index is built again when needed.
+  }
+  return *this;
+}
 
 Platform::~Platform() {}
 
@@ -37,26 +73,128 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
   extensionsLoaded.push_back(extension);
+  metadataIndex.reset();
+  extensionsVersion = NewExtensionsVersion();
+  RegisterExtension(*extension);
 
+  return true;
+}
+
+void Platform::AddLazyExtension(
+    const gd::String& name,
+    std::function<std::shared_ptr<PlatformExtension>()> createExtension) {
+  if (IsExtensionLoaded(name)) RemoveExtension(name);
+
+  // Until it's declared, the extension is an empty extension with only a name,
+  // so that it keeps its position among the other extensions.
+  auto emptyExtension = std::make_shared<PlatformExtension>();
+  emptyExtension->SetExtensionInformation(name, "", "", "", "");
+  extensionsLoaded.push_back(emptyExtension);
+  lazyExtensions[name] = createExtension;
+  metadataIndex.reset();
+  extensionsVersion = NewExtensionsVersion();
+}
+
+void Platform::RegisterExtension(PlatformExtension& extension) const {
   // Load all creation functions for objects provided by the
   // extension.
-  vector<gd::String> objectsTypes = extension->GetExtensionObjectsTypes();
+  vector<gd::String> objectsTypes = extension.GetExtensionObjectsTypes();
   for (std::size_t i = 0; i < objectsTypes.size(); ++i) {
-    CreateFunPtr createFunPtr = extension->GetObjectCreationFunctionPtr(objectsTypes[i]);
+    CreateFunPtr createFunPtr = extension.GetObjectCreationFunctionPtr(objectsTypes[i]);
     if (createFunPtr != nullptr) {
       creationFunctionTable[objectsTypes[i]] = createFunPtr;
     }
   }
 
   for (const auto& it :
-       extension->GetAllInstructionOrExpressionGroupMetadata()) {
+       extension.GetAllInstructionOrExpressionGroupMetadata()) {
     instructionOrExpressionGroupMetadata[it.first] = it.second;
   }
+}
 
-  return true;
+void Platform::DeclareLazyExtension(const gd::String& name_) const {
+  // The name can be owned by the empty extension or the creation function,
+  // which are destroyed.
+  const gd::String name = name_;
+  auto lazyExtension = lazyExtensions.find(name);
+  if (lazyExtension == lazyExtensions.end()) return;
+
+  std::shared_ptr<PlatformExtension> extension = lazyExtension->second();
+  lazyExtensions.erase(lazyExtension);
+  if (!extension) return;
+
+  if (enableExtensionLoadingLogs)
+    std::cout << "Declaring " << name << "..." << std::endl;
+  if (extension->GetName() != name || extension->GetNameSpace().empty()) {
+    gd::LogWarning("The extension " + name +
+                   " was declared lazily but has another name or no "
+                   "namespace: it's declared as soon as a type outside of "
+                   "a namespace is searched.");
+  }
+
+  // The extension replaces the empty one, at the same position. This is not
+  // considered as a change of the extensions, as nothing of the extension
+  // could be found before.
+  std::size_t position = 0;
+  while (position < extensionsLoaded.size() &&
+         extensionsLoaded[position]->GetName() != name)
+    position++;
+  if (position == extensionsLoaded.size()) return;
+  extensionsLoaded[position] = extension;
+
+  // Extensions loaded after this one replace what it registers, like if all
+  // the extensions were declared in the loading order.
+  for (std::size_t i = position; i < extensionsLoaded.size(); ++i) {
+    RegisterExtension(*extensionsLoaded[i]);
+  }
+  // The index keeps the metadata of the first extension in the loading order,
+  // so it's built again.
+  metadataIndex.reset();
+}
+
+void Platform::DeclareLazyExtensionForType(const gd::String& type) const {
+  if (lazyExtensions.empty()) return;
+
+  size_t separatorPosition =
+      type.find(PlatformExtension::GetNamespaceSeparator());
+  if (separatorPosition == gd::String::npos) return;
+
+  DeclareLazyExtension(type.substr(0, separatorPosition));
+}
+
+bool Platform::DeclareLazyExtensionsBefore(
+    const gd::String& type, const gd::PlatformExtension* extension) const {
+  if (lazyExtensions.empty()) return false;
+
+  // A type in the namespace of an extension is provided by this extension
+  // (declared by GetMetadataIndex).
+  size_t separatorPosition =
+      type.find(PlatformExtension::GetNamespaceSeparator());
+  if (separatorPosition != gd::String::npos &&
+      IsExtensionLoaded(type.substr(0, separatorPosition)))
+    return false;
+
+  bool declared = false;
+  for (std::size_t i = 0; i < extensionsLoaded.size() &&
+                          extensionsLoaded[i].get() != extension;
+       ++i) {
+    const gd::String& name = extensionsLoaded[i]->GetName();
+    if (lazyExtensions.find(name) != lazyExtensions.end()) {
+      DeclareLazyExtension(name);
+      declared = true;
+    }
+  }
+
+  return declared;
+}
+
+void Platform::DeclareLazyExtensions() const {
+  DeclareLazyExtensionsBefore("", nullptr);
 }
 
 void Platform::RemoveExtension(const gd::String& name) {
+  lazyExtensions.erase(name);
+
   // Unload all creation/destruction functions for objects provided by the
   // extension
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
@@ -78,6 +216,8 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+  metadataIndex.reset();
+  extensionsVersion = NewExtensionsVersion();
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
@@ -90,6 +230,7 @@ bool Platform::IsExtensionLoaded(const gd::String& name) const {
 
 std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
     const gd::String& name) const {
+  DeclareLazyExtension(name);
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return extensionsLoaded[i];
   }
@@ -97,8 +238,47 @@ std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
   return std::shared_ptr<gd::PlatformExtension>();
 }
 
+const PlatformMetadataIndex& Platform::GetMetadataIndex() const {
+  DeclareLazyExtensions();
+  return GetMetadataIndex("");
+}
+
+const PlatformMetadataIndex& Platform::GetMetadataIndex(
+    const gd::String& type) const {
+  DeclareLazyExtensionForType(type);
+  if (!metadataIndex) {
+    metadataIndex = gd::make_unique<PlatformMetadataIndex>();
+    for (const auto& extension : extensionsLoaded) {
+      metadataIndex->AddExtension(*extension);
+    }
+  }
+
+  return *metadataIndex;
+}
+
+const InstructionOrExpressionGroupMetadata&
+Platform::GetInstructionOrExpressionGroupMetadata(
+    const gd::String& name) const {
+  auto it = instructionOrExpressionGroupMetadata.find(name);
+  if (it == instructionOrExpressionGroupMetadata.end() &&
+      !lazyExtensions.empty()) {
+    // Groups are not in the namespace of the extensions.
+    DeclareLazyExtensions();
+    it = instructionOrExpressionGroupMetadata.find(name);
+  }
+  if (it == instructionOrExpressionGroupMetadata.end())
+    return badInstructionOrExpressionGroupMetadata;
+
+  return it->second;
+}
+
 std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
     gd::String type) const {
+  DeclareLazyExtensionForType(type);
+  if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
+    // The type can be provided by an extension not declared yet.
+    DeclareLazyExtensionsBefore(type, nullptr);
+  }
   if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
     gd::LogWarning("Tried to create an object configuration with an unknown type: " + type
               + " for platform " + GetName() + "!");
@@ -118,13 +298,22 @@ std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
 #if defined(GD_IDE_ONLY)
 std::shared_ptr<gd::BaseEvent> Platform::CreateEvent(
     const gd::String& eventType) const {
-  for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
-    std::shared_ptr<gd::BaseEvent> event =
-        extensionsLoaded[i]->CreateEvent(eventType);
-    if (event != std::shared_ptr<gd::BaseEvent>()) return event;
-  }
+  DeclareLazyExtensionForType(eventType);
+  std::shared_ptr<gd::BaseEvent> event;
+  const gd::PlatformExtension* eventExtension = nullptr;
+  do {
+    event = std::shared_ptr<gd::BaseEvent>();
+    eventExtension = nullptr;
+    for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
+      event = extensionsLoaded[i]->CreateEvent(eventType);
+      if (event != std::shared_ptr<gd::BaseEvent>()) {
+        eventExtension = extensionsLoaded[i].get();
+        break;
+      }
+    }
+  } while (DeclareLazyExtensionsBefore(eventType, eventExtension));
 
-  return std::shared_ptr<gd::BaseEvent>();
+  return event;
 }
 #endif
 
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_PLATFORM_H
 #define GDCORE_PLATFORM_H
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -25,6 +26,7 @@ class BehaviorsSharedData;
 class PlatformExtension;
 class LayoutEditorCanvas;
 class ProjectExporter;
+class PlatformMetadataIndex;
 }  // namespace gd
 
 typedef std::function<std::unique_ptr<gd::ObjectConfiguration>()>
@@ -42,6 +44,8 @@ namespace gd {
 class GD_CORE_API Platform {
  public:
   Platform();
+  Platform(const Platform& other);
+  Platform& operator=(const Platform& other);
   virtual ~Platform();
 
   /**
@@ -96,8 +100,37 @@ class GD_CORE_API Platform {
    */
   virtual bool AddExtension(std::shared_ptr<PlatformExtension> extension);
 
+  /**
+   * \brief Add an extension to the platform, without declaring it: only its
+   * name is known until something it declares is used.
+   *
+   * \a createExtension is called to create and declare the extension the
+   * first time the extension is needed: when it's asked with GetExtension or
+   * GetAllPlatformExtensions, or when an object, behavior, effect, event,
+   * instruction or expression is searched with a type in its namespace (i.e:
+   * starting with the name of the extension followed by "::").
+   *
+   * This avoids declaring the metadata of all the extensions at startup.
+   *
+   * Types outside of the namespace of an extension (like the types of the
+   * builtin extensions) can be provided by any extension: the extensions not
+   * declared yet that are loaded before the one providing it (or all of them
+   * if none provides it) are declared before it's searched again (see
+   * DeclareLazyExtensionsBefore). This gives the same metadata as if all the
+   * extensions were declared in the loading order.
+   *
+   * \warning The extension must have a namespace (see
+   * gd::PlatformExtension::GetNameSpace) and should declare everything in
+   * this namespace, otherwise it's declared as soon as a type outside of a
+   * namespace is searched.
+   */
+  void AddLazyExtension(
+      const gd::String& name,
+      std::function<std::shared_ptr<PlatformExtension>()> createExtension);
+
   /**
    * \brief Return true if an extension with the specified name is loaded
+   * (even if it's not declared yet, see AddLazyExtension).
    */
   bool IsExtensionLoaded(const gd::String& name) const;
 
@@ -109,10 +142,14 @@ class GD_CORE_API Platform {
 
   /**
    * \brief Get all extensions loaded for the platform.
+   *
+   * Extensions added with AddLazyExtension are declared if they were not
+   * already.
    * @return Vector of Shared pointer containing all extensions
    */
   const std::vector<std::shared_ptr<gd::PlatformExtension>>&
   GetAllPlatformExtensions() const {
+    DeclareLazyExtensions();
     return extensionsLoaded;
   };
 
@@ -129,13 +166,50 @@ class GD_CORE_API Platform {
    * expressions.
    */
   const InstructionOrExpressionGroupMetadata& GetInstructionOrExpressionGroupMetadata(
-      const gd::String& name) const {
-    auto it = instructionOrExpressionGroupMetadata.find(name);
-    if (it == instructionOrExpressionGroupMetadata.end())
-      return badInstructionOrExpressionGroupMetadata;
+      const gd::String& name) const;
+
+  /**
+   * \brief Get the index of the metadata declared by the extensions, used by
+   * gd::MetadataProvider to find metadata by type.
+   *
+   * The index is built on first use and rebuilt after an extension is added
+   * or removed. Extensions added with AddLazyExtension are declared if they
+   * were not already.
+   */
+  const PlatformMetadataIndex& GetMetadataIndex() const;
+
+  /**
+   * \brief Get the index of the metadata declared by the extensions, to
+   * search for the given type.
+   *
+   * Only the extension added with AddLazyExtension providing the type, if any,
+   * is declared.
+   */
+  const PlatformMetadataIndex& GetMetadataIndex(const gd::String& type) const;
+
+  /**
+   * \brief Declare the extensions added with AddLazyExtension, not declared
+   * yet, that could provide the given type instead of \a extension (the
+   * extension found providing it, or nullptr if none was found).
+   *
+   * Nothing is declared for a type in the namespace of an extension. Otherwise,
+   * the extensions loaded before \a extension (or all of them if it's nullptr)
+   * are declared, as the first extension in the loading order provides a type.
+   *
+   * \return true if extensions were declared, so that the type must be searched
+   * again.
+   */
+  bool DeclareLazyExtensionsBefore(
+      const gd::String& type, const gd::PlatformExtension* extension) const;
 
-    return it->second;
-  }
+  /**
+   * \brief Return a number identifying the extensions loaded by the platform.
+   *
+   * It changes every time an extension is added or removed, and is different
+   * for each platform, so that it can be used to know if something computed
+   * from the metadata is still valid.
+   */
+  std::size_t GetExtensionsVersion() const { return extensionsVersion; }
   ///@}
 
   /** \name Factory method
@@ -166,13 +240,46 @@ class GD_CORE_API Platform {
   };
 
  private:
-  std::vector<std::shared_ptr<PlatformExtension>>
-      extensionsLoaded;  ///< Extensions of the platform
-  std::map<gd::String, CreateFunPtr>
+  /**
+   * \brief Register what the extension provides (creation functions for
+   * objects and groups metadata).
+   */
+  void RegisterExtension(PlatformExtension& extension) const;
+
+  /**
+   * \brief Declare the extension with the given name if it was added with
+   * AddLazyExtension and is not declared yet.
+   */
+  void DeclareLazyExtension(const gd::String& name) const;
+
+  /**
+   * \brief Declare the extension providing the given type (if the type is in
+   * the namespace of an extension added with AddLazyExtension).
+   */
+  void DeclareLazyExtensionForType(const gd::String& type) const;
+
+  /**
+   * \brief Declare all the extensions added with AddLazyExtension, in the
+   * loading order.
+   */
+  void DeclareLazyExtensions() const;
+
+  mutable std::vector<std::shared_ptr<PlatformExtension>>
+      extensionsLoaded;  ///< Extensions of the platform. Extensions not
+                         ///< declared yet are empty extensions, with only a
+                         ///< name.
+  mutable std::map<gd::String,
+                   std::function<std::shared_ptr<PlatformExtension>()>>
+      lazyExtensions;  ///< Functions creating the extensions not declared
+                       ///< yet, by name.
+  mutable std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
-  std::map<gd::String, InstructionOrExpressionGroupMetadata>
+  mutable std::map<gd::String, InstructionOrExpressionGroupMetadata>
       instructionOrExpressionGroupMetadata;
   static InstructionOrExpressionGroupMetadata badInstructionOrExpressionGroupMetadata;
+  mutable std::unique_ptr<PlatformMetadataIndex>
+      metadataIndex;  ///< Lazily built, reset when extensions are changed.
+  std::size_t extensionsVersion;  ///< Changed when extensions are changed.
   bool enableExtensionLoadingLogs;
 };
 
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_ABSTRACTFILESYSTEM
 #define GDCORE_ABSTRACTFILESYSTEM
+#include <cstdint>
 #include <vector>
 #include "GDCore/String.h"
 
@@ -123,6 +124,59 @@ class GD_CORE_API AbstractFileSystem {
   virtual std::vector<gd::String> ReadDir(const gd::String& path,
                                           const gd::String& extension = "") = 0;
 
+  /**
+   * \brief Get the size and the last modification time of a file, used to
+   * know if a file changed since it was last copied.
+   *
+   * The default implementation doesn't know anything about files, so they are
+   * always considered as changed.
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool GetFileStatus(const gd::String& file,
+                             std::uint64_t& size,
+                             std::int64_t& modificationTime) {
+    return false;
+  }
+
+  /**
+   * \brief Create `destination` as a file sharing the content of `file`
+   * (for example, a copy-on-write clone or a hard link), which is faster than
+   * copying it and doesn't use more disk space.
+   * If `destination` exists, it's replaced.
+   *
+   * The default implementation does nothing: CopyFile must be used instead.
+   * File systems implementing it must also implement RemoveFile, so that a
+   * linked file is never written through by CopyFile.
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool LinkFile(const gd::String& file,
+                        const gd::String& destination) {
+    return false;
+  }
+
+  /**
+   * \brief Remove a file. A file sharing its content with it (see LinkFile) is
+   * left untouched.
+   *
+   * The default implementation does nothing, which is fine for file systems
+   * not implementing LinkFile.
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool RemoveFile(const gd::String& file) { return false; }
+
+  /**
+   * \brief Return true if MkDir, DirExists, FileExists, DirNameFrom,
+   * MakeAbsolute, GetFileStatus, LinkFile, RemoveFile and CopyFile can be
+   * called from several threads at the same time.
+   *
+   * The default implementation returns false: files are then copied one after
+   * the other. Threads are never used with Emscripten, whatever is returned.
+   */
+  virtual bool IsThreadSafe() const { return false; }
+
  protected:
   AbstractFileSystem(){};
 };
@@ -21,9 +21,9 @@ bool BehaviorParametersFiller::DoVisitInstruction(gd::Instruction &instruction,
                                                   bool isCondition) {
   const auto &metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
       instruction.GetParameters(), metadata.GetParameters(),
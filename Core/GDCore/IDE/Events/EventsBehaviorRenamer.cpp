@@ -16,6 +16,7 @@
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/Events/IdentifierOccurrencesFinder.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/String.h"
@@ -101,11 +102,16 @@ class GD_CORE_API ExpressionBehaviorRenamer
 
 bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
                                                bool isCondition) {
+  if (!gd::IdentifierOccurrencesFinder::IsInInstruction(instruction,
+                                                        oldBehaviorName)) {
+    return false;
+  }
+
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
       instruction.GetParameters(), metadata.GetParameters(),
@@ -122,7 +128,7 @@ bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
             }
           }
         } else {
-          auto node = parameterValue.GetRootNode();
+          auto node = parameterValue.GetRootNodeForModification();
           if (node) {
             ExpressionBehaviorRenamer renamer(objectName,
                                               oldBehaviorName,
@@ -143,9 +143,9 @@ bool EventsContextAnalyzer::DoVisitInstruction(gd::Instruction& instruction,
                                                bool isCondition) {
   const gd::InstructionMetadata& instrInfo =
       isCondition ? MetadataProvider::GetConditionMetadata(
-                        platform, instruction.GetType())
-                  : MetadataProvider::GetActionMetadata(platform,
-                                                        instruction.GetType());
+                        platform, instruction.GetTypeSymbol())
+                  : MetadataProvider::GetActionMetadata(
+                        platform, instruction.GetTypeSymbol());
 
   gd::ParameterMetadataTools::IterateOverParameters(
       instruction.GetParameters(),
@@ -143,9 +143,9 @@ class GD_CORE_API IdentifierFinderEventWorker
       gd::String lastObjectParameter = "";
       const gd::InstructionMetadata& instrInfos =
           areConditions ? MetadataProvider::GetConditionMetadata(
-                              platform, instruction.GetType())
+                              platform, instruction.GetTypeSymbol())
                         : MetadataProvider::GetActionMetadata(
-                              platform, instruction.GetType());
+                              platform, instruction.GetTypeSymbol());
       for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
         // The parameter has the searched type...
       if (instrInfos.parameters.GetParameter(pNb).GetType() == "identifier"
@@ -178,9 +178,9 @@ bool EventsParameterReplacer::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
       instruction.GetParameters(), metadata.GetParameters(),
@@ -191,7 +191,7 @@ bool EventsParameterReplacer::DoVisitInstruction(gd::Instruction& instruction,
           parameterMetadata.GetValueTypeMetadata())) {
           return;
         }
-        auto node = parameterValue.GetRootNode();
+        auto node = parameterValue.GetRootNodeForModification();
         if (node) {
           ExpressionParameterReplacer renamer(
               platform, GetProjectScopedContainers(),
@@ -215,7 +215,7 @@ bool EventsParameterReplacer::DoVisitEventExpression(
           metadata.GetValueTypeMetadata())) {
     return false;
   }
-  auto node = expression.GetRootNode();
+  auto node = expression.GetRootNodeForModification();
   if (node) {
     ExpressionParameterReplacer renamer(
         platform, GetProjectScopedContainers(),
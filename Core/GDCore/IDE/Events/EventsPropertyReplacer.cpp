@@ -211,9 +211,9 @@ bool EventsPropertyReplacer::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
   bool shouldDeleteInstruction = false;
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
@@ -225,7 +225,7 @@ bool EventsPropertyReplacer::DoVisitInstruction(gd::Instruction& instruction,
           parameterMetadata.GetValueTypeMetadata())) {
           return;
         }
-        auto node = parameterValue.GetRootNode();
+        auto node = parameterValue.GetRootNodeForModification();
         if (node) {
           ExpressionPropertyReplacer renamer(
               platform, GetProjectScopedContainers(), targetPropertiesContainer,
@@ -251,7 +251,7 @@ bool EventsPropertyReplacer::DoVisitEventExpression(
           metadata.GetValueTypeMetadata())) {
     return false;
   }
-  auto node = expression.GetRootNode();
+  auto node = expression.GetRootNodeForModification();
   if (node) {
     ExpressionPropertyReplacer renamer(
         platform, GetProjectScopedContainers(), targetPropertiesContainer,
@@ -17,6 +17,7 @@
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/Events/IdentifierOccurrencesFinder.h"
 #include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/EventsBasedObject.h"
@@ -318,6 +319,10 @@ public:
 private:
   bool DoVisitInstruction(gd::Instruction &instruction,
                           bool isCondition) override {
+    if (!gd::IdentifierOccurrencesFinder::IsInInstruction(instruction,
+                                                          oldObjectName)) {
+      return false;
+    }
     if (&targetedObjectsContainer !=
         GetProjectScopedContainers()
             .GetObjectsContainersList()
@@ -326,9 +331,9 @@ private:
     }
     const auto &metadata = isCondition
                                ? gd::MetadataProvider::GetConditionMetadata(
-                                     platform, instruction.GetType())
+                                     platform, instruction.GetTypeSymbol())
                                : gd::MetadataProvider::GetActionMetadata(
-                                     platform, instruction.GetType());
+                                     platform, instruction.GetTypeSymbol());
 
     gd::ParameterMetadataTools::IterateOverParametersWithIndex(
         instruction.GetParameters(), metadata.GetParameters(),
@@ -339,7 +344,7 @@ private:
                   parameterMetadata.GetValueTypeMetadata())) {
             return;
           }
-          auto node = parameterValue.GetRootNode();
+          auto node = parameterValue.GetRootNodeForModification();
           if (node) {
             ExpressionObjectRenamer renamer(
                 platform, GetProjectScopedContainers(),
@@ -360,6 +365,10 @@ private:
 
   bool DoVisitEventExpression(gd::Expression &expression,
                               const gd::ParameterMetadata &metadata) override {
+    if (!gd::IdentifierOccurrencesFinder::IsInExpression(expression,
+                                                         oldObjectName)) {
+      return false;
+    }
     if (&targetedObjectsContainer !=
         GetProjectScopedContainers()
             .GetObjectsContainersList()
@@ -370,7 +379,7 @@ private:
             metadata.GetValueTypeMetadata())) {
       return false;
     }
-    auto node = expression.GetRootNode();
+    auto node = expression.GetRootNodeForModification();
     if (node) {
       ExpressionObjectRenamer renamer(platform, GetProjectScopedContainers(),
                                       metadata.GetValueTypeMetadata().GetName(),
@@ -402,6 +411,10 @@ void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
                                             const gd::ObjectsContainer &targetedObjectsContainer,
                                             gd::String oldName,
                                             gd::String newName) {
+  // Don't browse (and keep track of the context of) events not using the
+  // object.
+  if (!gd::IdentifierOccurrencesFinder::IsInEvents(events, oldName)) return;
+
   gd::EventsObjectReplacer eventsParameterReplacer(platform, targetedObjectsContainer, oldName, newName);
   eventsParameterReplacer.Launch(events, projectScopedContainers);
 }
@@ -416,7 +429,8 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
     bool deleteMe = false;
 
     const gd::InstructionMetadata& instrInfos =
-        MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
+        MetadataProvider::GetActionMetadata(platform,
+                                            actions[aId].GetTypeSymbol());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
       // Find object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType()) &&
@@ -473,8 +487,8 @@ bool EventsRefactorer::RemoveObjectInConditions(
     bool deleteMe = false;
 
     const gd::InstructionMetadata& instrInfos =
-        MetadataProvider::GetConditionMetadata(platform,
-                                               conditions[cId].GetType());
+        MetadataProvider::GetConditionMetadata(
+            platform, conditions[cId].GetTypeSymbol());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
       // Find object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType()) &&
@@ -905,9 +919,9 @@ bool EventsRefactorer::SearchStringInFormattedText(const gd::Platform& platform,
                                                    bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
   gd::String completeSentence =
       gd::InstructionSentenceFormatter::Get()->GetFullText(instruction,
                                                            metadata);
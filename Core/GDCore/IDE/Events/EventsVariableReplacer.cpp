@@ -442,9 +442,9 @@ bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
   bool shouldDeleteInstruction = false;
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
@@ -459,7 +459,7 @@ bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
             !gd::ParameterMetadata::IsExpression("string", type))
           return;  // Not an expression that can contain variables.
 
-        auto node = parameterValue.GetRootNode();
+        auto node = parameterValue.GetRootNodeForModification();
         if (node) {
           ExpressionVariableReplacer renamer(platform,
                                              GetProjectScopedContainers(),
@@ -493,7 +493,7 @@ bool EventsVariableReplacer::DoVisitEventExpression(
       !gd::ParameterMetadata::IsExpression("string", type))
     return false;  // Not an expression that can contain variables.
 
-  auto node = expression.GetRootNode();
+  auto node = expression.GetRootNodeForModification();
   if (node) {
     ExpressionVariableReplacer renamer(platform,
                                        GetProjectScopedContainers(),
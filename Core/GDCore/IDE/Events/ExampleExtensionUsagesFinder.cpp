@@ -70,9 +70,11 @@ bool ExampleExtensionUsagesFinder::DoVisitInstruction(
     gd::Instruction &instruction, bool isCondition) {
   auto metadata =
       isCondition ? gd::MetadataProvider::GetExtensionAndConditionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType())
+                        project.GetCurrentPlatform(),
+                        instruction.GetTypeSymbol())
                   : gd::MetadataProvider::GetExtensionAndActionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType());
+                        project.GetCurrentPlatform(),
+                        instruction.GetTypeSymbol());
   // Unused event-based objects or events-based behaviors may use object and
   // behavior instructions that should not be detected as extension usage.
   // The extension of actually used objects and behaviors will be detected on
@@ -16,6 +16,7 @@
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/ValueTypeMetadata.h"
+#include "GDCore/IDE/Events/ExpressionIdentifiersIndex.h"
 #include "GDCore/IDE/Events/ExpressionNodeLocationFinder.h"
 #include "GDCore/IDE/Events/ExpressionTypeFinder.h"
 #include "GDCore/IDE/Events/ExpressionVariableOwnerFinder.h"
@@ -372,6 +373,12 @@ class GD_CORE_API ExpressionCompletionFinder
   /**
    * \brief Given the expression, find the node at the specified location
    * and returns completions for it.
+   *
+   * \param identifiersIndex If specified, the index used to search the
+   * objects, variables, properties and parameters matching what is written,
+   * instead of going through all the containers.
+   *
+   * \see gd::ExpressionCompletionSession
    */
   static std::vector<ExpressionCompletionDescription>
   GetCompletionDescriptionsFor(
@@ -379,7 +386,8 @@ class GD_CORE_API ExpressionCompletionFinder
       const gd::ProjectScopedContainers& projectScopedContainers,
       const gd::String& rootType,
       gd::ExpressionNode& node,
-      size_t searchedPosition) {
+      size_t searchedPosition,
+      const gd::ExpressionIdentifiersIndex* identifiersIndex = nullptr) {
     gd::ExpressionNodeLocationFinder finder(searchedPosition);
     node.Visit(finder);
     gd::ExpressionNode* nodeAtLocation = finder.GetNode();
@@ -395,7 +403,8 @@ class GD_CORE_API ExpressionCompletionFinder
         projectScopedContainers,
         rootType,
         searchedPosition,
-        maybeParentNodeAtLocation);
+        maybeParentNodeAtLocation,
+        identifiersIndex);
     nodeAtLocation->Visit(autocompletionProvider);
     return autocompletionProvider.GetCompletionDescriptions();
   }
@@ -991,20 +1000,53 @@ class GD_CORE_API ExpressionCompletionFinder
       const gd::String& search,
       const gd::String& type,
       const ExpressionParserLocation& location) {
-    projectScopedContainers.GetObjectsContainersList()
-        .ForEachNameMatchingSearch(
-            search,
-            [&](const gd::String& name,
-                const gd::ObjectConfiguration* objectConfiguration) {
-              ExpressionCompletionDescription description(
-                  ExpressionCompletionDescription::Object,
-                  location.GetStartPosition(),
-                  location.GetEndPosition());
-              description.SetObjectConfiguration(objectConfiguration);
-              description.SetCompletion(name);
-              description.SetType(type);
-              completions.push_back(description);
-            });
+    auto addCompletion =
+        [&](const gd::String& name,
+            const gd::ObjectConfiguration* objectConfiguration) {
+          ExpressionCompletionDescription description(
+              ExpressionCompletionDescription::Object,
+              location.GetStartPosition(),
+              location.GetEndPosition());
+          description.SetObjectConfiguration(objectConfiguration);
+          description.SetCompletion(name);
+          description.SetType(type);
+          completions.push_back(description);
+        };
+
+    if (identifiersIndex) {
+      identifiersIndex->ForEachObjectOrGroupMatchingSearch(search,
+                                                           addCompletion);
+    } else {
+      projectScopedContainers.GetObjectsContainersList()
+          .ForEachNameMatchingSearch(search, addCompletion);
+    }
+  }
+
+  void ForEachIdentifierMatchingSearch(
+      const gd::String& search,
+      std::function<void(const gd::String& name,
+                         const ObjectConfiguration* objectConfiguration)>
+          objectCallback,
+      std::function<void(const gd::String& name, const gd::Variable& variable)>
+          variableCallback,
+      std::function<void(const gd::NamedPropertyDescriptor& property)>
+          propertyCallback,
+      std::function<void(const gd::ParameterMetadata& parameter)>
+          parameterCallback) {
+    if (identifiersIndex) {
+      identifiersIndex->ForEachIdentifierMatchingSearch(search,
+                                                        objectCallback,
+                                                        variableCallback,
+                                                        propertyCallback,
+                                                        parameterCallback);
+    } else {
+      projectScopedContainers.ForEachIdentifierMatchingSearch(
+          search,
+          objectCallback,
+          variableCallback,
+          propertyCallback,
+          parameterCallback);
+    }
   }
 
   void AddCompletionsForObjectsAndVariablesMatchingSearch(
@@ -1012,7 +1054,7 @@ class GD_CORE_API ExpressionCompletionFinder
       const gd::String& type,
       const ExpressionParserLocation& location,
       bool eagerlyCompleteIfExactMatch) {
-    projectScopedContainers.ForEachIdentifierMatchingSearch(
+    ForEachIdentifierMatchingSearch(
         search,
         [&](const gd::String& objectName,
             const ObjectConfiguration* objectConfiguration) {
@@ -1064,7 +1106,7 @@ class GD_CORE_API ExpressionCompletionFinder
       const gd::String& type,
       const ExpressionParserLocation& location,
       bool eagerlyCompleteIfExactMatch = false) {
-    projectScopedContainers.ForEachIdentifierMatchingSearch(
+    ForEachIdentifierMatchingSearch(
         search,
         [&](const gd::String &objectName,
             const ObjectConfiguration *objectConfiguration) {
@@ -1126,9 +1168,11 @@ class GD_CORE_API ExpressionCompletionFinder
       const gd::ProjectScopedContainers& projectScopedContainers_,
       const gd::String& rootType_,
       size_t searchedPosition_,
-      gd::ExpressionNode* maybeParentNodeAtLocation_)
+      gd::ExpressionNode* maybeParentNodeAtLocation_,
+      const gd::ExpressionIdentifiersIndex* identifiersIndex_)
       : searchedPosition(searchedPosition_),
         maybeParentNodeAtLocation(maybeParentNodeAtLocation_),
+        identifiersIndex(identifiersIndex_),
         platform(platform_),
         projectScopedContainers(projectScopedContainers_),
         rootType(rootType_),
@@ -1139,6 +1183,7 @@ class GD_CORE_API ExpressionCompletionFinder
   std::vector<ExpressionCompletionDescription> completions;
   size_t searchedPosition;
   gd::ExpressionNode* maybeParentNodeAtLocation;
+  const gd::ExpressionIdentifiersIndex* identifiersIndex;
 
   const gd::Platform& platform;
   const gd::ProjectScopedContainers& projectScopedContainers;
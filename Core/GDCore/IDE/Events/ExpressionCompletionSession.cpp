@@ -0,0 +1,49 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ExpressionCompletionSession.h"
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Tools/MakeUnique.h"
+
+namespace gd {
+
+ExpressionCompletionSession::ExpressionCompletionSession(
+    const gd::Platform& platform_,
+    const gd::ProjectScopedContainers& projectScopedContainers_,
+    const gd::String& rootType_)
+    : platform(platform_),
+      projectScopedContainers(projectScopedContainers_),
+      rootType(rootType_) {}
+
+std::vector<ExpressionCompletionDescription>
+ExpressionCompletionSession::GetCompletionDescriptionsFor(
+    const gd::String& expression_, size_t searchedPosition) {
+  if (!node || expression_ != expression) {
+    expression = expression_;
+    node = parser.ParseExpression(expression);
+  }
+  if (!node) return std::vector<ExpressionCompletionDescription>();
+
+  return gd::ExpressionCompletionFinder::GetCompletionDescriptionsFor(
+      platform,
+      projectScopedContainers,
+      rootType,
+      *node,
+      searchedPosition,
+      &GetIdentifiersIndex());
+}
+
+const gd::ExpressionIdentifiersIndex&
+ExpressionCompletionSession::GetIdentifiersIndex() {
+  if (!identifiersIndex || !identifiersIndex->IsUpToDate()) {
+    identifiersIndex =
+        gd::make_unique<gd::ExpressionIdentifiersIndex>(projectScopedContainers);
+  }
+
+  return *identifiersIndex;
+}
+
+}  // namespace gd
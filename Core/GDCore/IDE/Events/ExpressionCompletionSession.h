@@ -0,0 +1,80 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/IDE/Events/ExpressionCompletionFinder.h"
+#include "GDCore/IDE/Events/ExpressionIdentifiersIndex.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class ExpressionNode;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the completions of an expression being edited, keeping what
+ * can be reused from one edition to the next.
+ *
+ * The expression is parsed again only when it changed (moving the caret
+ * does not change it) and the names of the objects, variables, properties
+ * and parameters are searched in a gd::ExpressionIdentifiersIndex, built
+ * again only when they are no longer the indexed ones (i.e: after objects,
+ * groups, variables, properties or parameters are added, removed or renamed).
+ *
+ * \see gd::ExpressionCompletionFinder
+ */
+class GD_CORE_API ExpressionCompletionSession {
+ public:
+  ExpressionCompletionSession(
+      const gd::Platform& platform_,
+      const gd::ProjectScopedContainers& projectScopedContainers_,
+      const gd::String& rootType_);
+  virtual ~ExpressionCompletionSession(){};
+
+  /**
+   * \brief Return the completions for the expression, with the caret at the
+   * specified location.
+   */
+  std::vector<ExpressionCompletionDescription> GetCompletionDescriptionsFor(
+      const gd::String& expression, size_t searchedPosition);
+
+  /**
+   * \brief Return the parsed expression, as last given to
+   * GetCompletionDescriptionsFor.
+   */
+  gd::ExpressionNode* GetExpressionNode() { return node.get(); };
+
+  /**
+   * \brief Return the index of the names that can be completed, building it
+   * if it's not up to date.
+   */
+  const gd::ExpressionIdentifiersIndex& GetIdentifiersIndex();
+
+  /**
+   * \brief Build the index of the names again before the next completions.
+   */
+  void InvalidateIdentifiersIndex() { identifiersIndex.reset(); };
+
+ private:
+  const gd::Platform& platform;
+  const gd::ProjectScopedContainers projectScopedContainers;
+  const gd::String rootType;
+
+  gd::ExpressionParser2 parser;
+  gd::String expression;
+  std::unique_ptr<gd::ExpressionNode> node;
+
+  std::unique_ptr<gd::ExpressionIdentifiersIndex> identifiersIndex;
+};
+
+}  // namespace gd
@@ -0,0 +1,286 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ExpressionIdentifiersIndex.h"
+
+#include <algorithm>
+#include <set>
+
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Project/NamedPropertyDescriptor.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ParameterMetadataContainer.h"
+#include "GDCore/Project/Variable.h"
+
+namespace gd {
+
+ExpressionIdentifiersIndex::ExpressionIdentifiersIndex(
+    const gd::ProjectScopedContainers& projectScopedContainers_)
+    : projectScopedContainers(projectScopedContainers_) {
+  // Objects and groups are all indexed, even when hidden by another object or
+  // group with the same name. Only the first name is an identifier, like in
+  // gd::ProjectScopedContainers::ForEachIdentifierMatchingSearch.
+  std::set<gd::String> namesAlreadySeen;
+  ForEachNameOfContainers([&](NameKind kind,
+                              std::size_t containerIndex,
+                              std::size_t position,
+                              const gd::String& name) {
+    IndexedName indexedName;
+    indexedName.kind = kind;
+    indexedName.isIdentifier = namesAlreadySeen.insert(name).second;
+    indexedName.containerIndex = containerIndex;
+    indexedName.position = position;
+    indexedName.name = name;
+    indexedName.caseFoldedName = name.CaseFold().Raw();
+    names.push_back(std::move(indexedName));
+
+    // Only suffixes starting at the beginning of a character can match a
+    // search (UTF-8 continuation bytes are 10xxxxxx).
+    const std::string& caseFoldedName = names.back().caseFoldedName;
+    for (std::size_t i = 0; i < caseFoldedName.size(); ++i) {
+      if ((caseFoldedName[i] & 0xC0) == 0x80) continue;
+
+      Suffix suffix;
+      suffix.nameIndex = names.size() - 1;
+      suffix.position = i;
+      suffixes.push_back(suffix);
+    }
+    return true;
+  });
+
+  std::sort(suffixes.begin(),
+            suffixes.end(),
+            [this](const Suffix& suffix, const Suffix& otherSuffix) {
+              return names[suffix.nameIndex].caseFoldedName.compare(
+                         suffix.position,
+                         std::string::npos,
+                         names[otherSuffix.nameIndex].caseFoldedName,
+                         otherSuffix.position,
+                         std::string::npos) < 0;
+            });
+}
+
+void ExpressionIdentifiersIndex::ForEachNameOfContainers(
+    std::function<bool(NameKind kind,
+                       std::size_t containerIndex,
+                       std::size_t position,
+                       const gd::String& name)> fn) const {
+  const auto& objectsContainersList =
+      projectScopedContainers.GetObjectsContainersList();
+  for (std::size_t i = objectsContainersList.GetObjectsContainersCount();
+       i-- > 0;) {
+    const auto& objectsContainer = objectsContainersList.GetObjectsContainer(i);
+    for (std::size_t j = 0; j < objectsContainer.GetObjectsCount(); ++j) {
+      if (!fn(ObjectName, i, j, objectsContainer.GetObject(j).GetName()))
+        return;
+    }
+    const auto& groups = objectsContainer.GetObjectGroups();
+    for (std::size_t j = 0; j < groups.Count(); ++j) {
+      if (!fn(GroupName, i, j, groups.Get(j).GetName())) return;
+    }
+  }
+
+  const auto& variablesContainersList =
+      projectScopedContainers.GetVariablesContainersList();
+  for (std::size_t i = variablesContainersList.GetVariablesContainersCount();
+       i-- > 0;) {
+    const auto& variablesContainer =
+        variablesContainersList.GetVariablesContainer(i);
+    for (std::size_t j = 0; j < variablesContainer.Count(); ++j) {
+      if (!fn(VariableName, i, j, variablesContainer.GetNameAt(j))) return;
+    }
+  }
+
+  const auto& parametersVectorsList =
+      projectScopedContainers.GetParametersVectorsList();
+  for (std::size_t i = parametersVectorsList.size(); i-- > 0;) {
+    const auto& parameters = *parametersVectorsList[i];
+    for (std::size_t j = 0; j < parameters.GetParametersCount(); ++j) {
+      if (!fn(ParameterName, i, j, parameters.GetParameter(j).GetName()))
+        return;
+    }
+  }
+
+  const auto& propertiesContainersList =
+      projectScopedContainers.GetPropertiesContainersList();
+  for (std::size_t i = propertiesContainersList.GetPropertiesContainersCount();
+       i-- > 0;) {
+    const auto& properties = propertiesContainersList.GetPropertiesContainer(i);
+    for (std::size_t j = 0; j < properties.GetCount(); ++j) {
+      if (!fn(PropertyName, i, j, properties.Get(j).GetName())) return;
+    }
+  }
+}
+
+bool ExpressionIdentifiersIndex::IsUpToDate() const {
+  std::size_t nameIndex = 0;
+  bool upToDate = true;
+  ForEachNameOfContainers([&](NameKind kind,
+                              std::size_t containerIndex,
+                              std::size_t position,
+                              const gd::String& name) {
+    upToDate = nameIndex < names.size() && names[nameIndex].kind == kind &&
+               names[nameIndex].containerIndex == containerIndex &&
+               names[nameIndex].position == position &&
+               names[nameIndex].name == name;
+    nameIndex++;
+    return upToDate;
+  });
+
+  return upToDate && nameIndex == names.size();
+}
+
+const void* ExpressionIdentifiersIndex::GetElement(
+    const IndexedName& name) const {
+  if (name.kind == ObjectName || name.kind == GroupName) {
+    const auto& objectsContainersList =
+        projectScopedContainers.GetObjectsContainersList();
+    if (name.containerIndex >=
+        objectsContainersList.GetObjectsContainersCount())
+      return nullptr;
+
+    const auto& objectsContainer =
+        objectsContainersList.GetObjectsContainer(name.containerIndex);
+    if (name.kind == ObjectName) {
+      if (name.position >= objectsContainer.GetObjectsCount()) return nullptr;
+      const auto& object = objectsContainer.GetObject(name.position);
+      return object.GetName() == name.name ? &object.GetConfiguration()
+                                           : nullptr;
+    }
+
+    const auto& groups = objectsContainer.GetObjectGroups();
+    if (name.position >= groups.Count()) return nullptr;
+    const auto& group = groups.Get(name.position);
+    return group.GetName() == name.name ? &group : nullptr;
+  } else if (name.kind == VariableName) {
+    const auto& variablesContainersList =
+        projectScopedContainers.GetVariablesContainersList();
+    if (name.containerIndex >=
+        variablesContainersList.GetVariablesContainersCount())
+      return nullptr;
+
+    const auto& variablesContainer =
+        variablesContainersList.GetVariablesContainer(name.containerIndex);
+    if (name.position >= variablesContainer.Count()) return nullptr;
+    return variablesContainer.GetNameAt(name.position) == name.name
+               ? &variablesContainer.Get(name.position)
+               : nullptr;
+  } else if (name.kind == ParameterName) {
+    const auto& parametersVectorsList =
+        projectScopedContainers.GetParametersVectorsList();
+    if (name.containerIndex >= parametersVectorsList.size()) return nullptr;
+
+    const auto& parameters = *parametersVectorsList[name.containerIndex];
+    if (name.position >= parameters.GetParametersCount()) return nullptr;
+    const auto& parameter = parameters.GetParameter(name.position);
+    return parameter.GetName() == name.name ? &parameter : nullptr;
+  } else if (name.kind == PropertyName) {
+    const auto& propertiesContainersList =
+        projectScopedContainers.GetPropertiesContainersList();
+    if (name.containerIndex >=
+        propertiesContainersList.GetPropertiesContainersCount())
+      return nullptr;
+
+    const auto& properties =
+        propertiesContainersList.GetPropertiesContainer(name.containerIndex);
+    if (name.position >= properties.GetCount()) return nullptr;
+    const auto& property = properties.Get(name.position);
+    return property.GetName() == name.name ? &property : nullptr;
+  }
+
+  return nullptr;
+}
+
+void ExpressionIdentifiersIndex::ForEachNameMatchingSearch(
+    const gd::String& search,
+    std::function<void(const IndexedName& name)> fn) const {
+  const std::string caseFoldedSearch = search.CaseFold().Raw();
+  if (caseFoldedSearch.empty()) {
+    for (const auto& name : names) fn(name);
+    return;
+  }
+
+  auto it = std::lower_bound(
+      suffixes.begin(),
+      suffixes.end(),
+      caseFoldedSearch,
+      [this](const Suffix& suffix, const std::string& caseFoldedSearch) {
+        return names[suffix.nameIndex].caseFoldedName.compare(
+                   suffix.position, std::string::npos, caseFoldedSearch) < 0;
+      });
+
+  // The suffixes starting with the search are contiguous. A name can contain
+  // the search more than once, so names are deduplicated and put back in
+  // their order.
+  std::vector<std::uint32_t> matchingNameIndices;
+  for (; it != suffixes.end(); ++it) {
+    if (names[it->nameIndex].caseFoldedName.compare(
+            it->position, caseFoldedSearch.size(), caseFoldedSearch) != 0)
+      break;
+
+    matchingNameIndices.push_back(it->nameIndex);
+  }
+  std::sort(matchingNameIndices.begin(), matchingNameIndices.end());
+  matchingNameIndices.erase(
+      std::unique(matchingNameIndices.begin(), matchingNameIndices.end()),
+      matchingNameIndices.end());
+
+  for (std::uint32_t nameIndex : matchingNameIndices) fn(names[nameIndex]);
+}
+
+void ExpressionIdentifiersIndex::ForEachObjectOrGroupMatchingSearch(
+    const gd::String& search,
+    std::function<void(const gd::String& name,
+                       const gd::ObjectConfiguration* objectConfiguration)> fn)
+    const {
+  ForEachNameMatchingSearch(search, [&](const IndexedName& name) {
+    if (name.kind != ObjectName && name.kind != GroupName) return;
+
+    const void* element = GetElement(name);
+    if (!element) return;
+
+    fn(name.name,
+       name.kind == ObjectName
+           ? static_cast<const gd::ObjectConfiguration*>(element)
+           : nullptr);
+  });
+}
+
+void ExpressionIdentifiersIndex::ForEachIdentifierMatchingSearch(
+    const gd::String& search,
+    std::function<void(const gd::String& name,
+                       const gd::ObjectConfiguration* objectConfiguration)>
+        objectCallback,
+    std::function<void(const gd::String& name, const gd::Variable& variable)>
+        variableCallback,
+    std::function<void(const gd::NamedPropertyDescriptor& property)>
+        propertyCallback,
+    std::function<void(const gd::ParameterMetadata& parameter)>
+        parameterCallback) const {
+  ForEachNameMatchingSearch(search, [&](const IndexedName& name) {
+    if (!name.isIdentifier) return;
+
+    const void* element = GetElement(name);
+    if (!element) return;
+
+    if (name.kind == ObjectName) {
+      objectCallback(name.name,
+                     static_cast<const gd::ObjectConfiguration*>(element));
+    } else if (name.kind == GroupName) {
+      objectCallback(name.name, nullptr);
+    } else if (name.kind == VariableName) {
+      variableCallback(name.name, *static_cast<const gd::Variable*>(element));
+    } else if (name.kind == PropertyName) {
+      propertyCallback(
+          *static_cast<const gd::NamedPropertyDescriptor*>(element));
+    } else if (name.kind == ParameterName) {
+      parameterCallback(*static_cast<const gd::ParameterMetadata*>(element));
+    }
+  });
+}
+
+}  // namespace gd
@@ -0,0 +1,143 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class ObjectConfiguration;
+class Variable;
+class NamedPropertyDescriptor;
+class ParameterMetadata;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An index of the names of the objects, groups, variables, properties
+ * and parameters that can be written in an expression, to find the ones
+ * matching a search without going through all of them.
+ *
+ * The search is case insensitive and matches the names containing the
+ * searched text anywhere, like the `ForEach...MatchingSearch` methods of the
+ * containers. The case folded suffixes of the names are sorted, so that the
+ * names containing a text are found by a binary search of the suffixes
+ * starting with it. Names are given in the same order as the containers give
+ * them.
+ *
+ * Only the names and their positions in the containers are stored: the
+ * objects, variables, properties and parameters are found in the containers
+ * when a search is done. A name that is no longer at its position (because
+ * elements were added, removed or renamed since the index was built) is
+ * skipped: use IsUpToDate to know if the index must be built again.
+ *
+ * \see gd::ExpressionCompletionSession
+ */
+class GD_CORE_API ExpressionIdentifiersIndex {
+ public:
+  ExpressionIdentifiersIndex(
+      const gd::ProjectScopedContainers& projectScopedContainers);
+
+  /**
+   * \brief Return true if the containers still have the names that were
+   * indexed, at the same positions.
+   */
+  bool IsUpToDate() const;
+
+  /**
+   * \brief Call the callback for each object or group having a name matching
+   * the search, like gd::ObjectsContainersList::ForEachNameMatchingSearch.
+   */
+  void ForEachObjectOrGroupMatchingSearch(
+      const gd::String& search,
+      std::function<void(const gd::String& name,
+                         const gd::ObjectConfiguration* objectConfiguration)>
+          fn) const;
+
+  /**
+   * \brief Call the callbacks for each object, group, variable, parameter and
+   * property having a name matching the search, like
+   * gd::ProjectScopedContainers::ForEachIdentifierMatchingSearch.
+   */
+  void ForEachIdentifierMatchingSearch(
+      const gd::String& search,
+      std::function<void(const gd::String& name,
+                         const gd::ObjectConfiguration* objectConfiguration)>
+          objectCallback,
+      std::function<void(const gd::String& name, const gd::Variable& variable)>
+          variableCallback,
+      std::function<void(const gd::NamedPropertyDescriptor& property)>
+          propertyCallback,
+      std::function<void(const gd::ParameterMetadata& parameter)>
+          parameterCallback) const;
+
+  /**
+   * \brief Return the number of indexed names.
+   */
+  std::size_t GetNamesCount() const { return names.size(); }
+
+ private:
+  enum NameKind {
+    ObjectName,
+    GroupName,
+    VariableName,
+    PropertyName,
+    ParameterName
+  };
+
+  struct IndexedName {
+    NameKind kind;
+    /// False if the name is hidden by another identifier with the same name.
+    bool isIdentifier;
+    std::uint32_t containerIndex;  ///< In the list of containers of its kind.
+    std::uint32_t position;        ///< In its container.
+    gd::String name;
+    std::string caseFoldedName;
+  };
+
+  struct Suffix {
+    std::uint32_t nameIndex;
+    std::uint32_t position;
+  };
+
+  /**
+   * \brief Call the callback for each name of the containers, in the order
+   * used by gd::ProjectScopedContainers::ForEachIdentifierMatchingSearch.
+   * Iteration stops when the callback returns false.
+   */
+  void ForEachNameOfContainers(
+      std::function<bool(NameKind kind,
+                         std::size_t containerIndex,
+                         std::size_t position,
+                         const gd::String& name)> fn) const;
+
+  /**
+   * \brief Call the callback for each name matching the search,
+   * in the order of the names.
+   */
+  void ForEachNameMatchingSearch(
+      const gd::String& search,
+      std::function<void(const IndexedName& name)> fn) const;
+
+  /**
+   * \brief Return the object configuration, group, variable, property or
+   * parameter having the name, or nullptr if it's no longer in its container
+   * at the indexed position.
+   */
+  const void* GetElement(const IndexedName& name) const;
+
+  const gd::ProjectScopedContainers projectScopedContainers;
+  std::vector<IndexedName> names;
+  std::vector<Suffix> suffixes;  ///< Sorted by the text starting at position.
+};
+
+}  // namespace gd
@@ -140,9 +140,9 @@ bool ExpressionsParameterMover::DoVisitInstruction(gd::Instruction& instruction,
                                                    bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   for (std::size_t pNb = 0; pNb < metadata.parameters.GetParametersCount() &&
                             pNb < instruction.GetParametersCount();
@@ -150,7 +150,7 @@ bool ExpressionsParameterMover::DoVisitInstruction(gd::Instruction& instruction,
     const gd::String& type = metadata.parameters.GetParameter(pNb).GetType();
     const gd::Expression& expression = instruction.GetParameter(pNb);
 
-    auto node = expression.GetRootNode();
+    auto node = expression.GetRootNodeForModification();
     if (node) {
       ExpressionParameterMover mover(GetProjectScopedContainers(),
                                      behaviorType,
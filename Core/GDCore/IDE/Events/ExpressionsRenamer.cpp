@@ -15,6 +15,7 @@
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/Events/IdentifierOccurrencesFinder.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/String.h"
@@ -145,18 +146,23 @@ class GD_CORE_API ExpressionFunctionRenamer
 
 bool ExpressionsRenamer::DoVisitInstruction(gd::Instruction& instruction,
                                             bool isCondition) {
+  if (!gd::IdentifierOccurrencesFinder::IsInInstruction(instruction,
+                                                        oldFunctionName)) {
+    return false;
+  }
+
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   for (std::size_t pNb = 0; pNb < metadata.parameters.GetParametersCount() &&
                             pNb < instruction.GetParametersCount();
        ++pNb) {
     const gd::Expression& expression = instruction.GetParameter(pNb);
 
-    auto node = expression.GetRootNode();
+    auto node = expression.GetRootNodeForModification();
     if (node) {
       ExpressionFunctionRenamer renamer(GetProjectScopedContainers(),
                                         behaviorType,
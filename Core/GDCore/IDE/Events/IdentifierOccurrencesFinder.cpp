@@ -0,0 +1,65 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/IdentifierOccurrencesFinder.h"
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+
+namespace gd {
+
+bool IdentifierOccurrencesFinder::IsInEvents(const gd::EventsList& events,
+                                             const gd::String& identifier) {
+  IdentifierOccurrencesFinder finder(identifier);
+  finder.Launch(events);
+  return finder.hasFoundOccurrence;
+}
+
+bool IdentifierOccurrencesFinder::IsInInstruction(
+    const gd::Instruction& instruction, const gd::String& identifier) {
+  for (const gd::Expression& parameter : instruction.GetParameters()) {
+    if (IsInExpression(parameter, identifier)) return true;
+  }
+  return false;
+}
+
+bool IdentifierOccurrencesFinder::IsInExpression(
+    const gd::Expression& expression, const gd::String& identifier) {
+  const std::string& rawIdentifier = identifier.Raw();
+  // Names with quotes or backslashes are escaped in string literals, so they
+  // may not appear as is in the expression.
+  if (rawIdentifier.empty() ||
+      rawIdentifier.find_first_of("\"\\") != std::string::npos)
+    return true;
+
+  return expression.GetPlainString().Raw().find(rawIdentifier) !=
+         std::string::npos;
+}
+
+void IdentifierOccurrencesFinder::DoVisitEvent(const gd::BaseEvent& event) {
+  for (const auto& expressionAndMetadata :
+       event.GetAllExpressionsWithMetadata()) {
+    if (IsInExpression(*expressionAndMetadata.first, identifier)) {
+      hasFoundOccurrence = true;
+      StopAnyEventIteration();
+      return;
+    }
+  }
+}
+
+void IdentifierOccurrencesFinder::DoVisitInstruction(
+    const gd::Instruction& instruction, bool isCondition) {
+  if (IsInInstruction(instruction, identifier)) {
+    hasFoundOccurrence = true;
+    StopAnyEventIteration();
+  }
+}
+
+IdentifierOccurrencesFinder::~IdentifierOccurrencesFinder() {}
+
+}  // namespace gd
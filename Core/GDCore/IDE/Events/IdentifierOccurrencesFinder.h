@@ -0,0 +1,72 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class BaseEvent;
+class EventsList;
+class Expression;
+class Instruction;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Check if an identifier (the name of an object, a group, a behavior, a
+ * layer...) can be referred to by events, without parsing any expression.
+ *
+ * An identifier can only be used by an expression containing its name, so
+ * looking for the name in the plain strings of the parameters is enough to
+ * know which events, instructions and expressions don't use it. Renamers use
+ * this to skip them instead of parsing and printing back all the expressions
+ * of a project.
+ *
+ * This is a conservative check: an identifier is considered as used if its name
+ * appears anywhere in the text, even if it's not a reference to it.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API IdentifierOccurrencesFinder
+    : public ReadOnlyArbitraryEventsWorker {
+ public:
+  /**
+   * \brief Return true if the identifier appears in the events (including
+   * sub-events, sub-instructions and expressions of events).
+   */
+  static bool IsInEvents(const gd::EventsList& events,
+                         const gd::String& identifier);
+
+  /**
+   * \brief Return true if the identifier appears in the parameters of the
+   * instruction (sub-instructions are not checked).
+   */
+  static bool IsInInstruction(const gd::Instruction& instruction,
+                              const gd::String& identifier);
+
+  /**
+   * \brief Return true if the identifier appears in the expression.
+   */
+  static bool IsInExpression(const gd::Expression& expression,
+                             const gd::String& identifier);
+
+  virtual ~IdentifierOccurrencesFinder();
+
+ private:
+  IdentifierOccurrencesFinder(const gd::String& identifier_)
+      : identifier(identifier_), hasFoundOccurrence(false){};
+
+  void DoVisitEvent(const gd::BaseEvent& event) override;
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override;
+
+  const gd::String& identifier;
+  bool hasFoundOccurrence;
+};
+
+}  // namespace gd
@@ -6,19 +6,25 @@
 
 namespace gd {
 
-const int InstructionsCountEvaluator::ScanProject(gd::Project &project) {
-  InstructionsCountEvaluator worker(project);
-  gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(project,
-                                                                 worker);
-  return worker.instructionCount;
+const int InstructionsCountEvaluator::ScanProject(const gd::Project &project,
+                                                  std::size_t threadsCount) {
+  int instructionCount = 0;
+  gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensionsInParallel(
+      project, threadsCount,
+      []() { return std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>(
+                 new InstructionsCountEvaluator()); },
+      [&instructionCount](gd::ReadOnlyArbitraryEventsWorker &worker) {
+        instructionCount +=
+            static_cast<InstructionsCountEvaluator &>(worker).instructionCount;
+      });
+  return instructionCount;
 };
 
 // Instructions scanner
 
-bool InstructionsCountEvaluator::DoVisitInstruction(
-    gd::Instruction &instruction, bool isCondition) {
+void InstructionsCountEvaluator::DoVisitInstruction(
+    const gd::Instruction &instruction, bool isCondition) {
   instructionCount++;
-  return false;
 }
 
 } // namespace gd
@@ -27,21 +27,23 @@ namespace gd {
  * This is used by the examples repository to evaluate examples size.
  *
  */
-class GD_CORE_API InstructionsCountEvaluator : public ArbitraryEventsWorker {
+class GD_CORE_API InstructionsCountEvaluator
+    : public ReadOnlyArbitraryEventsWorker {
 public:
   /**
    * Return the number of instructions in the project excluding extensions.
+   *
+   * \param threadsCount The number of threads used to browse the events.
    */
-  static const int ScanProject(gd::Project &project);
+  static const int ScanProject(const gd::Project &project,
+                               std::size_t threadsCount = 1);
 
 private:
-  InstructionsCountEvaluator(gd::Project &project_)
-      : project(project_), instructionCount(0){};
-  gd::Project &project;
+  InstructionsCountEvaluator() : instructionCount(0){};
   int instructionCount;
 
   // Instructions Visitor
-  bool DoVisitInstruction(gd::Instruction &instruction,
+  void DoVisitInstruction(const gd::Instruction &instruction,
                           bool isCondition) override;
 };
 
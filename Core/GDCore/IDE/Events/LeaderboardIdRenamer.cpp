@@ -40,9 +40,11 @@ bool LeaderboardIdRenamer::DoVisitInstruction(gd::Instruction &instruction,
                                               bool isCondition) {
   const gd::InstructionMetadata &instrInfo =
       isCondition ? MetadataProvider::GetConditionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType())
+                        project.GetCurrentPlatform(),
+                        instruction.GetTypeSymbol())
                   : MetadataProvider::GetActionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType());
+                        project.GetCurrentPlatform(),
+                        instruction.GetTypeSymbol());
 
   for (int i = 0; i < instruction.GetParametersCount() &&
                   i < instrInfo.GetParametersCount();
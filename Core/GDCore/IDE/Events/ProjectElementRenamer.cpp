@@ -16,6 +16,7 @@
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/Events/IdentifierOccurrencesFinder.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/String.h"
@@ -139,11 +140,16 @@ private:
 
 bool ProjectElementRenamer::DoVisitInstruction(gd::Instruction &instruction,
                                                bool isCondition) {
+  if (!gd::IdentifierOccurrencesFinder::IsInInstruction(instruction,
+                                                        oldName)) {
+    return false;
+  }
+
   const auto &metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   gd::String lastLayerName;
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
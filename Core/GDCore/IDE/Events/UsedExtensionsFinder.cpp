@@ -114,9 +114,11 @@ bool UsedExtensionsFinder::DoVisitInstruction(gd::Instruction& instruction,
                                               bool isCondition) {
   auto metadata =
       isCondition ? gd::MetadataProvider::GetExtensionAndConditionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType())
+                        project.GetCurrentPlatform(),
+                        instruction.GetTypeSymbol())
                   : gd::MetadataProvider::GetExtensionAndActionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType());
+                        project.GetCurrentPlatform(),
+                        instruction.GetTypeSymbol());
   result.AddUsedExtension(metadata.GetExtension());
   for (auto&& includeFile : metadata.GetMetadata().GetIncludeFiles()) {
     result.AddUsedIncludeFiles(includeFile);
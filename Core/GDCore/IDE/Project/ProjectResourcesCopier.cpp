@@ -4,53 +4,194 @@
  * reserved. This project is released under the MIT License.
  */
 #include "ProjectResourcesCopier.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
 #include <map>
+#include <set>
+#if !defined(EMSCRIPTEN)
+#include <thread>
+#endif
 #include "GDCore/CommonTools.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/Project/ResourcesMergingHelper.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesContainer.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 #include "GDCore/IDE/ResourceExposer.h"
 
 using namespace std;
 
+namespace {
+
+/**
+ * \brief The size and modification time of a file.
+ */
+struct FileStatus {
+  std::uint64_t size = 0;
+  std::int64_t modificationTime = 0;
+
+  bool Read(gd::AbstractFileSystem& fs, const gd::String& file) {
+    return fs.GetFileStatus(file, size, modificationTime);
+  }
+
+  bool operator==(const FileStatus& other) const {
+    return size == other.size && modificationTime == other.modificationTime;
+  }
+};
+
+/**
+ * \brief A file copied by the resources copier, as recorded in the manifest.
+ */
+struct CopiedFile {
+  gd::String originalFile;
+  FileStatus originalStatus;
+  FileStatus destinationStatus;
+  bool recorded = false;
+};
+
+std::map<gd::String, CopiedFile> ReadManifest(
+    gd::AbstractFileSystem& fs, const gd::String& manifestFile) {
+  std::map<gd::String, CopiedFile> copiedFiles;
+  if (!fs.FileExists(manifestFile)) return copiedFiles;
+
+  gd::SerializerElement manifest =
+      gd::Serializer::FromJSON(fs.ReadFile(manifestFile));
+  gd::SerializerElement& filesElement = manifest.GetChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  for (std::size_t i = 0; i < filesElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& fileElement = filesElement.GetChild(i);
+    CopiedFile& copiedFile =
+        copiedFiles[fileElement.GetStringAttribute("destination")];
+    copiedFile.originalFile = fileElement.GetStringAttribute("original");
+    copiedFile.originalStatus.size =
+        fileElement.GetStringAttribute("originalSize").To<std::uint64_t>();
+    copiedFile.originalStatus.modificationTime =
+        fileElement.GetStringAttribute("originalModificationTime")
+            .To<std::int64_t>();
+    copiedFile.destinationStatus.size =
+        fileElement.GetStringAttribute("size").To<std::uint64_t>();
+    copiedFile.destinationStatus.modificationTime =
+        fileElement.GetStringAttribute("modificationTime").To<std::int64_t>();
+    copiedFile.recorded = true;
+  }
+
+  return copiedFiles;
+}
+
+void WriteManifest(
+    gd::AbstractFileSystem& fs,
+    const gd::String& manifestFile,
+    const std::vector<std::pair<gd::String, gd::String>>& files,
+    const std::vector<CopiedFile>& copiedFiles) {
+  gd::SerializerElement manifest;
+  gd::SerializerElement& filesElement = manifest.AddChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  for (std::size_t i = 0; i < files.size(); ++i) {
+    const CopiedFile& copiedFile = copiedFiles[i];
+    if (!copiedFile.recorded) continue;
+
+    // Sizes and times are stored as strings as they may not fit in a double.
+    gd::SerializerElement& fileElement = filesElement.AddChild("file");
+    fileElement.SetAttribute("destination", files[i].second);
+    fileElement.SetAttribute("original", copiedFile.originalFile);
+    fileElement.SetAttribute("originalSize",
+                             gd::String::From(copiedFile.originalStatus.size));
+    fileElement.SetAttribute(
+        "originalModificationTime",
+        gd::String::From(copiedFile.originalStatus.modificationTime));
+    fileElement.SetAttribute(
+        "size", gd::String::From(copiedFile.destinationStatus.size));
+    fileElement.SetAttribute(
+        "modificationTime",
+        gd::String::From(copiedFile.destinationStatus.modificationTime));
+  }
+
+  if (!fs.WriteToFile(manifestFile, gd::Serializer::ToJSON(manifest))) {
+    gd::LogWarning(_("Unable to write \"") + manifestFile + _("\"."));
+  }
+}
+
+}  // namespace
+
 namespace gd {
 
+const gd::String& ProjectResourcesCopier::GetManifestFilename() {
+  static const gd::String manifestFilename = ".gdresourcesmanifest.json";
+  return manifestFilename;
+}
+
 bool ProjectResourcesCopier::CopyAllResourcesTo(
     gd::Project& originalProject,
     AbstractFileSystem& fs,
     gd::String destinationDirectory,
     bool updateOriginalProject,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    bool skipUnchangedFiles,
+    bool linkFiles) {
   if (updateOriginalProject) {
+    gd::ResourcesMergingHelper resourcesMergingHelper(
+        originalProject.GetResourcesManager(), fs);
     gd::ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
-        originalProject, fs, destinationDirectory, preserveAbsoluteFilenames,
-        preserveDirectoryStructure);
+        originalProject, resourcesMergingHelper, fs, destinationDirectory,
+        preserveAbsoluteFilenames, preserveDirectoryStructure,
+        skipUnchangedFiles, linkFiles);
   } else {
-    gd::Project clonedProject = originalProject;
-    gd::ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
-        clonedProject, fs, destinationDirectory, preserveAbsoluteFilenames,
-        preserveDirectoryStructure);
+    // Only the resources are copied: the project itself is left untouched.
+    gd::ResourcesContainer resourcesContainer =
+        originalProject.GetResourcesManager();
+    std::map<gd::String, gd::String> directFileReferencesNewFilename;
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        originalProject, resourcesContainer, directFileReferencesNewFilename,
+        fs, destinationDirectory, preserveAbsoluteFilenames,
+        preserveDirectoryStructure, skipUnchangedFiles, linkFiles);
   }
   return true;
 }
 
+bool ProjectResourcesCopier::CopyAllResourcesTo(
+    gd::Project& project,
+    gd::ResourcesContainer& resourcesContainer,
+    std::map<gd::String, gd::String>& directFileReferencesNewFilename,
+    AbstractFileSystem& fs,
+    gd::String destinationDirectory,
+    bool preserveAbsoluteFilenames,
+    bool preserveDirectoryStructure,
+    bool skipUnchangedFiles,
+    bool linkFiles) {
+  gd::ResourcesMergingHelper resourcesMergingHelper(resourcesContainer, fs);
+  resourcesMergingHelper.KeepDirectFileReferences();
+  bool result =
+      gd::ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
+          project, resourcesMergingHelper, fs, destinationDirectory,
+          preserveAbsoluteFilenames, preserveDirectoryStructure,
+          skipUnchangedFiles, linkFiles);
+
+  directFileReferencesNewFilename =
+      resourcesMergingHelper.GetDirectFileReferencesNewFilename();
+  return result;
+}
+
 bool ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
     gd::Project& project,
+    gd::ResourcesMergingHelper& resourcesMergingHelper,
     AbstractFileSystem& fs,
     gd::String destinationDirectory,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    bool skipUnchangedFiles,
+    bool linkFiles) {
 
   auto projectDirectory = fs.DirNameFrom(project.GetProjectFile());
   std::cout << "Copying all resources from " << projectDirectory << " to "
             << destinationDirectory << "..." << std::endl;
 
   // Get the resources to be copied
-  gd::ResourcesMergingHelper resourcesMergingHelper(
-      project.GetResourcesManager(), fs);
   resourcesMergingHelper.SetBaseDirectory(projectDirectory);
   resourcesMergingHelper.PreserveDirectoriesStructure(
       preserveDirectoryStructure);
@@ -61,6 +202,7 @@ bool ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
   // Copy resources
   map<gd::String, gd::String>& resourcesNewFilename =
       resourcesMergingHelper.GetAllResourcesOldAndNewFilename();
+  std::vector<std::pair<gd::String, gd::String>> filesToCopy;
   for (map<gd::String, gd::String>::const_iterator it =
            resourcesNewFilename.begin();
        it != resourcesNewFilename.end();
@@ -70,16 +212,123 @@ bool ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
       gd::String destinationFile = it->second;
       fs.MakeAbsolute(destinationFile, destinationDirectory);
 
-      // Be sure the directory exists
-      gd::String dir = fs.DirNameFrom(destinationFile);
-      if (!fs.DirExists(dir)) fs.MkDir(dir);
+      filesToCopy.push_back(std::make_pair(it->first, destinationFile));
+    }
+  }
+
+  return CopyFiles(fs, filesToCopy, destinationDirectory, skipUnchangedFiles,
+                   linkFiles);
+}
+
+bool ProjectResourcesCopier::CopyFiles(
+    gd::AbstractFileSystem& fs,
+    const std::vector<std::pair<gd::String, gd::String>>& filesToCopy,
+    const gd::String& destinationDirectory,
+    bool skipUnchangedFiles,
+    bool linkFiles) {
+  gd::String manifestFile = GetManifestFilename();
+  fs.MakeAbsolute(manifestFile, destinationDirectory);
+  std::map<gd::String, CopiedFile> previouslyCopiedFiles;
+  if (skipUnchangedFiles)
+    previouslyCopiedFiles = ReadManifest(fs, manifestFile);
+
+  // Be sure the directories exist, checking each of them only once.
+  std::set<gd::String> directories;
+  for (const auto& fileToCopy : filesToCopy) {
+    directories.insert(fs.DirNameFrom(fileToCopy.second));
+  }
+  for (const gd::String& directory : directories) {
+    if (!fs.DirExists(directory)) fs.MkDir(directory);
+  }
+
+  // Only the lookups in previouslyCopiedFiles and the writes to different
+  // elements of these vectors are done by the threads.
+  std::vector<CopiedFile> copiedFiles(filesToCopy.size());
+  std::vector<char> succeeded(filesToCopy.size(), false);
+  auto copyFile = [&](std::size_t i) {
+    const gd::String& originalFile = filesToCopy[i].first;
+    const gd::String& destinationFile = filesToCopy[i].second;
+    CopiedFile& copiedFile = copiedFiles[i];
+    copiedFile.originalFile = originalFile;
 
-      // We can now copy the file
-      if (!fs.CopyFile(it->first, destinationFile)) {
-        gd::LogWarning(_("Unable to copy \"") + it->first + _("\" to \"") +
-                       destinationFile + _("\"."));
+    if (skipUnchangedFiles &&
+        copiedFile.originalStatus.Read(fs, originalFile)) {
+      auto previouslyCopiedFile = previouslyCopiedFiles.find(destinationFile);
+      if (previouslyCopiedFile != previouslyCopiedFiles.end() &&
+          previouslyCopiedFile->second.originalFile == originalFile &&
+          previouslyCopiedFile->second.originalStatus ==
+              copiedFile.originalStatus &&
+          copiedFile.destinationStatus.Read(fs, destinationFile) &&
+          previouslyCopiedFile->second.destinationStatus ==
+              copiedFile.destinationStatus) {
+        copiedFile.recorded = true;
+        succeeded[i] = true;
+        return;
       }
+
+      // The file is copied from now on: only record it if it's known how it
+      // was before the copy.
+      copiedFile.recorded = true;
+    }
+
+    succeeded[i] = linkFiles && fs.LinkFile(originalFile, destinationFile);
+    if (!succeeded[i]) {
+      // The destination can be a link to the original file, made by a
+      // previous copy: remove it so that the original is not written to.
+      if (originalFile != destinationFile) fs.RemoveFile(destinationFile);
+      succeeded[i] = fs.CopyFile(originalFile, destinationFile);
+    }
+    copiedFile.recorded =
+        copiedFile.recorded && succeeded[i] &&
+        copiedFile.destinationStatus.Read(fs, destinationFile);
+  };
+
+  std::size_t threadsCount = 1;
+#if !defined(EMSCRIPTEN)
+  // Copying files is mostly waiting for the disk, so use a few threads even
+  // if there are not as many cores.
+  if (fs.IsThreadSafe()) {
+    threadsCount = std::min<std::size_t>(
+        std::max(4u, std::thread::hardware_concurrency()), filesToCopy.size());
+  }
+  if (threadsCount > 1) {
+    std::atomic<std::size_t> nextIndex(0);
+    std::vector<std::exception_ptr> exceptions(threadsCount);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < threadsCount; ++t) {
+      threads.emplace_back([&filesToCopy, &copyFile, &nextIndex, &exceptions,
+                            t]() {
+        try {
+          for (std::size_t i = nextIndex++; i < filesToCopy.size();
+               i = nextIndex++) {
+            copyFile(i);
+          }
+        } catch (...) {
+          exceptions[t] = std::current_exception();
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+    for (auto& exception : exceptions) {
+      if (exception) std::rethrow_exception(exception);
     }
+  } else
+#endif
+  {
+    for (std::size_t i = 0; i < filesToCopy.size(); ++i) {
+      copyFile(i);
+    }
+  }
+
+  for (std::size_t i = 0; i < filesToCopy.size(); ++i) {
+    if (!succeeded[i]) {
+      gd::LogWarning(_("Unable to copy \"") + filesToCopy[i].first +
+                     _("\" to \"") + filesToCopy[i].second + _("\"."));
+    }
+  }
+
+  if (skipUnchangedFiles) {
+    WriteManifest(fs, manifestFile, filesToCopy, copiedFiles);
   }
 
   return true;
@@ -5,13 +5,18 @@
  */
 #pragma once
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "GDCore/String.h"
 
 namespace gd {
 class Project;
+class ResourcesContainer;
+class ResourcesMergingHelper;
 class AbstractFileSystem;
 }  // namespace gd
-
 namespace gd {
 
 /**
@@ -40,6 +45,27 @@ class GD_CORE_API ProjectResourcesCopier {
    * of the resources will be preserved when copying. Otherwise, everything will
    * be send in the destinationDirectory.
    *
+   * \param skipUnchangedFiles If set to true, the files that were already
+   * copied by a previous call and did not change since (same size and
+   * modification time, both for the original and the copied file) are not
+   * copied again. The copied files are recorded in a manifest, stored in the
+   * destination directory (see `GetManifestFilename`). This is only possible
+   * if the file system implements `GetFileStatus`.
+   *
+   * \param linkFiles If set to true, the destination files are created by
+   * sharing the content of the original files (see
+   * `gd::AbstractFileSystem::LinkFile`), if the file system supports it.
+   * Otherwise, they are copied. Only use this if the destination files are not
+   * modified afterwards.
+   *
+   * \note Files are copied concurrently if the file system is thread-safe
+   * (see `gd::AbstractFileSystem::IsThreadSafe`).
+   *
+   * \note The file systems implemented in JavaScript (`AbstractFileSystemJS`,
+   * used by the IDE) implement neither `GetFileStatus` nor `LinkFile`, and
+   * threads are not used with Emscripten: there, `skipUnchangedFiles` and
+   * `linkFiles` have no effect and files are copied one after the other.
+   *
    * \return true if no error happened
    */
   static bool CopyAllResourcesTo(gd::Project& project,
@@ -47,13 +73,65 @@ class GD_CORE_API ProjectResourcesCopier {
                                  gd::String destinationDirectory,
                                  bool updateOriginalProject,
                                  bool preserveAbsoluteFilenames = true,
-                                 bool preserveDirectoryStructure = true);
+                                 bool preserveDirectoryStructure = true,
+                                 bool skipUnchangedFiles = false,
+                                 bool linkFiles = false);
+
+  /**
+   * \brief Copy all resources files of a project to the specified
+   * `destinationDirectory`, without modifying nor copying the project: the new
+   * filenames are set to the resources of `resourcesContainer` instead (usually
+   * a copy of the project resources).
+   *
+   * \param project The project to be used
+   * \param resourcesContainer The resources to be updated with the new
+   * filenames.
+   * \param directFileReferencesNewFilename Filled with the new filenames of the
+   * files referred directly by objects and events (instead of with a
+   * resource), by their original reference.
+   * \param fs The abstract file system to be used
+   * \param destinationDirectory The directory where resources must be copied to
+   * \param preserveAbsoluteFilenames See the other overload.
+   * \param preserveDirectoryStructure See the other overload.
+   * \param skipUnchangedFiles See the other overload.
+   * \param linkFiles See the other overload.
+   *
+   * \return true if no error happened
+   */
+  static bool CopyAllResourcesTo(
+      gd::Project& project,
+      gd::ResourcesContainer& resourcesContainer,
+      std::map<gd::String, gd::String>& directFileReferencesNewFilename,
+      gd::AbstractFileSystem& fs,
+      gd::String destinationDirectory,
+      bool preserveAbsoluteFilenames = true,
+      bool preserveDirectoryStructure = true,
+      bool skipUnchangedFiles = false,
+      bool linkFiles = false);
+
+  /**
+   * \brief Return the name of the file, in the destination directory, where
+   * the copied files are recorded when unchanged files are skipped.
+   */
+  static const gd::String& GetManifestFilename();
 
 private:
   static bool AdaptFilePathsAndCopyAllResourcesTo(
-      gd::Project &project, gd::AbstractFileSystem &fs,
-      gd::String destinationDirectory, bool preserveAbsoluteFilenames = true,
-      bool preserveDirectoryStructure = true);
+      gd::Project &project, gd::ResourcesMergingHelper &resourcesMergingHelper,
+      gd::AbstractFileSystem &fs, gd::String destinationDirectory,
+      bool preserveAbsoluteFilenames, bool preserveDirectoryStructure,
+      bool skipUnchangedFiles, bool linkFiles);
+
+  /**
+   * \brief Copy the files, given by their absolute original filename and
+   * their absolute destination filename.
+   */
+  static bool CopyFiles(
+      gd::AbstractFileSystem &fs,
+      const std::vector<std::pair<gd::String, gd::String>> &filesToCopy,
+      const gd::String &destinationDirectory,
+      bool skipUnchangedFiles,
+      bool linkFiles);
 };
 
 }  // namespace gd
@@ -69,6 +69,30 @@ void ResourcesMergingHelper::ExposeFile(gd::String& resourceFilename) {
   }
 }
 
+void ResourcesMergingHelper::ExposeAudio(gd::String& audioName) {
+  if (!keepDirectFileReferences) {
+    ArbitraryResourceWorker::ExposeAudio(audioName);
+    return;
+  }
+
+  gd::String newAudioName = audioName;
+  ArbitraryResourceWorker::ExposeAudio(newAudioName);
+  if (newAudioName != audioName)
+    directFileReferencesNewFilename[audioName] = newAudioName;
+}
+
+void ResourcesMergingHelper::ExposeFont(gd::String& fontName) {
+  if (!keepDirectFileReferences) {
+    ArbitraryResourceWorker::ExposeFont(fontName);
+    return;
+  }
+
+  gd::String newFontName = fontName;
+  ArbitraryResourceWorker::ExposeFont(newFontName);
+  if (newFontName != fontName)
+    directFileReferencesNewFilename[fontName] = newFontName;
+}
+
 void ResourcesMergingHelper::SetNewFilename(gd::String oldFilename,
                                             gd::String newFilename) {
   if (newFilenames.find(oldFilename) != newFilenames.end()) return;
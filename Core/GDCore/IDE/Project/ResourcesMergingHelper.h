@@ -75,15 +75,39 @@ public:
     return newFilenames;
   };
 
+  /**
+   * \brief Set if the files referred directly by objects and events (instead
+   * of with a resource, for compatibility with older projects) must be left
+   * unchanged.
+   *
+   * This allows to export a project without modifying it: only the resources
+   * container given to the helper is updated. The new filenames of these files
+   * can be found with GetDirectFileReferencesNewFilename.
+   */
+  void KeepDirectFileReferences(bool keepDirectFileReferences_ = true) {
+    keepDirectFileReferences = keepDirectFileReferences_;
+  };
+
+  /**
+   * \brief Return a map containing, for the files referred directly by
+   * objects and events which were kept unchanged, the new filename by the
+   * original file reference.
+   *
+   * \see KeepDirectFileReferences
+   */
+  std::map<gd::String, gd::String>& GetDirectFileReferencesNewFilename() {
+    return directFileReferencesNewFilename;
+  };
   /**
    * Resources merging helper collects all resources filenames and update these
    * filenames.
    */
   void ExposeFile(gd::String& resource) override;
 
+  void ExposeAudio(gd::String& audioName) override;
+  void ExposeFont(gd::String& fontName) override;
  protected:
   void SetNewFilename(gd::String oldFilename, gd::String newFilename);
-
   /**
    * Original file names that can be accessed by their new name.
    */
@@ -106,6 +130,16 @@ public:
    * any resource.
    */
   bool shouldUseOriginalAbsoluteFilenames = false;
+  /**
+   * Set to true if the files referred directly by objects and events must be
+   * left unchanged.
+   */
+  bool keepDirectFileReferences = false;
+  /**
+   * New file names of the files referred directly by objects and events, by
+   * their original reference.
+   */
+  std::map<gd::String, gd::String> directFileReferencesNewFilename;
   gd::AbstractFileSystem&
       fs;  ///< The gd::AbstractFileSystem used to manipulate files.
 };
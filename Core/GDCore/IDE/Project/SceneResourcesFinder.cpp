@@ -14,7 +14,12 @@
 namespace gd {
 
 std::set<gd::String> SceneResourcesFinder::FindProjectResources(gd::Project &project) {
-  gd::SceneResourcesFinder resourceWorker(project.GetResourcesManager());
+  return FindProjectResources(project, project.GetResourcesManager());
+}
+
+std::set<gd::String> SceneResourcesFinder::FindProjectResources(gd::Project &project,
+    gd::ResourcesContainer &resourcesContainer) {
+  gd::SceneResourcesFinder resourceWorker(resourcesContainer);
 
   gd::ResourceExposer::ExposeProjectResources(project, resourceWorker);
   return resourceWorker.resourceNames;
@@ -22,7 +27,12 @@ std::set<gd::String> SceneResourcesFinder::FindProjectResources(gd::Project &pro
 
 std::set<gd::String> SceneResourcesFinder::FindSceneResources(gd::Project &project,
     gd::Layout &layout) {
-  gd::SceneResourcesFinder resourceWorker(project.GetResourcesManager());
+  return FindSceneResources(project, layout, project.GetResourcesManager());
+}
+
+std::set<gd::String> SceneResourcesFinder::FindSceneResources(gd::Project &project,
+    gd::Layout &layout, gd::ResourcesContainer &resourcesContainer) {
+  gd::SceneResourcesFinder resourceWorker(resourcesContainer);
 
   gd::ResourceExposer::ExposeLayoutResources(project, layout, resourceWorker);
   return resourceWorker.resourceNames;
@@ -30,8 +40,13 @@ std::set<gd::String> SceneResourcesFinder::FindSceneResources(gd::Project &proje
 
 std::set<gd::String> SceneResourcesFinder::FindEventsBasedObjectVariantResources(gd::Project &project,
     gd::EventsBasedObjectVariant &variant) {
-  gd::SceneResourcesFinder resourceWorker(project.GetResourcesManager());
+  return FindEventsBasedObjectVariantResources(project, variant,
+                                               project.GetResourcesManager());
+}
 
+std::set<gd::String> SceneResourcesFinder::FindEventsBasedObjectVariantResources(gd::Project &project,
+    gd::EventsBasedObjectVariant &variant, gd::ResourcesContainer &resourcesContainer) {
+  gd::SceneResourcesFinder resourceWorker(resourcesContainer);
   gd::ResourceExposer::ExposeEventsBasedObjectVariantResources(project, variant, resourceWorker);
   return resourceWorker.resourceNames;
 }
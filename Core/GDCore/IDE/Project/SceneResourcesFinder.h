@@ -49,6 +49,30 @@ public:
   FindEventsBasedObjectVariantResources(gd::Project &project,
                                         gd::EventsBasedObjectVariant &variant);
 
+  /**
+   * @brief Find resource usages in a given scene, among the given resources
+   * instead of the ones of the project (for instance, the resources of a
+   * project being exported).
+   */
+  static std::set<gd::String>
+  FindSceneResources(gd::Project &project, gd::Layout &layout,
+                     gd::ResourcesContainer &resourcesContainer);
+
+  /**
+   * @brief Find resource that are used globally in the project, among the
+   * given resources instead of the ones of the project.
+   */
+  static std::set<gd::String>
+  FindProjectResources(gd::Project &project,
+                       gd::ResourcesContainer &resourcesContainer);
+
+  /**
+   * @brief Find resource usages in a given events-based object variant, among
+   * the given resources instead of the ones of the project.
+   */
+  static std::set<gd::String> FindEventsBasedObjectVariantResources(
+      gd::Project &project, gd::EventsBasedObjectVariant &variant,
+      gd::ResourcesContainer &resourcesContainer);
   virtual ~SceneResourcesFinder(){};
 
 private:
@@ -5,6 +5,14 @@
  */
 #include "ProjectBrowserHelper.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <vector>
+#if !defined(EMSCRIPTEN)
+#include <thread>
+#endif
+
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/IDE/EventsFunctionTools.h"
 #include "GDCore/IDE/Project/ArbitraryEventBasedBehaviorsWorker.h"
@@ -14,6 +22,7 @@
 #include "GDCore/Project/EventsBasedBehavior.h"
 #include "GDCore/Project/EventsBasedObject.h"
 #include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/PropertiesContainer.h"
@@ -24,6 +33,104 @@
 #include "GDCore/String.h"
 #include "GDCore/IDE/DependenciesAnalyzer.h"
 
+namespace {
+
+void AddProjectEventsListsWithoutExtensions(
+    const gd::Project &project,
+    std::vector<const gd::EventsList *> &eventsLists) {
+  for (std::size_t s = 0; s < project.GetLayoutsCount(); s++) {
+    eventsLists.push_back(&project.GetLayout(s).GetEvents());
+  }
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    eventsLists.push_back(&project.GetExternalEvents(s).GetEvents());
+  }
+}
+
+void AddExtensionsEventsLists(
+    const gd::Project &project,
+    std::vector<const gd::EventsList *> &eventsLists) {
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    const auto &eventsFunctionsExtension =
+        project.GetEventsFunctionsExtension(e);
+    for (auto &&eventsFunction :
+         eventsFunctionsExtension.GetEventsFunctions().GetInternalVector()) {
+      eventsLists.push_back(&eventsFunction->GetEvents());
+    }
+    for (auto &&eventsBasedBehavior :
+         eventsFunctionsExtension.GetEventsBasedBehaviors()
+             .GetInternalVector()) {
+      for (auto &&eventsFunction :
+           eventsBasedBehavior->GetEventsFunctions().GetInternalVector()) {
+        eventsLists.push_back(&eventsFunction->GetEvents());
+      }
+    }
+    for (auto &&eventsBasedObject :
+         eventsFunctionsExtension.GetEventsBasedObjects().GetInternalVector()) {
+      for (auto &&eventsFunction :
+           eventsBasedObject->GetEventsFunctions().GetInternalVector()) {
+        eventsLists.push_back(&eventsFunction->GetEvents());
+      }
+    }
+  }
+}
+
+void LaunchWorkersInParallel(
+    const gd::Project &project,
+    const std::vector<const gd::EventsList *> &eventsLists,
+    std::size_t threadsCount,
+    const std::function<std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>()>
+        &createWorker,
+    const std::function<void(gd::ReadOnlyArbitraryEventsWorker &)> &reduce) {
+  std::vector<std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>> workers(
+      eventsLists.size());
+  auto launchWorker = [&eventsLists, &workers, &createWorker](std::size_t i) {
+    workers[i] = createWorker();
+    workers[i]->Launch(*eventsLists[i]);
+  };
+
+  threadsCount = std::min(threadsCount, eventsLists.size());
+#if !defined(EMSCRIPTEN)
+  if (threadsCount > 1) {
+    // Create what is lazily created on first use before starting the
+    // threads.
+    project.GetCurrentPlatform().GetMetadataIndex();
+
+    std::atomic<std::size_t> nextIndex(0);
+    std::vector<std::exception_ptr> exceptions(threadsCount);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < threadsCount; ++t) {
+      threads.emplace_back(
+          [&eventsLists, &launchWorker, &nextIndex, &exceptions, t]() {
+            try {
+              for (std::size_t i = nextIndex++; i < eventsLists.size();
+                   i = nextIndex++) {
+                launchWorker(i);
+              }
+            } catch (...) {
+              exceptions[t] = std::current_exception();
+            }
+          });
+    }
+    for (auto &thread : threads) thread.join();
+    for (auto &exception : exceptions) {
+      if (exception) std::rethrow_exception(exception);
+    }
+  } else
+#endif
+  {
+    for (std::size_t i = 0; i < eventsLists.size(); ++i) {
+      launchWorker(i);
+    }
+  }
+
+  for (auto &worker : workers) {
+    reduce(*worker);
+  }
+}
+
+}  // namespace
+
 namespace gd {
 
 void ProjectBrowserHelper::ExposeProjectEvents(
@@ -91,6 +198,29 @@ void ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(
   }
 }
 
+void ProjectBrowserHelper::ExposeProjectEventsInParallel(
+    const gd::Project &project, std::size_t threadsCount,
+    const std::function<std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>()>
+        &createWorker,
+    const std::function<void(gd::ReadOnlyArbitraryEventsWorker &)> &reduce) {
+  std::vector<const gd::EventsList *> eventsLists;
+  AddProjectEventsListsWithoutExtensions(project, eventsLists);
+  AddExtensionsEventsLists(project, eventsLists);
+  LaunchWorkersInParallel(project, eventsLists, threadsCount, createWorker,
+                          reduce);
+}
+
+void ProjectBrowserHelper::ExposeProjectEventsWithoutExtensionsInParallel(
+    const gd::Project &project, std::size_t threadsCount,
+    const std::function<std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>()>
+        &createWorker,
+    const std::function<void(gd::ReadOnlyArbitraryEventsWorker &)> &reduce) {
+  std::vector<const gd::EventsList *> eventsLists;
+  AddProjectEventsListsWithoutExtensions(project, eventsLists);
+  LaunchWorkersInParallel(project, eventsLists, threadsCount, createWorker,
+                          reduce);
+}
+
 void ProjectBrowserHelper::ExposeLayoutEventsAndExternalEvents(
     gd::Project &project, gd::Layout &layout,
     gd::ArbitraryEventsWorker &worker) {
@@ -5,6 +5,10 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+
 namespace gd {
 class Project;
 class Layout;
@@ -16,6 +20,7 @@ class EventsBasedObject;
 class EventsBasedObjectVariant;
 class ArbitraryEventsWorker;
 class ArbitraryEventsWorkerWithContext;
+class ReadOnlyArbitraryEventsWorker;
 class ArbitraryEventsFunctionsWorker;
 class ArbitraryObjectsWorker;
 class ArbitraryEventBasedBehaviorsWorker;
@@ -67,6 +72,42 @@ public:
   static void ExposeProjectEventsWithoutExtensions(
       gd::Project &project, gd::ArbitraryEventsWorkerWithContext &worker);
 
+  /**
+   * \brief Call workers on all events of the project (layout, external
+   * events, events functions...), using several threads.
+   *
+   * Each events list (the events of a layout, of external events or of an
+   * events function) is given to a new worker, created by \a createWorker.
+   * Once all the events lists are browsed, \a reduce is called with each
+   * worker, in the order of the events lists, so that the results don't depend
+   * on the threads.
+   *
+   * Workers must only read the events and their own state. Lazily created data
+   * used by metadata lookups (the metadata index of the platform) is created
+   * before the threads are started, and expressions can be parsed by several
+   * threads at the same time. The project must not be modified meanwhile.
+   *
+   * \note With a \a threadsCount of 1 (or when threads are not supported),
+   * the events lists are browsed one after the other.
+   */
+  static void ExposeProjectEventsInParallel(
+      const gd::Project &project, std::size_t threadsCount,
+      const std::function<std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>()>
+          &createWorker,
+      const std::function<void(gd::ReadOnlyArbitraryEventsWorker &)> &reduce);
+
+  /**
+   * \brief Call workers on all events of the project (layout and external
+   * events) but not events from extensions, using several threads.
+   *
+   * \see ExposeProjectEventsInParallel
+   */
+  static void ExposeProjectEventsWithoutExtensionsInParallel(
+      const gd::Project &project, std::size_t threadsCount,
+      const std::function<std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>()>
+          &createWorker,
+      const std::function<void(gd::ReadOnlyArbitraryEventsWorker &)> &reduce);
+
   /**
    * \brief Call the specified worker on all events of a layout and
    * its external events.
@@ -0,0 +1,529 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectSnapshot.h"
+
+#include <functional>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Serialization/BinarySerializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/Localization.h"
+#include "GDCore/Tools/Log.h"
+
+namespace {
+
+/**
+ * The arrays of which items are stored as separate nodes.
+ */
+const std::vector<gd::String>& GetSplitArrayNames() {
+  static const std::vector<gd::String> splitArrayNames = {
+      "objects", "instances", "events", "variables"};
+  return splitArrayNames;
+}
+
+/**
+ * Find, for the nodes of a new array, the nodes of an old array having the
+ * same key (or the same content for nodes without a key). Each old node is
+ * matched at most once.
+ */
+class NodesMatcher {
+ public:
+  NodesMatcher(const gd::ProjectSnapshotNodes& oldNodes_)
+      : oldNodes(oldNodes_), matched(oldNodes_.size(), false){};
+
+  /**
+   * Return the position of the old node matching the node, or
+   * gd::String::npos. The node at the same position is tried first, as most
+   * nodes are not moved.
+   */
+  std::size_t Match(const gd::ProjectSnapshotNode& node, std::size_t position) {
+    if (position < oldNodes.size() && !matched[position] &&
+        IsMatching(*oldNodes[position], node)) {
+      matched[position] = true;
+      return position;
+    }
+
+    if (!indexed) Index();
+    if (!node.GetKey().empty()) {
+      auto range = oldPositionsByKey.equal_range(node.GetKey());
+      for (auto it = range.first; it != range.second; ++it) {
+        if (!matched[it->second]) {
+          matched[it->second] = true;
+          return it->second;
+        }
+      }
+    } else {
+      auto range = oldPositionsByHash.equal_range(Hash(node));
+      for (auto it = range.first; it != range.second; ++it) {
+        if (!matched[it->second] &&
+            oldNodes[it->second]->HasSameContentAs(node)) {
+          matched[it->second] = true;
+          return it->second;
+        }
+      }
+    }
+
+    return gd::String::npos;
+  }
+
+  /**
+   * Return true if the old node at the position was matched.
+   */
+  bool IsMatched(std::size_t position) const { return matched[position]; }
+
+ private:
+  static bool IsMatching(const gd::ProjectSnapshotNode& oldNode,
+                         const gd::ProjectSnapshotNode& node) {
+    return node.GetKey().empty() ? oldNode.GetKey().empty() &&
+                                       oldNode.HasSameContentAs(node)
+                                 : oldNode.GetKey() == node.GetKey();
+  }
+
+  static std::size_t Hash(const gd::ProjectSnapshotNode& node) {
+    return std::hash<std::string>()(node.GetData());
+  }
+
+  void Index() {
+    for (std::size_t i = 0; i < oldNodes.size(); ++i) {
+      const auto& oldNode = *oldNodes[i];
+      if (!oldNode.GetKey().empty())
+        oldPositionsByKey.emplace(oldNode.GetKey(), i);
+      else
+        oldPositionsByHash.emplace(Hash(oldNode), i);
+    }
+    indexed = true;
+  }
+
+  const gd::ProjectSnapshotNodes& oldNodes;
+  std::vector<bool> matched;
+  bool indexed = false;
+  std::unordered_multimap<gd::String, std::size_t> oldPositionsByKey;
+  std::unordered_multimap<std::size_t, std::size_t> oldPositionsByHash;
+};
+
+const gd::ProjectSnapshotNodes emptyNodes;
+
+/**
+ * Return the persistent UUID of the variables container of an element (kept
+ * in its properties).
+ */
+gd::String GetVariablesContainerPersistentUuid(
+    const gd::ProjectSnapshotNode& properties) {
+  gd::SerializerElement element = properties.ToSerializerElement();
+  if (!element.HasChild("variables")) return "";
+
+  return element.GetChild("variables").GetStringAttribute("persistentUuid");
+}
+
+}  // namespace
+
+namespace gd {
+
+ProjectSnapshotNode::ProjectSnapshotNode(const gd::SerializerElement& element,
+                                         bool hasKey)
+    : data(gd::BinarySerializer::ToBinary(element)) {
+  if (hasKey) {
+    name = element.GetStringAttribute("name");
+    key = element.GetStringAttribute("persistentUuid");
+    keyIsPersistentUuid = !key.empty();
+    if (key.empty()) key = name;
+  }
+}
+
+const gd::String ProjectSnapshotNode::noPersistentUuid;
+
+gd::SerializerElement ProjectSnapshotNode::ToSerializerElement() const {
+  return gd::BinarySerializer::FromBinary(data);
+}
+
+void ProjectSnapshotNode::UnserializeInto(
+    gd::SerializerElement& element) const {
+  gd::BinarySerializedElement(data.data(), data.size())
+      .UnserializeInto(element);
+}
+
+ProjectSnapshotElement::ProjectSnapshotElement(
+    gd::SerializerElement& element,
+    const ProjectSnapshotElement* previousElement) {
+  for (const gd::String& arrayName : GetSplitArrayNames()) {
+    if (!element.HasChild(arrayName)) continue;
+    gd::SerializerElement& arrayElement = element.GetChild(arrayName);
+
+    const ProjectSnapshotNodes* previousNodes =
+        previousElement ? previousElement->GetArray(arrayName) : nullptr;
+    NodesMatcher matcher(previousNodes ? *previousNodes : emptyNodes);
+
+    auto nodes = std::make_shared<ProjectSnapshotNodes>();
+    std::set<gd::String> itemNames;
+    bool sameNodes = previousNodes != nullptr;
+    for (const auto& child : arrayElement.GetAllChildren()) {
+      itemNames.insert(child.first);
+
+      auto node = std::make_shared<const ProjectSnapshotNode>(
+          *child.second, arrayName != "events");
+      std::size_t previousPosition = matcher.Match(*node, nodes->size());
+      if (previousPosition != gd::String::npos &&
+          (*previousNodes)[previousPosition]->HasSameContentAs(*node)) {
+        // Unchanged: share the node with the previous snapshot.
+        sameNodes &= previousPosition == nodes->size();
+        nodes->push_back((*previousNodes)[previousPosition]);
+      } else {
+        sameNodes = false;
+        nodes->push_back(std::move(node));
+      }
+    }
+    sameNodes &= previousNodes && nodes->size() == previousNodes->size();
+
+    // The empty array is kept in the properties, with its attributes.
+    for (const gd::String& itemName : itemNames)
+      arrayElement.RemoveChild(itemName);
+
+    if (sameNodes)
+      arrays[arrayName] = previousElement->arrays.find(arrayName)->second;
+    else
+      arrays[arrayName] = std::move(nodes);
+  }
+
+  auto propertiesNode =
+      std::make_shared<const ProjectSnapshotNode>(element, true);
+  if (previousElement &&
+      previousElement->properties->HasSameContentAs(*propertiesNode))
+    properties = previousElement->properties;
+  else
+    properties = std::move(propertiesNode);
+}
+
+const ProjectSnapshotNodes* ProjectSnapshotElement::GetArray(
+    const gd::String& arrayName) const {
+  auto it = arrays.find(arrayName);
+  return it != arrays.end() ? it->second.get() : nullptr;
+}
+
+gd::SerializerElement ProjectSnapshotElement::ToSerializerElement() const {
+  gd::SerializerElement element = properties->ToSerializerElement();
+  for (const auto& it : arrays) {
+    gd::SerializerElement& arrayElement = element.GetChild(it.first);
+    const gd::String itemName = arrayElement.ConsideredAsArrayOf();
+    for (const auto& node : *it.second)
+      node->UnserializeInto(arrayElement.AddChild(itemName));
+  }
+
+  return element;
+}
+
+std::size_t ProjectSnapshotElement::GetNodesCount() const {
+  std::size_t nodesCount = 1;
+  for (const auto& it : arrays) nodesCount += it.second->size();
+
+  return nodesCount;
+}
+
+bool ProjectSnapshotElement::HasSameNodesAs(
+    const ProjectSnapshotElement& other) const {
+  if (properties != other.properties || arrays.size() != other.arrays.size())
+    return false;
+
+  for (const auto& it : arrays) {
+    auto otherIt = other.arrays.find(it.first);
+    if (otherIt == other.arrays.end() || otherIt->second != it.second)
+      return false;
+  }
+  return true;
+}
+
+ProjectSnapshot::ProjectSnapshot(const gd::Project& project,
+                                 const gd::ProjectSnapshot* previousSnapshot) {
+  {
+    gd::SerializerElement element;
+    project.GetObjects().SerializeObjectsTo(element.AddChild("objects"));
+    project.GetVariables().SerializeTo(element.AddChild("variables"));
+    globalObjectsAndVariables = TakeElement(
+        element,
+        previousSnapshot ? previousSnapshot->globalObjectsAndVariables
+                         : std::shared_ptr<const ProjectSnapshotElement>());
+  }
+
+  // Elements are serialized one by one, so that only one of them is
+  // entirely in memory at a time.
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    gd::SerializerElement element;
+    project.GetLayout(i).SerializeTo(element);
+    layouts.push_back(TakeElement(
+        element, previousSnapshot ? &previousSnapshot->layouts : nullptr));
+  }
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    gd::SerializerElement element;
+    project.GetExternalEvents(i).SerializeTo(element);
+    externalEvents.push_back(TakeElement(
+        element,
+        previousSnapshot ? &previousSnapshot->externalEvents : nullptr));
+  }
+  for (std::size_t i = 0; i < project.GetExternalLayoutsCount(); ++i) {
+    gd::SerializerElement element;
+    project.GetExternalLayout(i).SerializeTo(element);
+    externalLayouts.push_back(TakeElement(
+        element,
+        previousSnapshot ? &previousSnapshot->externalLayouts : nullptr));
+  }
+}
+
+std::shared_ptr<const ProjectSnapshotElement> ProjectSnapshot::TakeElement(
+    gd::SerializerElement& element,
+    const std::shared_ptr<const ProjectSnapshotElement>& previousElement) {
+  auto snapshotElement =
+      std::make_shared<const ProjectSnapshotElement>(element,
+                                                     previousElement.get());
+  if (previousElement && snapshotElement->HasSameNodesAs(*previousElement))
+    return previousElement;
+
+  return snapshotElement;
+}
+
+std::shared_ptr<const ProjectSnapshotElement> ProjectSnapshot::TakeElement(
+    gd::SerializerElement& element,
+    const ProjectSnapshotElements* previousElements) {
+  if (!previousElements)
+    return TakeElement(element,
+                       std::shared_ptr<const ProjectSnapshotElement>());
+
+  gd::String key = element.GetStringAttribute("persistentUuid");
+  if (key.empty()) key = element.GetStringAttribute("name");
+  for (const auto& previousElement : *previousElements) {
+    if (previousElement->GetKey() == key)
+      return TakeElement(element, previousElement);
+  }
+
+  return TakeElement(element, std::shared_ptr<const ProjectSnapshotElement>());
+}
+
+const ProjectSnapshotElement* ProjectSnapshot::FindElement(
+    const ProjectSnapshotElements& elements, const gd::String& name) {
+  for (const auto& element : elements) {
+    if (element->GetName() == name) return element.get();
+  }
+
+  return nullptr;
+}
+
+const ProjectSnapshotElement* ProjectSnapshot::GetLayout(
+    const gd::String& name) const {
+  return FindElement(layouts, name);
+}
+
+const ProjectSnapshotElement* ProjectSnapshot::GetExternalEvents(
+    const gd::String& name) const {
+  return FindElement(externalEvents, name);
+}
+
+const ProjectSnapshotElement* ProjectSnapshot::GetExternalLayout(
+    const gd::String& name) const {
+  return FindElement(externalLayouts, name);
+}
+
+std::size_t ProjectSnapshot::GetNodesCount() const {
+  std::size_t nodesCount = globalObjectsAndVariables->GetNodesCount();
+  for (const auto* elements : {&layouts, &externalEvents, &externalLayouts}) {
+    for (const auto& element : *elements)
+      nodesCount += element->GetNodesCount();
+  }
+
+  return nodesCount;
+}
+
+std::size_t ProjectSnapshot::GetSharedNodesCount(
+    const gd::ProjectSnapshot& other) const {
+  auto forEachNode =
+      [](const gd::ProjectSnapshot& snapshot,
+         std::function<void(const ProjectSnapshotNode* node)> fn) {
+        auto forEachElementNode = [&fn](const ProjectSnapshotElement& element) {
+          fn(element.properties.get());
+          for (const auto& it : element.arrays) {
+            for (const auto& node : *it.second) fn(node.get());
+          }
+        };
+
+        forEachElementNode(*snapshot.globalObjectsAndVariables);
+        for (const auto* elements : {&snapshot.layouts,
+                                     &snapshot.externalEvents,
+                                     &snapshot.externalLayouts}) {
+          for (const auto& element : *elements) forEachElementNode(*element);
+        }
+      };
+
+  std::unordered_set<const ProjectSnapshotNode*> otherNodes;
+  forEachNode(other, [&otherNodes](const ProjectSnapshotNode* node) {
+    otherNodes.insert(node);
+  });
+
+  std::size_t sharedNodesCount = 0;
+  forEachNode(*this, [&](const ProjectSnapshotNode* node) {
+    if (otherNodes.count(node)) sharedNodesCount++;
+  });
+  return sharedNodesCount;
+}
+
+ProjectSnapshotChangeset ProjectSnapshot::ComputeChangeset(
+    const gd::ProjectSnapshot& oldSnapshot,
+    const gd::ProjectSnapshot& newSnapshot) {
+  ProjectSnapshotChangeset changeset;
+  changeset.globalObjectsAndVariables =
+      ComputeChangeset(*oldSnapshot.globalObjectsAndVariables,
+                       *newSnapshot.globalObjectsAndVariables);
+  changeset.layouts =
+      ComputeChangeset(oldSnapshot.layouts, newSnapshot.layouts);
+  changeset.externalEvents =
+      ComputeChangeset(oldSnapshot.externalEvents, newSnapshot.externalEvents);
+  changeset.externalLayouts = ComputeChangeset(oldSnapshot.externalLayouts,
+                                               newSnapshot.externalLayouts);
+
+  return changeset;
+}
+
+ProjectSnapshotElementsChangeset ProjectSnapshot::ComputeChangeset(
+    const ProjectSnapshotElements& oldElements,
+    const ProjectSnapshotElements& newElements) {
+  ProjectSnapshotElementsChangeset changeset;
+
+  std::unordered_map<gd::String, const ProjectSnapshotElement*>
+      oldElementsByKey;
+  for (const auto& oldElement : oldElements)
+    oldElementsByKey[oldElement->GetKey()] = oldElement.get();
+
+  for (const auto& newElement : newElements) {
+    auto it = oldElementsByKey.find(newElement->GetKey());
+    if (it == oldElementsByKey.end()) {
+      changeset.addedNames.push_back(newElement->GetName());
+      continue;
+    }
+
+    const ProjectSnapshotElement* oldElement = it->second;
+    oldElementsByKey.erase(it);
+    if (oldElement == newElement.get()) continue;
+
+    ProjectSnapshotElementChangeset elementChangeset =
+        ComputeChangeset(*oldElement, *newElement);
+    if (elementChangeset.HasChanges())
+      changeset.modifiedElements.push_back(std::move(elementChangeset));
+  }
+
+  for (const auto& oldElement : oldElements) {
+    if (oldElementsByKey.count(oldElement->GetKey()))
+      changeset.removedNames.push_back(oldElement->GetName());
+  }
+
+  return changeset;
+}
+
+ProjectSnapshotElementChangeset ProjectSnapshot::ComputeChangeset(
+    const gd::ProjectSnapshotElement& oldElement,
+    const gd::ProjectSnapshotElement& newElement) {
+  ProjectSnapshotElementChangeset changeset;
+  changeset.oldName = oldElement.GetName();
+  changeset.newName = newElement.GetName();
+  changeset.propertiesChanged =
+      !oldElement.properties->HasSameContentAs(*newElement.properties);
+
+  for (const gd::String& arrayName : GetSplitArrayNames()) {
+    const ProjectSnapshotNodes* oldNodes = oldElement.GetArray(arrayName);
+    const ProjectSnapshotNodes* newNodes = newElement.GetArray(arrayName);
+    if (oldNodes == newNodes) continue;
+    if (!oldNodes) oldNodes = &emptyNodes;
+    if (!newNodes) newNodes = &emptyNodes;
+
+    ProjectSnapshotArrayChangeset arrayChangeset;
+    NodesMatcher matcher(*oldNodes);
+    for (std::size_t i = 0; i < newNodes->size(); ++i) {
+      const ProjectSnapshotNode& newNode = *(*newNodes)[i];
+      std::size_t oldPosition = matcher.Match(newNode, i);
+      if (oldPosition == gd::String::npos)
+        arrayChangeset.addedPositions.push_back(i);
+      else if (!(*oldNodes)[oldPosition]->HasSameContentAs(newNode))
+        arrayChangeset.modifiedPositions.push_back(i);
+    }
+    for (std::size_t i = 0; i < oldNodes->size(); ++i) {
+      if (!matcher.IsMatched(i)) arrayChangeset.removedPositions.push_back(i);
+    }
+
+    if (arrayChangeset.HasChanges())
+      changeset.arraysChangesets[arrayName] = std::move(arrayChangeset);
+  }
+
+  return changeset;
+}
+
+gd::VariablesChangeset ProjectSnapshot::ComputeVariablesChangeset(
+    const gd::ProjectSnapshotElement& oldElement,
+    const gd::ProjectSnapshotElement& newElement) {
+  gd::VariablesChangeset changeset;
+
+  const ProjectSnapshotNodes* oldNodes = oldElement.GetArray("variables");
+  const ProjectSnapshotNodes* newNodes = newElement.GetArray("variables");
+  if (oldNodes == newNodes) return changeset;
+  if (!oldNodes) oldNodes = &emptyNodes;
+  if (!newNodes) newNodes = &emptyNodes;
+
+  if (oldElement.properties != newElement.properties &&
+      GetVariablesContainerPersistentUuid(*oldElement.properties) !=
+          GetVariablesContainerPersistentUuid(*newElement.properties)) {
+    gd::LogWarning(
+        _("Called ComputeVariablesChangeset on variables containers that are "
+          "different - they can't be compared."));
+    return changeset;
+  }
+
+  // Variables are recognized by their persistent UUID only, like in
+  // gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer.
+  std::unordered_map<gd::String, std::size_t> removedPositionsByUuid;
+  for (std::size_t i = 0; i < oldNodes->size(); ++i)
+    removedPositionsByUuid[(*oldNodes)[i]->GetPersistentUuid()] = i;
+
+  for (std::size_t i = 0; i < newNodes->size(); ++i) {
+    const ProjectSnapshotNode& newNode = *(*newNodes)[i];
+    auto removedPositionByUuid =
+        removedPositionsByUuid.find(newNode.GetPersistentUuid());
+    if (removedPositionByUuid == removedPositionsByUuid.end()) {
+      changeset.addedVariableNames.insert(newNode.GetName());
+      continue;
+    }
+
+    // Renamed or not, this is not a removed variable.
+    const ProjectSnapshotNode& oldNode =
+        *(*oldNodes)[removedPositionByUuid->second];
+    removedPositionsByUuid.erase(removedPositionByUuid);
+
+    // Only the variables that changed (including their name) are
+    // unserialized.
+    if (oldNode.HasSameContentAs(newNode)) continue;
+
+    gd::Variable oldVariable;
+    oldVariable.UnserializeFrom(oldNode.ToSerializerElement());
+    gd::Variable newVariable;
+    newVariable.UnserializeFrom(newNode.ToSerializerElement());
+    gd::WholeProjectRefactorer::ComputeChangesetForKeptVariable(
+        changeset,
+        oldNode.GetName(),
+        oldVariable,
+        newNode.GetName(),
+        newVariable);
+  }
+  for (const auto& removedPositionByUuid : removedPositionsByUuid) {
+    changeset.removedVariableNames.insert(
+        (*oldNodes)[removedPositionByUuid.second]->GetName());
+  }
+
+  return changeset;
+}
+
+}  // namespace gd
@@ -0,0 +1,310 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class Project;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An immutable part of a gd::ProjectSnapshot: an object, an instance,
+ * an event, a variable or the rest of a layout, stored in its binary
+ * representation (see gd::BinarySerializer).
+ *
+ * A node is shared by all the snapshots where it's unchanged.
+ */
+class GD_CORE_API ProjectSnapshotNode {
+ public:
+  /**
+   * \brief Store the element. Its persistent UUID and name are read only if
+   * the element is recognized by them (i.e: not for events).
+   */
+  ProjectSnapshotNode(const gd::SerializerElement& element, bool hasKey);
+  virtual ~ProjectSnapshotNode(){};
+
+  /**
+   * \brief Return the persistent UUID of the element, or its name if it
+   * has none, or an empty string for elements not recognized by them
+   * (events).
+   */
+  const gd::String& GetKey() const { return key; }
+
+  /**
+   * \brief Return the name of the element, if any.
+   */
+  const gd::String& GetName() const { return name; }
+
+  /**
+   * \brief Return the persistent UUID of the element, or an empty string if
+   * it has none.
+   */
+  const gd::String& GetPersistentUuid() const {
+    return keyIsPersistentUuid ? key : noPersistentUuid;
+  }
+
+  /**
+   * \brief Return the binary representation of the element.
+   */
+  const std::string& GetData() const { return data; }
+
+  /**
+   * \brief Return true if the other node stores the same element.
+   */
+  bool HasSameContentAs(const ProjectSnapshotNode& other) const {
+    return this == &other || data == other.data;
+  }
+
+  gd::SerializerElement ToSerializerElement() const;
+
+  void UnserializeInto(gd::SerializerElement& element) const;
+
+ private:
+  gd::String key;
+  gd::String name;
+  bool keyIsPersistentUuid = false;
+  std::string data;
+
+  static const gd::String noPersistentUuid;
+};
+
+typedef std::vector<std::shared_ptr<const gd::ProjectSnapshotNode>>
+    ProjectSnapshotNodes;
+
+/**
+ * \brief The snapshot of a layout, an external layout, external events or the
+ * global objects and variables of a project.
+ *
+ * The items of its arrays (objects, instances, events, variables) are stored
+ * as separate nodes, and the rest of the element in a last node.
+ */
+class GD_CORE_API ProjectSnapshotElement {
+ public:
+  /**
+   * \brief Store the element, sharing the nodes that are unchanged since the
+   * previous snapshot of the element, if any.
+   *
+   * \note The items of the arrays are removed from the element.
+   */
+  ProjectSnapshotElement(gd::SerializerElement& element,
+                         const ProjectSnapshotElement* previousElement);
+  virtual ~ProjectSnapshotElement(){};
+
+  /**
+   * \brief Return the persistent UUID of the element, or its name if it
+   * has none.
+   */
+  const gd::String& GetKey() const { return properties->GetKey(); }
+
+  const gd::String& GetName() const { return properties->GetName(); }
+
+  /**
+   * \brief Return the nodes of the items of the array with the specified
+   * name ("objects", "instances", "events" or "variables"), or nullptr if
+   * the element has no such array.
+   */
+  const ProjectSnapshotNodes* GetArray(const gd::String& arrayName) const;
+
+  /**
+   * \brief Return the element as it was serialized when the snapshot was
+   * taken.
+   */
+  gd::SerializerElement ToSerializerElement() const;
+
+  /**
+   * \brief Return the number of nodes used to store the element.
+   */
+  std::size_t GetNodesCount() const;
+
+  /**
+   * \brief Return true if the other element has the same nodes.
+   */
+  bool HasSameNodesAs(const ProjectSnapshotElement& other) const;
+
+ private:
+  friend class ProjectSnapshot;
+
+  std::shared_ptr<const gd::ProjectSnapshotNode>
+      properties;  ///< The element, without the items of its arrays.
+  std::map<gd::String, std::shared_ptr<const ProjectSnapshotNodes>> arrays;
+};
+
+/**
+ * \brief The changes of the items of an array between two snapshots.
+ *
+ * Items are matched using their persistent UUID (or their name). Items
+ * without one (events) are matched by their content, so a modified event is
+ * seen as removed and added. Items that are only moved are not changes.
+ */
+struct GD_CORE_API ProjectSnapshotArrayChangeset {
+  std::vector<std::size_t> addedPositions;     ///< In the new array.
+  std::vector<std::size_t> removedPositions;   ///< In the old array.
+  std::vector<std::size_t> modifiedPositions;  ///< In the new array.
+
+  bool HasChanges() const {
+    return !addedPositions.empty() || !removedPositions.empty() ||
+           !modifiedPositions.empty();
+  }
+};
+
+/**
+ * \brief The changes of a layout, an external layout, external events or the
+ * global objects and variables between two snapshots.
+ */
+struct GD_CORE_API ProjectSnapshotElementChangeset {
+  gd::String oldName;
+  gd::String newName;
+  bool propertiesChanged = false;  ///< True if anything other than the
+                                   ///< items of the arrays (including the
+                                   ///< name) changed.
+  std::map<gd::String, ProjectSnapshotArrayChangeset>
+      arraysChangesets;  ///< By array name, only for changed arrays.
+
+  bool HasChanges() const {
+    return oldName != newName || propertiesChanged || !arraysChangesets.empty();
+  }
+};
+
+/**
+ * \brief The changes of the layouts, external layouts or external events
+ * between two snapshots.
+ */
+struct GD_CORE_API ProjectSnapshotElementsChangeset {
+  std::vector<gd::String> addedNames;
+  std::vector<gd::String> removedNames;
+  std::vector<ProjectSnapshotElementChangeset>
+      modifiedElements;  ///< Including renamed elements.
+};
+
+struct GD_CORE_API ProjectSnapshotChangeset {
+  ProjectSnapshotElementChangeset globalObjectsAndVariables;
+  ProjectSnapshotElementsChangeset layouts;
+  ProjectSnapshotElementsChangeset externalEvents;
+  ProjectSnapshotElementsChangeset externalLayouts;
+};
+
+/**
+ * \brief A snapshot of the layouts, external layouts, external events and
+ * global objects and variables of a project, to be kept in an undo history
+ * and compared with other snapshots.
+ *
+ * A snapshot is made of immutable nodes, one for each object, instance,
+ * top-level event and variable. When a snapshot is taken after a previous
+ * one, the nodes (and the layouts, arrays...) that did not change are shared
+ * with it, so that keeping a snapshot only costs the memory of what changed.
+ * Comparing two snapshots only looks at the nodes that are not shared.
+ *
+ * Layouts are recognized with their persistent UUID (or their name if they
+ * have none), as well as objects, instances and variables.
+ *
+ * \note Taking a snapshot still serializes the elements, but not to JSON and
+ * without keeping the serialized elements in memory.
+ *
+ * \see gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer
+ */
+class GD_CORE_API ProjectSnapshot {
+ public:
+  /**
+   * \brief Take a snapshot of the project, sharing the nodes that are
+   * unchanged since the previous snapshot, if any.
+   */
+  ProjectSnapshot(const gd::Project& project,
+                  const gd::ProjectSnapshot* previousSnapshot = nullptr);
+  virtual ~ProjectSnapshot(){};
+
+  const ProjectSnapshotElement& GetGlobalObjectsAndVariables() const {
+    return *globalObjectsAndVariables;
+  }
+
+  /**
+   * \brief Return the snapshot of the layout with the specified name, or
+   * nullptr if it does not exist.
+   */
+  const ProjectSnapshotElement* GetLayout(const gd::String& name) const;
+
+  /**
+   * \brief Return the snapshot of the external events with the specified
+   * name, or nullptr if they do not exist.
+   */
+  const ProjectSnapshotElement* GetExternalEvents(const gd::String& name) const;
+
+  /**
+   * \brief Return the snapshot of the external layout with the specified
+   * name, or nullptr if it does not exist.
+   */
+  const ProjectSnapshotElement* GetExternalLayout(const gd::String& name) const;
+
+  /**
+   * \brief Return the number of nodes of the snapshot.
+   */
+  std::size_t GetNodesCount() const;
+
+  /**
+   * \brief Return the number of nodes of the snapshot that are shared with
+   * the other snapshot.
+   */
+  std::size_t GetSharedNodesCount(const gd::ProjectSnapshot& other) const;
+
+  /**
+   * \brief Compute the changes made to the project between two snapshots.
+   */
+  static ProjectSnapshotChangeset ComputeChangeset(
+      const gd::ProjectSnapshot& oldSnapshot,
+      const gd::ProjectSnapshot& newSnapshot);
+
+  /**
+   * \brief Compute the changes made to an element between two snapshots.
+   */
+  static ProjectSnapshotElementChangeset ComputeChangeset(
+      const gd::ProjectSnapshotElement& oldElement,
+      const gd::ProjectSnapshotElement& newElement);
+
+  /**
+   * \brief Compute the changes made to the variables of an element between
+   * two snapshots, like
+   * gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer, but
+   * only unserializing the variables that changed.
+   */
+  static gd::VariablesChangeset ComputeVariablesChangeset(
+      const gd::ProjectSnapshotElement& oldElement,
+      const gd::ProjectSnapshotElement& newElement);
+
+ private:
+  typedef std::vector<std::shared_ptr<const ProjectSnapshotElement>>
+      ProjectSnapshotElements;
+
+  static std::shared_ptr<const ProjectSnapshotElement> TakeElement(
+      gd::SerializerElement& element,
+      const std::shared_ptr<const ProjectSnapshotElement>& previousElement);
+
+  static std::shared_ptr<const ProjectSnapshotElement> TakeElement(
+      gd::SerializerElement& element,
+      const ProjectSnapshotElements* previousElements);
+
+  static const ProjectSnapshotElement* FindElement(
+      const ProjectSnapshotElements& elements, const gd::String& name);
+
+  static ProjectSnapshotElementsChangeset ComputeChangeset(
+      const ProjectSnapshotElements& oldElements,
+      const ProjectSnapshotElements& newElements);
+
+  std::shared_ptr<const ProjectSnapshotElement> globalObjectsAndVariables;
+  ProjectSnapshotElements layouts;
+  ProjectSnapshotElements externalEvents;
+  ProjectSnapshotElements externalLayouts;
+};
+
+}  // namespace gd
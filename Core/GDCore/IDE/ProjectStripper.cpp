@@ -5,17 +5,71 @@
  */
 #include "ProjectStripper.h"
 
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
 #include "GDCore/Project/EventsFunctionsContainer.h"
 #include "GDCore/Project/EventsFunctionsExtension.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Project/PropertiesContainer.h"
+#include "GDCore/Project/Behavior.h"
 #include "GDCore/IDE/WholeProjectBrowser.h"
 #include "GDCore/IDE/Events/BehaviorDefaultFlagClearer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 
-namespace gd {
+namespace {
+
+bool IsStrippedForExport(const gd::EventsFunctionsExtension &extension) {
+  return extension.GetEventsBasedObjects().size() == 0 &&
+         extension.GetGlobalVariables().Count() == 0 &&
+         extension.GetSceneVariables().Count() == 0;
+}
+
+void SerializeEmptyObjectGroupsTo(gd::SerializerElement &element) {
+  element = gd::SerializerElement();
+  gd::ObjectGroupsContainer().SerializeTo(element);
+}
+
+void SerializeEmptyEventsFunctionsTo(gd::SerializerElement &element) {
+  element = gd::SerializerElement();
+  gd::EventsFunctionsContainer(gd::EventsFunctionsContainer::Extension)
+      .SerializeEventsFunctionsTo(element);
+}
+
+/**
+ * Serialize again, without their default behavior flags, the objects having
+ * default behaviors (see gd::BehaviorDefaultFlagClearer).
+ */
+void SerializeObjectsWithCleanDefaultBehaviorFlagsTo(
+    const gd::ObjectsContainer &objectsContainer,
+    gd::SerializerElement &objectsElement) {
+  for (std::size_t i = 0; i < objectsContainer.GetObjectsCount(); ++i) {
+    const gd::Object &object = objectsContainer.GetObject(i);
 
+    bool hasDefaultBehavior = false;
+    for (const auto &behaviorName : object.GetAllBehaviorNames()) {
+      if (object.GetBehavior(behaviorName).IsDefaultBehavior()) {
+        hasDefaultBehavior = true;
+        break;
+      }
+    }
+    if (!hasDefaultBehavior) continue;
+
+    gd::SerializerElement &objectElement = objectsElement.GetChild(i);
+    objectElement = gd::SerializerElement();
+    gd::BehaviorDefaultFlagClearer::SerializeObjectWithCleanDefaultBehaviorFlags(
+        object, objectElement);
+  }
+}
+
+}  // namespace
+
+namespace gd {
 void GD_CORE_API ProjectStripper::StripProjectForExport(gd::Project &project) {
   project.GetObjects().GetObjectGroups().Clear();
   while (project.GetExternalEventsCount() > 0)
@@ -47,9 +101,7 @@ void GD_CORE_API ProjectStripper::StripProjectForExport(gd::Project &project) {
     extension.SetOrigin("", "");
     extension.SetVersion("");
     auto &eventsBasedObjects = extension.GetEventsBasedObjects();
-    if (eventsBasedObjects.size() == 0 &&
-        extension.GetGlobalVariables().Count() == 0 &&
-        extension.GetSceneVariables().Count() == 0) {
+    if (IsStrippedForExport(extension)) {
       project.RemoveEventsFunctionsExtension(extension.GetName());
       extensionIndex--;
       continue;
@@ -67,4 +119,99 @@ void GD_CORE_API ProjectStripper::StripProjectForExport(gd::Project &project) {
   }
 }
 
+void GD_CORE_API ProjectStripper::SerializeProjectForExport(
+    const gd::Project &project, gd::SerializerElement &element) {
+  // The project is serialized, then the serialized elements are stripped
+  // like StripProjectForExport strips the project.
+  project.SerializeTo(element);
+
+  SerializeEmptyObjectGroupsTo(element.GetChild("objectsGroups"));
+  SerializeObjectsWithCleanDefaultBehaviorFlagsTo(project.GetObjects(),
+                                                  element.GetChild("objects"));
+
+  gd::SerializerElement &externalEventsElement =
+      element.GetChild("externalEvents");
+  externalEventsElement = gd::SerializerElement();
+  externalEventsElement.ConsiderAsArrayOf("externalEvents");
+
+  gd::SerializerElement &layoutsElement = element.GetChild("layouts");
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    const gd::Layout &layout = project.GetLayout(i);
+    gd::SerializerElement &layoutElement = layoutsElement.GetChild(i);
+
+    SerializeEmptyObjectGroupsTo(layoutElement.GetChild("objectsGroups"));
+    SerializeObjectsWithCleanDefaultBehaviorFlagsTo(
+        layout.GetObjects(), layoutElement.GetChild("objects"));
+
+    gd::SerializerElement &eventsElement = layoutElement.GetChild("events");
+    eventsElement = gd::SerializerElement();
+    gd::EventsList().SerializeTo(eventsElement);
+  }
+
+  gd::SerializerElement &extensionsElement =
+      element.GetChild("eventsFunctionsExtensions");
+  gd::SerializerElement strippedExtensionsElement;
+  strippedExtensionsElement.ConsiderAsArrayOf("eventsFunctionsExtension");
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    const auto &extension = project.GetEventsFunctionsExtension(i);
+    if (IsStrippedForExport(extension)) continue;
+
+    gd::SerializerElement &extensionElement = extensionsElement.GetChild(i);
+    extensionElement.SetAttribute("fullName", "");
+    extensionElement.SetAttribute("shortDescription", "");
+    extensionElement.GetChild("description").SetMultilineStringValue("");
+    extensionElement.SetAttribute("helpPath", "");
+    extensionElement.SetAttribute("iconUrl", "");
+    extensionElement.SetAttribute("previewIconUrl", "");
+    extensionElement.RemoveChild("origin");
+    extensionElement.SetAttribute("version", "");
+
+    const auto &eventsBasedObjects = extension.GetEventsBasedObjects();
+    gd::SerializerElement &eventsBasedObjectsElement =
+        extensionElement.GetChild("eventsBasedObjects");
+    for (std::size_t objectIndex = 0; objectIndex < eventsBasedObjects.size();
+         ++objectIndex) {
+      const auto &eventsBasedObject = eventsBasedObjects.at(objectIndex);
+      gd::SerializerElement &eventsBasedObjectElement =
+          eventsBasedObjectsElement.GetChild(objectIndex);
+      eventsBasedObjectElement.SetAttribute("fullName", "");
+      eventsBasedObjectElement.SetAttribute("description", "");
+      SerializeEmptyEventsFunctionsTo(
+          eventsBasedObjectElement.GetChild("eventsFunctions"));
+
+      gd::SerializerElement &propertyDescriptorsElement =
+          eventsBasedObjectElement.GetChild("propertyDescriptors");
+      propertyDescriptorsElement = gd::SerializerElement();
+      gd::PropertiesContainer(gd::EventsFunctionsContainer::Object)
+          .SerializeElementsTo("propertyDescriptor",
+                               propertyDescriptorsElement);
+
+      SerializeObjectsWithCleanDefaultBehaviorFlagsTo(
+          eventsBasedObject.GetObjects(),
+          eventsBasedObjectElement.GetChild("objects"));
+      gd::SerializerElement &variantsElement =
+          eventsBasedObjectElement.GetChild("variants");
+      const auto &variants = eventsBasedObject.GetVariants();
+      for (std::size_t variantIndex = 0;
+           variantIndex < variants.GetInternalVector().size();
+           ++variantIndex) {
+        SerializeObjectsWithCleanDefaultBehaviorFlagsTo(
+            variants.GetInternalVector()[variantIndex]->GetObjects(),
+            variantsElement.GetChild(variantIndex).GetChild("objects"));
+      }
+    }
+
+    gd::SerializerElement &eventsBasedBehaviorsElement =
+        extensionElement.GetChild("eventsBasedBehaviors");
+    eventsBasedBehaviorsElement = gd::SerializerElement();
+    gd::SerializableWithNameList<gd::EventsBasedBehavior>().SerializeElementsTo(
+        "eventsBasedBehavior", eventsBasedBehaviorsElement);
+    SerializeEmptyEventsFunctionsTo(extensionElement.GetChild("eventsFunctions"));
+
+    strippedExtensionsElement.AddChild("eventsFunctionsExtension") =
+        extensionElement;
+  }
+  extensionsElement = strippedExtensionsElement;
+}
 } // namespace gd
@@ -7,6 +7,7 @@
 #define GDCORE_PROJECTSTRIPPER_H
 namespace gd {
 class Project;
+class SerializerElement;
 }
 namespace gd {
 class String;
@@ -28,6 +29,15 @@ class GD_CORE_API ProjectStripper {
    */
   static void StripProjectForExport(gd::Project& project);
 
+  /**
+   * \brief Serialize the project as it would be serialized after being
+   * stripped with StripProjectForExport, without modifying (nor copying) it.
+   *
+   * \param project The project to be serialized.
+   * \param element The element where the stripped project is serialized.
+   */
+  static void SerializeProjectForExport(const gd::Project& project,
+                                        gd::SerializerElement& element);
  private:
   ProjectStripper(){};
   virtual ~ProjectStripper(){};
@@ -175,31 +175,11 @@ WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
       changeset.addedVariableNames.insert(variableName);
     } else {
       const gd::String &oldName = existingOldVariableUuidAndName->second;
-
-      if (oldName != variableName) {
-        // This is a renamed variable.
-        changeset.oldToNewVariableNames[oldName] = variableName;
-      }
-
-      const auto &oldVariable = oldVariablesContainer.Get(oldName);
-      if (gd::WholeProjectRefactorer::HasAnyVariableTypeChanged(oldVariable,
-                                                                variable)) {
-        changeset.typeChangedVariableNames.insert(variableName);
-      }
-      if (oldVariable != variable
-        // Mixed values are never equals, but they must not override anything.
-        && !variable.HasMixedValues()) {
-        changeset.valueChangedVariableNames.insert(variableName);
-      }
-
-      const auto &variablesRenamingChangesetNode =
-          gd::WholeProjectRefactorer::ComputeChangesetForVariable(oldVariable,
-                                                                  variable);
-
-      if (variablesRenamingChangesetNode) {
-        changeset.modifiedVariables[oldName] =
-            std::move(variablesRenamingChangesetNode);
-      }
+      ComputeChangesetForKeptVariable(changeset,
+                                      oldName,
+                                      oldVariablesContainer.Get(oldName),
+                                      variableName,
+                                      variable);
 
       // Renamed or not, this is not a removed variable.
       removedUuidAndNames.erase(variable.GetPersistentUuid());
@@ -213,6 +193,37 @@ WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
   return changeset;
 }
 
+void WholeProjectRefactorer::ComputeChangesetForKeptVariable(
+    gd::VariablesChangeset &changeset,
+    const gd::String &oldName,
+    const gd::Variable &oldVariable,
+    const gd::String &newName,
+    const gd::Variable &newVariable) {
+  if (oldName != newName) {
+    // This is a renamed variable.
+    changeset.oldToNewVariableNames[oldName] = newName;
+  }
+
+  if (gd::WholeProjectRefactorer::HasAnyVariableTypeChanged(oldVariable,
+                                                            newVariable)) {
+    changeset.typeChangedVariableNames.insert(newName);
+  }
+  if (oldVariable != newVariable
+    // Mixed values are never equals, but they must not override anything.
+    && !newVariable.HasMixedValues()) {
+    changeset.valueChangedVariableNames.insert(newName);
+  }
+
+  const auto &variablesRenamingChangesetNode =
+      gd::WholeProjectRefactorer::ComputeChangesetForVariable(oldVariable,
+                                                              newVariable);
+
+  if (variablesRenamingChangesetNode) {
+    changeset.modifiedVariables[oldName] =
+        std::move(variablesRenamingChangesetNode);
+  }
+}
+
 std::shared_ptr<VariablesRenamingChangesetNode>
 WholeProjectRefactorer::ComputeChangesetForVariable(
     const gd::Variable &oldVariable, const gd::Variable &newVariable) {
@@ -79,6 +79,17 @@ class GD_CORE_API WholeProjectRefactorer {
     const gd::SerializerElement &oldSerializedVariablesContainer,
     const gd::VariablesContainer &newVariablesContainer);
 
+  /**
+   * \brief Add to a changeset the changes made on a variable that is kept
+   * (i.e: having the same persistent UUID) but possibly renamed or modified.
+   */
+  static void ComputeChangesetForKeptVariable(
+      gd::VariablesChangeset &changeset,
+      const gd::String &oldName,
+      const gd::Variable &oldVariable,
+      const gd::String &newName,
+      const gd::Variable &newVariable);
+
   /**
    * \brief Refactor the project according to the changes (renaming or deletion)
    * made to global or scene variables.
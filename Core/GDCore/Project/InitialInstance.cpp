@@ -19,8 +19,7 @@ namespace gd {
 gd::String* InitialInstance::badStringPropertyValue = NULL;
 
 InitialInstance::InitialInstance()
-    : objectName(""),
-      x(0),
+    : x(0),
       y(0),
       z(0),
       angle(0),
@@ -28,7 +27,6 @@ InitialInstance::InitialInstance()
       rotationY(0),
       zOrder(0),
       opacity(255),
-      layer(""),
       flippedX(false),
       flippedY(false),
       flippedZ(false),
@@ -10,6 +10,7 @@
 
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
 namespace gd {
 class PropertyDescriptor;
 class Project;
@@ -46,12 +47,23 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Get the name of object instantiated on the layout.
    */
-  const gd::String& GetObjectName() const { return objectName; }
+  const gd::String& GetObjectName() const { return objectName.GetString(); }
+
+  /**
+   * \brief Get the name of object instantiated on the layout, as a symbol
+   * (faster to compare than the name).
+   */
+  const gd::Symbol& GetObjectNameSymbol() const { return objectName; }
+
+  /**
+   * \brief Set the name of object instantiated on the layout.
+   */
+  void SetObjectName(const gd::String& name) { objectName = gd::Symbol(name); }
 
   /**
    * \brief Set the name of object instantiated on the layout.
    */
-  void SetObjectName(const gd::String& name) { objectName = name; }
+  void SetObjectName(const gd::Symbol& name) { objectName = name; }
 
   /**
    * \brief Get the X position of the instance
@@ -166,12 +178,23 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Get the layer the instance belongs to.
    */
-  const gd::String& GetLayer() const { return layer; }
+  const gd::String& GetLayer() const { return layer.GetString(); }
+
+  /**
+   * \brief Get the layer the instance belongs to, as a symbol (faster to
+   * compare than the name).
+   */
+  const gd::Symbol& GetLayerSymbol() const { return layer; }
+
+  /**
+   * \brief Set the layer the instance belongs to.
+   */
+  void SetLayer(const gd::String& layer_) { layer = gd::Symbol(layer_); }
 
   /**
    * \brief Set the layer the instance belongs to.
    */
-  void SetLayer(const gd::String& layer_) { layer = layer_; }
+  void SetLayer(const gd::Symbol& layer_) { layer = layer_; }
 
   /**
    * \brief Return true if the instance has a width/height which is different
@@ -388,7 +411,7 @@ class GD_CORE_API InitialInstance {
   std::map<gd::String, gd::String>
       stringProperties;  ///< More data which can be used by the object
 
-  gd::String objectName;  ///< Object name
+  gd::Symbol objectName;  ///< Object name
   double x;               ///< Instance X position
   double y;               ///< Instance Y position
   double z;               ///< Instance Z position (for a 3D object)
@@ -400,7 +423,7 @@ class GD_CORE_API InitialInstance {
   bool flippedX;          ///< True if the instance is flipped on X axis
   bool flippedY;          ///< True if the instance is flipped on Y axis
   bool flippedZ;          ///< True if the instance is flipped on Z axis
-  gd::String layer;       ///< Instance layer
+  gd::Symbol layer;       ///< Instance layer
   bool customSize;        ///< True if object has a custom width and height
   bool customDepth;       ///< True if object has a custom depth
   double width;           ///< Instance custom width
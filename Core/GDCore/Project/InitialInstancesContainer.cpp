@@ -11,6 +11,8 @@
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/PolymorphicClone.h"
 
 using namespace std;
 
@@ -18,6 +20,22 @@ namespace gd {
 
 gd::InitialInstance InitialInstancesContainer::badPosition;
 
+InitialInstancesContainer::InitialInstancesContainer(
+    const InitialInstancesContainer& other) {
+  Init(other);
+}
+
+InitialInstancesContainer& InitialInstancesContainer::operator=(
+    const InitialInstancesContainer& other) {
+  if (this != &other) Init(other);
+
+  return *this;
+}
+
+void InitialInstancesContainer::Init(const InitialInstancesContainer& other) {
+  initialInstances = gd::Clone(other.initialInstances);
+}
+
 InitialInstancesContainer::~InitialInstancesContainer() {}
 
 std::size_t InitialInstancesContainer::GetInstancesCount() const {
@@ -27,24 +45,24 @@ std::size_t InitialInstancesContainer::GetInstancesCount() const {
 void InitialInstancesContainer::UnserializeFrom(
     const SerializerElement& element) {
   initialInstances.clear();
-
   element.ConsiderAsArrayOf("instance", "Objet");
+  initialInstances.reserve(element.GetChildrenCount());
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
-    gd::InitialInstance instance;
-    instance.UnserializeFrom(element.GetChild(i));
-    initialInstances.push_back(instance);
+    auto instance = gd::make_unique<gd::InitialInstance>();
+    instance->UnserializeFrom(element.GetChild(i));
+    initialInstances.push_back(std::move(instance));
   }
 }
 
 void InitialInstancesContainer::IterateOverInstances(
     gd::InitialInstanceFunctor& func) {
-  for (auto& instance : initialInstances) func(instance);
+  for (auto& instance : initialInstances) func(*instance);
 }
 
 void InitialInstancesContainer::IterateOverInstances(
   const std::function< bool(gd::InitialInstance &) >& func) {
   for (auto& instance : initialInstances) {
-    bool shouldStop = func(instance);
+    bool shouldStop = func(*instance);
     if (shouldStop) {
       return;
     }
@@ -53,43 +71,41 @@ void InitialInstancesContainer::IterateOverInstances(
 
 void InitialInstancesContainer::IterateOverInstancesWithZOrdering(
     gd::InitialInstanceFunctor& func, const gd::String& layerName) {
-  std::vector<std::reference_wrapper<gd::InitialInstance>> sortedInstances;
-  std::copy_if(initialInstances.begin(),
-               initialInstances.end(),
-               std::inserter(sortedInstances, sortedInstances.begin()),
-               [&layerName](InitialInstance& instance) {
-                 return instance.GetLayer() == layerName;
-               });
+  gd::Symbol layer;
+  if (!gd::Symbol::FindInterned(layerName, layer)) return;
+
+  std::vector<gd::InitialInstance*> sortedInstances;
+  for (auto& instance : initialInstances) {
+    if (instance->GetLayerSymbol() == layer)
+      sortedInstances.push_back(instance.get());
+  }
 
   std::sort(sortedInstances.begin(),
             sortedInstances.end(),
-            [](gd::InitialInstance& a, gd::InitialInstance& b) {
-              return a.GetZOrder() < b.GetZOrder();
+            [](gd::InitialInstance* a, gd::InitialInstance* b) {
+              return a->GetZOrder() < b->GetZOrder();
             });
 
-  for (auto& instance : sortedInstances) func(instance);
+  for (auto instance : sortedInstances) func(*instance);
 }
 
 gd::InitialInstance& InitialInstancesContainer::InsertNewInitialInstance() {
-  gd::InitialInstance newInstance;
-  initialInstances.push_back(newInstance);
-
-  return initialInstances.back();
+  initialInstances.push_back(gd::make_unique<gd::InitialInstance>());
+  return *initialInstances.back();
 }
 
 void InitialInstancesContainer::RemoveInstanceIf(
     std::function<bool(const gd::InitialInstance&)> predicate) {
-  // Note that we can't use erase–remove idiom here because remove_if would
-  // move the instances, and the container must guarantee that
-  // iterators/pointers to instances always remain valid.
-  for (std::list<gd::InitialInstance>::iterator it = initialInstances.begin(),
-                                                end = initialInstances.end();
-       it != end;) {
-    if (predicate(*it))
-      it = initialInstances.erase(it);
-    else
-      ++it;
-  }
+  // Only the pointers to the instances are moved by remove_if, so pointers
+  // to the remaining instances stay valid.
+  initialInstances.erase(
+      std::remove_if(initialInstances.begin(),
+                     initialInstances.end(),
+                     [&predicate](
+                         const std::unique_ptr<gd::InitialInstance>& instance) {
+                       return predicate(*instance);
+                     }),
+      initialInstances.end());
 }
 
 void InitialInstancesContainer::RemoveInstance(
@@ -104,9 +120,9 @@ gd::InitialInstance& InitialInstancesContainer::InsertInitialInstance(
   try {
     const gd::InitialInstance& castedInstance =
         dynamic_cast<const gd::InitialInstance&>(instance);
-    initialInstances.push_back(castedInstance);
-
-    return initialInstances.back();
+    initialInstances.push_back(
+        gd::make_unique<gd::InitialInstance>(castedInstance));
+    return *initialInstances.back();
   } catch (...) {
     std::cout
         << "WARNING: Tried to add an gd::InitialInstance which is not a GD C++ "
@@ -118,37 +134,56 @@ gd::InitialInstance& InitialInstancesContainer::InsertInitialInstance(
 
 void InitialInstancesContainer::RenameInstancesOfObject(
     const gd::String& oldName, const gd::String& newName) {
-  for (gd::InitialInstance& instance : initialInstances) {
-    if (instance.GetObjectName() == oldName) instance.SetObjectName(newName);
+  gd::Symbol oldObjectName;
+  if (!gd::Symbol::FindInterned(oldName, oldObjectName)) return;
+
+  gd::Symbol newObjectName(newName);
+  for (auto& instance : initialInstances) {
+    if (instance->GetObjectNameSymbol() == oldObjectName)
+      instance->SetObjectName(newObjectName);
   }
 }
 
 void InitialInstancesContainer::RemoveInitialInstancesOfObject(
     const gd::String& objectName) {
-  RemoveInstanceIf([&objectName](const InitialInstance& currentInstance) {
-    return currentInstance.GetObjectName() == objectName;
+  gd::Symbol object;
+  if (!gd::Symbol::FindInterned(objectName, object)) return;
+
+  RemoveInstanceIf([&object](const InitialInstance& currentInstance) {
+    return currentInstance.GetObjectNameSymbol() == object;
   });
 }
 
 void InitialInstancesContainer::RemoveAllInstancesOnLayer(
     const gd::String& layerName) {
-  RemoveInstanceIf([&layerName](const InitialInstance& currentInstance) {
-    return currentInstance.GetLayer() == layerName;
+  gd::Symbol layer;
+  if (!gd::Symbol::FindInterned(layerName, layer)) return;
+
+  RemoveInstanceIf([&layer](const InitialInstance& currentInstance) {
+    return currentInstance.GetLayerSymbol() == layer;
   });
 }
 
 void InitialInstancesContainer::MoveInstancesToLayer(
     const gd::String& fromLayer, const gd::String& toLayer) {
-  for (gd::InitialInstance& instance : initialInstances) {
-    if (instance.GetLayer() == fromLayer) instance.SetLayer(toLayer);
+  gd::Symbol fromLayerSymbol;
+  if (!gd::Symbol::FindInterned(fromLayer, fromLayerSymbol)) return;
+
+  gd::Symbol toLayerSymbol(toLayer);
+  for (auto& instance : initialInstances) {
+    if (instance->GetLayerSymbol() == fromLayerSymbol)
+      instance->SetLayer(toLayerSymbol);
   }
 }
 
 std::size_t InitialInstancesContainer::GetLayerInstancesCount(
     const gd::String &layerName) const {
+  gd::Symbol layer;
+  if (!gd::Symbol::FindInterned(layerName, layer)) return 0;
+
   std::size_t count = 0;
-  for (const gd::InitialInstance &instance : initialInstances) {
-    if (instance.GetLayer() == layerName) {
+  for (const auto &instance : initialInstances) {
+    if (instance->GetLayerSymbol() == layer) {
       count++;
     }
   }
@@ -157,27 +192,38 @@ std::size_t InitialInstancesContainer::GetLayerInstancesCount(
 
 bool InitialInstancesContainer::SomeInstancesAreOnLayer(
     const gd::String& layerName) const {
-  return std::any_of(initialInstances.begin(),
-                     initialInstances.end(),
-                     [&layerName](const InitialInstance& currentInstance) {
-                       return currentInstance.GetLayer() == layerName;
-                     });
+  gd::Symbol layer;
+  if (!gd::Symbol::FindInterned(layerName, layer)) return false;
+
+  return std::any_of(
+      initialInstances.begin(),
+      initialInstances.end(),
+      [&layer](const std::unique_ptr<InitialInstance>& currentInstance) {
+        return currentInstance->GetLayerSymbol() == layer;
+      });
 }
 
 bool InitialInstancesContainer::HasInstancesOfObject(
     const gd::String& objectName) const {
-  return std::any_of(initialInstances.begin(),
-                     initialInstances.end(),
-                     [&objectName](const InitialInstance& currentInstance) {
-                       return currentInstance.GetObjectName() == objectName;
-                     });
+  gd::Symbol object;
+  if (!gd::Symbol::FindInterned(objectName, object)) return false;
+
+  return std::any_of(
+      initialInstances.begin(),
+      initialInstances.end(),
+      [&object](const std::unique_ptr<InitialInstance>& currentInstance) {
+        return currentInstance->GetObjectNameSymbol() == object;
+      });
 }
 
 bool InitialInstancesContainer::IsInstancesCountOfObjectGreaterThan(
     const gd::String &objectName, const std::size_t minInstanceCount) const {
+  gd::Symbol object;
+  if (!gd::Symbol::FindInterned(objectName, object)) return false;
+
   std::size_t count = 0;
-  for (const gd::InitialInstance &instance : initialInstances) {
-    if (instance.GetObjectName() == objectName) {
+  for (const auto &instance : initialInstances) {
+    if (instance->GetObjectNameSymbol() == object) {
       count++;
       if (count > minInstanceCount) {
         return true;
@@ -202,8 +248,8 @@ void InitialInstancesContainer::Create(
 
 void InitialInstancesContainer::SerializeTo(SerializerElement& element) const {
   element.ConsiderAsArrayOf("instance");
-  for (auto instance : initialInstances)
-    instance.SerializeTo(element.AddChild("instance"));
+  for (const auto& instance : initialInstances)
+    instance->SerializeTo(element.AddChild("instance"));
 }
 
 void InitialInstancesContainer::Clear() { initialInstances.clear(); }
@@ -6,7 +6,9 @@
 
 #pragma once
 
-#include <list>
+#include <functional>
+#include <memory>
+#include <vector>
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -28,16 +30,21 @@ namespace gd {
  * to the elements of the container are not invalidated when
  * a change occurs (through InsertNewInitialInstance or RemoveInstance
  * for example). <br>
- * Thus, the implementations uses a std::list
- * for holding the instances. In this way, the container is not required
- * to provide a direct access to element based on an index. Instead,
- * the method IterateOverInstances is used to perform operations.
+ * Thus, the implementations stores each instance in its own allocation,
+ * and keeps a contiguous array of the instances in their insertion order. The
+ * container is not required to provide a direct access to element based on an
+ * index. Instead, the method IterateOverInstances is used to perform
+ * operations.
+ *
+ * \see gd::InitialInstancesSpatialIndex to find instances in a rectangle.
  *
  * \see gd::InitialInstanceFunctor
  */
 class GD_CORE_API InitialInstancesContainer {
  public:
   InitialInstancesContainer(){};
+  InitialInstancesContainer(const InitialInstancesContainer &other);
+  InitialInstancesContainer &operator=(const InitialInstancesContainer &other);
   virtual ~InitialInstancesContainer();
 
   /**
@@ -194,7 +201,9 @@ class GD_CORE_API InitialInstancesContainer {
   void RemoveInstanceIf(
       std::function<bool(const gd::InitialInstance &)> predicate);
 
-  std::list<gd::InitialInstance> initialInstances;
+  void Init(const InitialInstancesContainer &other);
+
+  std::vector<std::unique_ptr<gd::InitialInstance>> initialInstances;
 
   static gd::InitialInstance badPosition;
 };
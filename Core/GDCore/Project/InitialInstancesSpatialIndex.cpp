@@ -0,0 +1,112 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/InitialInstancesSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+
+namespace gd {
+
+InitialInstancesSpatialIndex::InitialInstancesSpatialIndex(double cellSize_)
+    : cellSize(cellSize_ > 0 ? cellSize_ : 256) {}
+
+void InitialInstancesSpatialIndex::Build(
+    gd::InitialInstancesContainer &instances) {
+  Clear();
+  instances.IterateOverInstances([this](gd::InitialInstance &instance) {
+    LayerIndex &layerIndex = layers[instance.GetLayer()];
+    layerIndex.cells[GetCellKey(GetCellCoordinate(instance.GetX()),
+                                GetCellCoordinate(instance.GetY()))]
+        .push_back(&instance);
+    layerIndex.instancesCount++;
+    return false;
+  });
+}
+
+void InitialInstancesSpatialIndex::Clear() { layers.clear(); }
+
+std::size_t InitialInstancesSpatialIndex::GetLayerInstancesCount(
+    const gd::String &layerName) const {
+  auto it = layers.find(layerName);
+  return it != layers.end() ? it->second.instancesCount : 0;
+}
+
+std::vector<gd::InitialInstance *>
+InitialInstancesSpatialIndex::GetInstancesInRectangle(
+    const gd::String &layerName,
+    double left,
+    double top,
+    double right,
+    double bottom) const {
+  std::vector<gd::InitialInstance *> foundInstances;
+  auto it = layers.find(layerName);
+  if (it == layers.end() || left > right || top > bottom)
+    return foundInstances;
+
+  const LayerIndex &layerIndex = it->second;
+  auto addIfInRectangle = [&](const std::vector<gd::InitialInstance *> &cell) {
+    for (gd::InitialInstance *instance : cell) {
+      if (instance->GetX() >= left && instance->GetX() <= right &&
+          instance->GetY() >= top && instance->GetY() <= bottom)
+        foundInstances.push_back(instance);
+    }
+  };
+
+  const std::int64_t firstCellX = GetCellCoordinate(left);
+  const std::int64_t lastCellX = GetCellCoordinate(right);
+  const std::int64_t firstCellY = GetCellCoordinate(top);
+  const std::int64_t lastCellY = GetCellCoordinate(bottom);
+  const double cellsCount = double(lastCellX - firstCellX + 1) *
+                            double(lastCellY - firstCellY + 1);
+  if (cellsCount > layerIndex.cells.size()) {
+    // The rectangle covers more cells than the ones containing instances.
+    for (const auto &cell : layerIndex.cells) addIfInRectangle(cell.second);
+  } else {
+    for (std::int64_t cellY = firstCellY; cellY <= lastCellY; ++cellY) {
+      for (std::int64_t cellX = firstCellX; cellX <= lastCellX; ++cellX) {
+        auto cellIt = layerIndex.cells.find(GetCellKey(cellX, cellY));
+        if (cellIt != layerIndex.cells.end()) addIfInRectangle(cellIt->second);
+      }
+    }
+  }
+
+  return foundInstances;
+}
+
+void InitialInstancesSpatialIndex::IterateOverInstancesInRectangle(
+    gd::InitialInstanceFunctor &func,
+    const gd::String &layerName,
+    double left,
+    double top,
+    double right,
+    double bottom) const {
+  for (gd::InitialInstance *instance :
+       GetInstancesInRectangle(layerName, left, top, right, bottom))
+    func(*instance);
+}
+
+std::int32_t InitialInstancesSpatialIndex::GetCellCoordinate(
+    double position) const {
+  double cellCoordinate = std::floor(position / cellSize);
+  if (!(cellCoordinate > std::numeric_limits<std::int32_t>::min()))
+    return std::numeric_limits<std::int32_t>::min();
+  if (cellCoordinate > std::numeric_limits<std::int32_t>::max())
+    return std::numeric_limits<std::int32_t>::max();
+
+  return static_cast<std::int32_t>(cellCoordinate);
+}
+
+std::uint64_t InitialInstancesSpatialIndex::GetCellKey(std::int32_t cellX,
+                                                       std::int32_t cellY) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX)) << 32) |
+         static_cast<std::uint32_t>(cellY);
+}
+
+}  // namespace gd
@@ -0,0 +1,99 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class InitialInstance;
+class InitialInstanceFunctor;
+class InitialInstancesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A grid indexing the positions of the instances of a
+ * gd::InitialInstancesContainer, by layer, to find the instances of a layer
+ * in a rectangle without iterating on all the instances.
+ *
+ * The index is not updated automatically: it must be built again (with
+ * Build) when instances are added, removed, moved or changed of layer.
+ *
+ * \see gd::InitialInstancesContainer
+ */
+class GD_CORE_API InitialInstancesSpatialIndex {
+ public:
+  /**
+   * \brief Create an empty index.
+   * \param cellSize The size of the cells of the grid. It should be a bit
+   * larger than most of the instances.
+   */
+  InitialInstancesSpatialIndex(double cellSize = 256);
+  virtual ~InitialInstancesSpatialIndex(){};
+
+  /**
+   * \brief Index all the instances of the container, replacing what was
+   * indexed before.
+   */
+  void Build(gd::InitialInstancesContainer &instances);
+
+  /**
+   * \brief Remove all the instances from the index.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of indexed instances on the layer.
+   */
+  std::size_t GetLayerInstancesCount(const gd::String &layerName) const;
+
+  /**
+   * \brief Return the instances of the layer with a position inside the
+   * rectangle (bounds included), in no particular order.
+   *
+   * The size of the instances is not known by the index: to find the
+   * instances overlapping a rectangle, enlarge the rectangle by the size of
+   * the largest instance.
+   */
+  std::vector<gd::InitialInstance *> GetInstancesInRectangle(
+      const gd::String &layerName,
+      double left,
+      double top,
+      double right,
+      double bottom) const;
+
+  /**
+   * \brief Apply \a func to the instances of the layer with a position inside
+   * the rectangle.
+   *
+   * \see GetInstancesInRectangle
+   */
+  void IterateOverInstancesInRectangle(gd::InitialInstanceFunctor &func,
+                                       const gd::String &layerName,
+                                       double left,
+                                       double top,
+                                       double right,
+                                       double bottom) const;
+
+ private:
+  struct LayerIndex {
+    std::unordered_map<std::uint64_t, std::vector<gd::InitialInstance *>>
+        cells;  ///< The instances, by the key of their cell.
+    std::size_t instancesCount = 0;
+  };
+
+  std::int32_t GetCellCoordinate(double position) const;
+  static std::uint64_t GetCellKey(std::int32_t cellX, std::int32_t cellY);
+
+  double cellSize;
+  std::unordered_map<gd::String, LayerIndex> layers;
+};
+
+}  // namespace gd
@@ -29,6 +29,7 @@
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
 #include "GDCore/Tools/PolymorphicClone.h"
+#include "GDCore/Tools/UUID/UUID.h"
 
 using namespace std;
 
@@ -64,6 +65,7 @@ Layout::Layout()
 void Layout::SetName(const gd::String& name_) {
   name = name_;
   mangledName = gd::SceneNameMangler::Get()->GetMangledSceneName(name);
+  namesIndexLink.NotifyNameChanged();
 };
 
 bool Layout::HasBehaviorSharedData(const gd::String& behaviorName) {
@@ -240,6 +242,8 @@ std::unique_ptr<gd::BehaviorsSharedData> Layout::CreateBehaviorsSharedData(
 void Layout::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("name", GetName());
   element.SetAttribute("mangledName", GetMangledName());
+  if (!persistentUuid.empty())
+    element.SetStringAttribute("persistentUuid", persistentUuid);
   element.SetAttribute("r", (int)GetBackgroundColorRed());
   element.SetAttribute("v", (int)GetBackgroundColorGreen());
   element.SetAttribute("b", (int)GetBackgroundColorBlue());
@@ -303,6 +307,7 @@ void Layout::SerializeTo(SerializerElement& element) const {
 
 void Layout::UnserializeFrom(gd::Project& project,
                              const SerializerElement& element) {
+  persistentUuid = element.GetStringAttribute("persistentUuid");
   SetBackgroundColor(element.GetIntAttribute("r"),
                      element.GetIntAttribute("v"),
                      element.GetIntAttribute("b"));
@@ -395,6 +400,7 @@ void Layout::UnserializeFrom(gd::Project& project,
 
 void Layout::Init(const Layout& other) {
   SetName(other.name);
+  persistentUuid = other.persistentUuid;
   backgroundColorR = other.backgroundColorR;
   backgroundColorG = other.backgroundColorG;
   backgroundColorB = other.backgroundColorB;
@@ -420,6 +426,16 @@ void Layout::Init(const Layout& other) {
   editorSettings = other.editorSettings;
 }
 
+Layout& Layout::ResetPersistentUuid() {
+  persistentUuid = UUID::MakeUuid4();
+  return *this;
+}
+
+Layout& Layout::ClearPersistentUuid() {
+  persistentUuid = "";
+  return *this;
+}
+
 std::vector<gd::String> GetHiddenLayers(const Layout& layout) {
   std::vector<gd::String> hiddenLayers;
   for (std::size_t i = 0; i < layout.GetLayersCount(); ++i) {
@@ -453,7 +469,7 @@ gd::String GD_CORE_API GetTypeOfObject(const gd::ObjectsContainer& project,
         // A group has the name searched
         // Verifying now that all objects have the same type.
 
-        vector<gd::String> groupsObjects =
+        const vector<gd::String>& groupsObjects =
             layout.GetObjectGroups()[i].GetAllObjectsNames();
         gd::String previousType =
             groupsObjects.empty()
@@ -478,7 +494,7 @@ gd::String GD_CORE_API GetTypeOfObject(const gd::ObjectsContainer& project,
         // A group has the name searched
         // Verifying now that all objects have the same type.
 
-        vector<gd::String> groupsObjects =
+        const vector<gd::String>& groupsObjects =
             project.GetObjectGroups()[i].GetAllObjectsNames();
         gd::String previousType =
             groupsObjects.empty()
@@ -799,7 +815,7 @@ GetBehaviorsOfObject(const gd::ObjectsContainer& project,
         // A group has the name searched
         // Verifying now that all objects have common behaviors.
 
-        vector<gd::String> groupsObjects =
+        const vector<gd::String>& groupsObjects =
             layout.GetObjectGroups()[i].GetAllObjectsNames();
         for (std::size_t j = 0; j < groupsObjects.size(); ++j) {
           // Get behaviors of the object of the group and delete behavior which
@@ -827,7 +843,7 @@ GetBehaviorsOfObject(const gd::ObjectsContainer& project,
         // A group has the name searched
         // Verifying now that all objects have common behaviors.
 
-        vector<gd::String> groupsObjects =
+        const vector<gd::String>& groupsObjects =
             project.GetObjectGroups()[i].GetAllObjectsNames();
         for (std::size_t j = 0; j < groupsObjects.size(); ++j) {
           // Get behaviors of the object of the group and delete behavior which
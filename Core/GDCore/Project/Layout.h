@@ -20,6 +20,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamesIndex.h"
 
 namespace gd {
 class BaseEvent;
@@ -64,6 +65,14 @@ class GD_CORE_API Layout {
    */
   const gd::String& GetName() const { return name; };
 
+  /**
+   * \brief Return the link used to invalidate the index of the names of the
+   * container of the layout when it's renamed.
+   */
+  const gd::NamesIndexLink& GetNamesIndexLink() const {
+    return namesIndexLink;
+  }
+
   /**
    * Return the name of the layout mangled by SceneNameMangler.
    */
@@ -103,6 +112,24 @@ class GD_CORE_API Layout {
    */
   void SetWindowDefaultTitle(const gd::String& title_) { title = title_; };
 
+  /**
+   * \brief Reset the persistent UUID, used to recognize
+   * the same layout between serialization.
+   */
+  Layout& ResetPersistentUuid();
+
+  /**
+   * \brief Remove the persistent UUID - when the layout no
+   * longer need to be recognized between serializations.
+   */
+  Layout& ClearPersistentUuid();
+
+  /**
+   * \brief Get the persistent UUID used to recognize
+   * the same layout between serialization.
+   */
+  const gd::String& GetPersistentUuid() const { return persistentUuid; };
+
   ///@}
 
   /** \name Layout's objects
@@ -426,6 +453,9 @@ class GD_CORE_API Layout {
 
   EventsList events;  ///< Scene events
   gd::EditorSettings editorSettings;
+  gd::String persistentUuid;  ///< A persistent random version 4 UUID,
+                              ///< useful for computing changesets.
+  gd::NamesIndexLink namesIndexLink;
 
   /**
    * Initialize from another layout. Used by copy-ctor and assign-op.
@@ -11,6 +11,7 @@
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/CustomBehavior.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Project/QuickCustomization.h"
@@ -52,6 +53,19 @@ void Object::CopyWithoutConfiguration(const gd::Object& object) {
   objectVariables = object.objectVariables;
   effectsContainer = object.effectsContainer;
   behaviors = gd::Clone(object.behaviors);
+  namesIndexLink.NotifyNameChanged();
+  gd::ObjectsContainer::NotifyObjectsChanged();
+}
+
+void Object::SetName(const gd::String& name_) {
+  name = name_;
+  namesIndexLink.NotifyNameChanged();
+  gd::ObjectsContainer::NotifyObjectsChanged();
+}
+
+void Object::SetType(const gd::String& type_) {
+  configuration->SetType(type_);
+  gd::ObjectsContainer::NotifyObjectsChanged();
 }
 
 gd::ObjectConfiguration& Object::GetConfiguration() { return *configuration; }
@@ -68,7 +82,10 @@ std::vector<gd::String> Object::GetAllBehaviorNames() const {
   return allNameIdentifiers;
 }
 
-void Object::RemoveBehavior(const gd::String& name) { behaviors.erase(name); }
+void Object::RemoveBehavior(const gd::String& name) {
+  behaviors.erase(name);
+  gd::ObjectsContainer::NotifyObjectsChanged();
+}
 
 bool Object::RenameBehavior(const gd::String& name, const gd::String& newName) {
   if (behaviors.find(name) == behaviors.end() ||
@@ -79,6 +96,7 @@ bool Object::RenameBehavior(const gd::String& name, const gd::String& newName) {
   behaviors.erase(name);
   behaviors[newName] = std::move(aut);
   behaviors[newName]->SetName(newName);
+  gd::ObjectsContainer::NotifyObjectsChanged();
 
   return true;
 }
@@ -102,6 +120,7 @@ gd::Behavior* Object::AddNewBehavior(const gd::Project& project,
                            &name](std::unique_ptr<gd::Behavior> behavior) {
     behavior->InitializeContent();
     this->behaviors[name] = std::move(behavior);
+    gd::ObjectsContainer::NotifyObjectsChanged();
     return this->behaviors[name].get();
   };
 
@@ -213,6 +232,8 @@ void Object::UnserializeFrom(gd::Project& project,
   }
 
   configuration->UnserializeFrom(project, element);
+  namesIndexLink.NotifyNameChanged();
+  gd::ObjectsContainer::NotifyObjectsChanged();
 }
 
 void Object::SerializeTo(SerializerElement& element) const {
@@ -15,6 +15,7 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/NamesIndex.h"
 #include "GDCore/Vector2.h"
 
 namespace gd {
@@ -98,12 +99,20 @@ class GD_CORE_API Object {
 
   /** \brief Change the name of the object with the name passed as parameter.
    */
-  void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_);
 
   /** \brief Return the name of the object.
    */
   const gd::String& GetName() const { return name; };
 
+  /**
+   * \brief Return the link used to invalidate the index of the names of the
+   * container of the object when it's renamed.
+   */
+  const gd::NamesIndexLink& GetNamesIndexLink() const {
+    return namesIndexLink;
+  }
+
   /** \brief Change the asset store id of the object.
    */
   void SetAssetStoreId(const gd::String& assetStoreId_) {
@@ -116,7 +125,7 @@ class GD_CORE_API Object {
 
   /** \brief Change the type of the object.
    */
-  void SetType(const gd::String& type_) { configuration->SetType(type_); }
+  void SetType(const gd::String& type_);
 
   /** \brief Return the type of the object.
    */
@@ -263,6 +272,7 @@ class GD_CORE_API Object {
       effectsContainer;  ///< The effects container for the object.
   mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
                                       ///< useful for computing changesets.
+  gd::NamesIndexLink namesIndexLink;
 
   /**
    * Initialize object using another object. Used by copy-ctor and assign-op.
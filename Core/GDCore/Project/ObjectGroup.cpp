@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <vector>
 
+#include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 
@@ -23,12 +24,14 @@ bool ObjectGroup::Find(const gd::String& name) const {
 
 void ObjectGroup::AddObject(const gd::String& name) {
   if (!Find(name)) memberObjects.push_back(name);
+  gd::ObjectsContainer::NotifyObjectsChanged();
 }
 
 void ObjectGroup::RemoveObject(const gd::String& name) {
   memberObjects.erase(
       std::remove(memberObjects.begin(), memberObjects.end(), name),
       memberObjects.end());
+  gd::ObjectsContainer::NotifyObjectsChanged();
 }
 
 void ObjectGroup::RenameObject(const gd::String& oldName,
@@ -36,6 +39,12 @@ void ObjectGroup::RenameObject(const gd::String& oldName,
   for (auto& object : memberObjects) {
     if (object == oldName) object = newName;
   }
+  gd::ObjectsContainer::NotifyObjectsChanged();
+}
+
+void ObjectGroup::SetName(const gd::String& name_) {
+  name = name_;
+  gd::ObjectsContainer::NotifyObjectsChanged();
 }
 
 void ObjectGroup::SerializeTo(SerializerElement& element) const {
@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/MakeUnique.h"
@@ -35,6 +36,7 @@ void ObjectGroupsContainer::Init(const ObjectGroupsContainer& other) {
   for (auto& it : other.objectGroups) {
     objectGroups.push_back(gd::make_unique<gd::ObjectGroup>(*it));
   }
+  gd::ObjectsContainer::NotifyObjectsChanged();
 }
 
 void ObjectGroupsContainer::SerializeTo(SerializerElement& element) const {
@@ -106,6 +108,7 @@ void ObjectGroupsContainer::Remove(const gd::String& name) {
                        return group->GetName() == name;
                      }),
       objectGroups.end());
+  gd::ObjectsContainer::NotifyObjectsChanged();
 }
 
 std::size_t ObjectGroupsContainer::GetPosition(const gd::String& name) const {
@@ -132,6 +135,7 @@ ObjectGroup& ObjectGroupsContainer::Insert(const gd::ObjectGroup& group,
       position < objectGroups.size() ? objectGroups.begin() + position
                                      : objectGroups.end(),
       gd::make_unique<gd::ObjectGroup>(group))));
+  gd::ObjectsContainer::NotifyObjectsChanged();
   return newlyInsertedGroup;
 }
 
@@ -162,6 +166,11 @@ void ObjectGroupsContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
   objectGroups.insert(objectGroups.begin() + newIndex, std::move(objectGroup));
 }
 
+void ObjectGroupsContainer::Clear() {
+  objectGroups.clear();
+  gd::ObjectsContainer::NotifyObjectsChanged();
+}
+
 void ObjectGroupsContainer::ForEachNameMatchingSearch(
     const gd::String& search,
     std::function<void(const gd::String& name)> fn) const {
@@ -115,7 +115,7 @@ class GD_CORE_API ObjectGroupsContainer {
   /**
    * \brief Clear all groups of the container.
    */
-  inline void Clear() { objectGroups.clear(); }
+  void Clear();
 
   /**
    * \brief Call the callback for each group name matching the specified search.
@@ -16,6 +16,8 @@
 
 namespace gd {
 
+std::atomic<std::size_t> ObjectsContainer::objectsChangesCount(0);
+
 ObjectsContainer::ObjectsContainer(
     const ObjectsContainer::SourceType sourceType_)
     : sourceType(sourceType_) {
@@ -37,10 +39,12 @@ ObjectsContainer& ObjectsContainer::operator=(const ObjectsContainer& other) {
 void ObjectsContainer::Init(const gd::ObjectsContainer& other) {
   sourceType = other.sourceType;
   initialObjects = gd::Clone(other.initialObjects);
+  objectsIndex.Invalidate();
   objectGroups = other.objectGroups;
   // The objects folders are not copied.
   // It's not an issue because the UI uses the serialization for duplication.
   rootFolder = gd::make_unique<gd::ObjectFolderOrObject>("__ROOT");
+  NotifyObjectsChanged();
 }
 
 void ObjectsContainer::SerializeObjectsTo(SerializerElement& element) const {
@@ -84,28 +88,18 @@ void ObjectsContainer::UnserializeObjectsFrom(
       std::cout << "WARNING: Unknown object type \"" << type << "\""
                 << std::endl;
   }
+  objectsIndex.Invalidate();
+  NotifyObjectsChanged();
 }
 
 bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
-  return (find_if(initialObjects.begin(),
-                  initialObjects.end(),
-                  [&](const std::unique_ptr<gd::Object>& object) {
-                    return object->GetName() == name;
-                  }) != initialObjects.end());
+  return GetObjectPosition(name) != gd::String::npos;
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    [&](const std::unique_ptr<gd::Object>& object) {
-                      return object->GetName() == name;
-                    }));
+  return *initialObjects[GetObjectPosition(name)];
 }
 const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    [&](const std::unique_ptr<gd::Object>& object) {
-                      return object->GetName() == name;
-                    }));
+  return *initialObjects[GetObjectPosition(name)];
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
   return *initialObjects[index];
@@ -114,10 +108,13 @@ const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
   return *initialObjects[index];
 }
 std::size_t ObjectsContainer::GetObjectPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < initialObjects.size(); ++i) {
-    if (initialObjects[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return objectsIndex.Find(
+      name,
+      initialObjects.size(),
+      [this](std::size_t index) { return initialObjects[index]->GetName(); },
+      [this](std::size_t index) {
+        return &initialObjects[index]->GetNamesIndexLink();
+      });
 }
 std::size_t ObjectsContainer::GetObjectsCount() const {
   return initialObjects.size();
@@ -126,12 +123,21 @@ gd::Object& ObjectsContainer::InsertNewObject(const gd::Project& project,
                                               const gd::String& objectType,
                                               const gd::String& name,
                                               std::size_t position) {
+  bool isAppended = position >= initialObjects.size();
+  bool wasIndexUpToDate = objectsIndex.IsUpToDate();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
-      position < initialObjects.size() ? initialObjects.begin() + position
-                                       : initialObjects.end(),
+      isAppended ? initialObjects.end() : initialObjects.begin() + position,
       project.CreateObject(objectType, name))));
+  if (isAppended)
+    objectsIndex.Append(newlyCreatedObject.GetName(),
+                        initialObjects.size() - 1,
+                        wasIndexUpToDate,
+                        &newlyCreatedObject.GetNamesIndexLink());
+  else
+    objectsIndex.Invalidate();
 
   rootFolder->InsertObject(&newlyCreatedObject);
+  NotifyObjectsChanged();
 
   return newlyCreatedObject;
 }
@@ -142,20 +148,35 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
     const gd::String& name,
     gd::ObjectFolderOrObject& objectFolderOrObject,
     std::size_t position) {
+  bool wasIndexUpToDate = objectsIndex.IsUpToDate();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       initialObjects.end(), project.CreateObject(objectType, name))));
+  objectsIndex.Append(newlyCreatedObject.GetName(),
+                      initialObjects.size() - 1,
+                      wasIndexUpToDate,
+                      &newlyCreatedObject.GetNamesIndexLink());
 
   objectFolderOrObject.InsertObject(&newlyCreatedObject, position);
+  NotifyObjectsChanged();
 
   return newlyCreatedObject;
 }
 
 gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
                                            std::size_t position) {
+  bool isAppended = position >= initialObjects.size();
+  bool wasIndexUpToDate = objectsIndex.IsUpToDate();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
-      position < initialObjects.size() ? initialObjects.begin() + position
-                                       : initialObjects.end(),
+      isAppended ? initialObjects.end() : initialObjects.begin() + position,
       std::unique_ptr<gd::Object>(object.Clone()))));
+  if (isAppended)
+    objectsIndex.Append(newlyCreatedObject.GetName(),
+                        initialObjects.size() - 1,
+                        wasIndexUpToDate,
+                        &newlyCreatedObject.GetNamesIndexLink());
+  else
+    objectsIndex.Invalidate();
+  NotifyObjectsChanged();
 
   return newlyCreatedObject;
 }
@@ -167,25 +188,25 @@ void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
   initialObjects.insert(initialObjects.begin() + newIndex, std::move(object));
+  objectsIndex.Invalidate();
 }
 
 void ObjectsContainer::RemoveObject(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Object>>::iterator objectIt =
-      find_if(initialObjects.begin(),
-              initialObjects.end(),
-              [&](const std::unique_ptr<gd::Object>& object) {
-                return object->GetName() == name;
-              });
-  if (objectIt == initialObjects.end()) return;
+  std::size_t position = GetObjectPosition(name);
+  if (position == gd::String::npos) return;
 
   rootFolder->RemoveRecursivelyObjectNamed(name);
 
-  initialObjects.erase(objectIt);
+  initialObjects.erase(initialObjects.begin() + position);
+  objectsIndex.Invalidate();
+  NotifyObjectsChanged();
 }
 
 void ObjectsContainer::Clear() {
   rootFolder->Clear();
   initialObjects.clear();
+  objectsIndex.Invalidate();
+  NotifyObjectsChanged();
 }
 
 void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
@@ -207,11 +228,20 @@ void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
   initialObjects.erase(objectIt);
 
   newContainer.initialObjects.push_back(std::move(object));
+  objectsIndex.Invalidate();
+  newContainer.objectsIndex.Invalidate();
+  NotifyObjectsChanged();
 
   objectFolderOrObject.GetParent().MoveObjectFolderOrObjectToAnotherFolder(
       objectFolderOrObject, newParentFolder, newPosition);
 }
 
+std::size_t ObjectsContainer::GetObjectsChangesCount() {
+  return objectsChangesCount;
+}
+
+void ObjectsContainer::NotifyObjectsChanged() { objectsChangesCount++; }
+
 std::set<gd::String> ObjectsContainer::GetAllObjectNames() const {
   std::set<gd::String> names;
   for (const auto& object : initialObjects) {
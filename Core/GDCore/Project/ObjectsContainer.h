@@ -5,12 +5,14 @@
  */
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <set>
 #include "GDCore/String.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/ObjectFolderOrObject.h"
+#include "GDCore/Tools/NamesIndex.h"
 namespace gd {
 class Object;
 class Project;
@@ -244,6 +246,29 @@ class GD_CORE_API ObjectsContainer {
 
   ///@}
 
+  /** \name Changes tracking
+   * Members functions used to invalidate caches of objects and groups.
+   */
+  ///@{
+
+  /**
+   * \brief Return a number that is incremented each time an object or a group
+   * of any container is added, removed, renamed or modified in a way that can
+   * change its type, its behaviors or its members.
+   *
+   * \see gd::ObjectsContainersList, which caches the resolution of objects and
+   * groups names until this number changes.
+   */
+  static std::size_t GetObjectsChangesCount();
+
+  /**
+   * \brief Increment the number returned by GetObjectsChangesCount.
+   *
+   * Called by objects, groups and containers when they are modified.
+   */
+  static void NotifyObjectsChanged();
+  ///@}
+
  protected:
   std::vector<std::unique_ptr<gd::Object> >
       initialObjects;  ///< Objects contained.
@@ -252,6 +277,9 @@ class GD_CORE_API ObjectsContainer {
  private:
   SourceType sourceType = Unknown;
   std::unique_ptr<gd::ObjectFolderOrObject> rootFolder;
+  gd::NamesIndex objectsIndex;  ///< Positions of objects in initialObjects.
+
+  static std::atomic<std::size_t> objectsChangesCount;
 
   /**
    * Initialize from another variables container, copying elements. Used by
@@ -1,15 +1,35 @@
 #include "ObjectsContainersList.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
 
+namespace {
+
+void KeepBehaviorNamesOfType(const gd::Object& object,
+                             const gd::String& behaviorType,
+                             std::vector<gd::String>& behaviorNames) {
+  behaviorNames.erase(
+      std::remove_if(behaviorNames.begin(),
+                     behaviorNames.end(),
+                     [&object, &behaviorType](const gd::String& behaviorName) {
+                       return !object.HasBehaviorNamed(behaviorName) ||
+                              object.GetBehavior(behaviorName).GetTypeName() !=
+                                  behaviorType;
+                     }),
+      behaviorNames.end());
+}
+
+}  // namespace
+
 namespace gd {
 
 ObjectsContainersList
@@ -53,6 +73,17 @@ ObjectsContainersList::MakeNewObjectsContainersListForContainer(
   return objectsContainersList;
 }
 
+ObjectsContainersList& ObjectsContainersList::operator=(
+    const ObjectsContainersList& other) {
+  if (this != &other) {
+    std::lock_guard<std::mutex> lock(resolutionsMutex);
+    objectsContainers = other.objectsContainers;
+    resolutions.clear();
+  }
+
+  return *this;
+}
+
 bool ObjectsContainersList::HasObjectOrGroupNamed(
     const gd::String& name) const {
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
@@ -399,192 +430,233 @@ void ObjectsContainersList::ForEachObject(
   }
 }
 
+const gd::ObjectGroup* ObjectsContainersList::GetObjectGroup(
+    const gd::String& name) const {
+  for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
+       ++it) {
+    if ((*it)->GetObjectGroups().Has(name))
+      return &(*it)->GetObjectGroups().Get(name);
+  }
+
+  return nullptr;
+}
+
+const ObjectsContainersList::ObjectOrGroupResolution&
+ObjectsContainersList::GetObjectOrGroupResolution(
+    const gd::String& objectOrGroupName) const {
+  std::size_t objectsChangesCount =
+      gd::ObjectsContainer::GetObjectsChangesCount();
+  if (resolutionsObjectsChangesCount != objectsChangesCount) {
+    resolutions.clear();
+    resolutionsObjectsChangesCount = objectsChangesCount;
+  }
+
+  auto it = resolutions.find(objectOrGroupName);
+  if (it != resolutions.end()) return it->second;
+
+  return resolutions
+      .emplace(objectOrGroupName, ResolveObjectOrGroup(objectOrGroupName))
+      .first->second;
+}
+
+ObjectsContainersList::ObjectOrGroupResolution
+ObjectsContainersList::ResolveObjectOrGroup(
+    const gd::String& objectOrGroupName) const {
+  ObjectOrGroupResolution resolution;
+
+  // Search in objects.
+  const gd::Object* object = GetObject(objectOrGroupName);
+  if (object) {
+    resolution.kind = ObjectOrGroupResolution::FoundObject;
+    resolution.type = object->GetType();
+    resolution.behaviorNames = object->GetAllBehaviorNames();
+    return resolution;
+  }
+
+  // Search in groups.
+  // Currently, a group is considered as the "intersection" of all of its
+  // objects. Search "groups is the intersection of its objects" in the
+  // codebase.
+  const gd::ObjectGroup* objectGroup = GetObjectGroup(objectOrGroupName);
+  if (!objectGroup) return resolution;
+
+  resolution.kind = ObjectOrGroupResolution::FoundGroup;
+  const auto& objectNames = objectGroup->GetAllObjectsNames();
+  for (std::size_t i = 0; i < objectNames.size(); ++i) {
+    const gd::Object* groupObject = GetObject(objectNames[i]);
+    if (!groupObject) {
+      // An unknown object has no type nor behaviors.
+      resolution.type.clear();
+      resolution.behaviorNames.clear();
+      break;
+    }
+
+    if (i == 0) {
+      resolution.type = groupObject->GetType();
+      resolution.behaviorNames = groupObject->GetAllBehaviorNames();
+      continue;
+    }
+
+    if (groupObject->GetType() != resolution.type) {
+      // The group has more than one type.
+      resolution.type.clear();
+    }
+    resolution.behaviorNames.erase(
+        std::remove_if(resolution.behaviorNames.begin(),
+                       resolution.behaviorNames.end(),
+                       [groupObject](const gd::String& behaviorName) {
+                         return !groupObject->HasBehaviorNamed(behaviorName);
+                       }),
+        resolution.behaviorNames.end());
+  }
+
+  return resolution;
+}
+
 gd::String ObjectsContainersList::GetTypeOfObject(
     const gd::String& objectName) const {
-  if (objectsContainers.size() > 2) {
-    std::cout << this << std::endl;
-    std::cout << objectsContainers.size() << std::endl;
-    // TODO: rework forwarded methods so they can work with any number of
-    // containers.
-    gd::LogFatalError(
-        "ObjectsContainersList::GetTypeOfObject called with objectsContainers "
-        "not being exactly 2. This is a logical error and will crash.");
-  }
-  if (objectsContainers.size() == 0) {
-    gd::LogWarning("ObjectsContainersList::GetTypeOfObject called without any "
-                   "objectsContainer");
-    return "";
-  }
-  if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
-    return gd::GetTypeOfObject(emptyObjectsContainer, *objectsContainers[0],
-                               objectName, true);
-  }
-  return gd::GetTypeOfObject(
-      *objectsContainers[0], *objectsContainers[1], objectName, true);
+  std::lock_guard<std::mutex> lock(resolutionsMutex);
+  return GetObjectOrGroupResolution(objectName).type;
 }
 
 bool ObjectsContainersList::HasBehaviorInObjectOrGroup(
     const gd::String& objectOrGroupName, const gd::String& behaviorName) const {
-  if (objectsContainers.size() > 2) {
-    // TODO: rework forwarded methods so they can work with any number of
-    // containers.
-    gd::LogFatalError(
-        "ObjectsContainersList::HasBehaviorInObjectOrGroup called with objectsContainers "
-        "not being exactly 2. This is a logical error and will crash.");
-  }
-  if (objectsContainers.size() == 0) {
-    gd::LogWarning("ObjectsContainersList::HasBehaviorInObjectOrGroup called without any "
-                   "objectsContainer");
-    return false;
-  }
-  if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
-    return gd::HasBehaviorInObjectOrGroup(
-        emptyObjectsContainer, *objectsContainers[0], objectOrGroupName,
-        behaviorName, true);
-  }
-  return gd::HasBehaviorInObjectOrGroup(*objectsContainers[0],
-                                        *objectsContainers[1],
-                                        objectOrGroupName,
-                                        behaviorName,
-                                        true);
+  std::lock_guard<std::mutex> lock(resolutionsMutex);
+  const auto& behaviorNames =
+      GetObjectOrGroupResolution(objectOrGroupName).behaviorNames;
+  return std::find(behaviorNames.begin(), behaviorNames.end(), behaviorName) !=
+         behaviorNames.end();
 }
 
 gd::String ObjectsContainersList::GetTypeOfBehaviorInObjectOrGroup(
     const gd::String& objectOrGroupName,
     const gd::String& behaviorName,
     bool searchInGroups) const {
-  if (objectsContainers.size() > 2) {
-    // TODO: rework forwarded methods so they can work with any number of
-    // containers.
-    gd::LogFatalError(
-        "ObjectsContainersList::GetTypeOfBehaviorInObjectOrGroup called with objectsContainers "
-        "not being exactly 2. This is a logical error and will crash.");
-  }
-  if (objectsContainers.size() == 0) {
-    gd::LogWarning("ObjectsContainersList::GetTypeOfBehaviorInObjectOrGroup called without any "
-                   "objectsContainer");
-    return "";
-  }
-  if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
-    return gd::GetTypeOfBehaviorInObjectOrGroup(
-        emptyObjectsContainer, *objectsContainers[0], objectOrGroupName,
-        behaviorName, searchInGroups);
-  }
-  return gd::GetTypeOfBehaviorInObjectOrGroup(*objectsContainers[0],
-                                              *objectsContainers[1],
-                                              objectOrGroupName,
-                                              behaviorName,
-                                              searchInGroups);
+  // Search in objects.
+  const gd::Object* object = GetObject(objectOrGroupName);
+  if (object) {
+    return object->HasBehaviorNamed(behaviorName)
+               ? object->GetBehavior(behaviorName).GetTypeName()
+               : "";
+  }
+
+  if (!searchInGroups) return "";
+
+  // Search in groups.
+  // Currently, a group is considered as the "intersection" of all of its
+  // objects. Search "groups is the intersection of its objects" in the
+  // codebase.
+  const gd::ObjectGroup* objectGroup = GetObjectGroup(objectOrGroupName);
+  if (!objectGroup) return "";
+
+  const auto& objectNames = objectGroup->GetAllObjectsNames();
+  // Empty groups don't contain any behavior.
+  if (objectNames.empty()) return "";
+
+  // Check that all objects have the behavior with the same type.
+  gd::String behaviorType =
+      GetTypeOfBehaviorInObjectOrGroup(objectNames[0], behaviorName, false);
+  for (std::size_t i = 1; i < objectNames.size(); ++i) {
+    if (GetTypeOfBehaviorInObjectOrGroup(
+            objectNames[i], behaviorName, false) != behaviorType) {
+      return "";
+    }
+  }
+  return behaviorType;
 }
 
 gd::String ObjectsContainersList::GetTypeOfBehavior(
     const gd::String& behaviorName, bool searchInGroups) const {
-  if (objectsContainers.size() > 2) {
-    // TODO: rework forwarded methods so they can work with any number of
-    // containers.
-    gd::LogFatalError(
-        "ObjectsContainersList::GetTypeOfBehavior called with objectsContainers "
-        "not being exactly 2. This is a logical error and will crash.");
-  }
-  if (objectsContainers.size() == 0) {
-    gd::LogWarning("ObjectsContainersList::GetTypeOfBehavior called without any "
-                   "objectsContainer");
-    return "";
-  }
-  if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
-    return gd::GetTypeOfBehavior(emptyObjectsContainer, *objectsContainers[0],
-                                 behaviorName, searchInGroups);
-  }
-  return gd::GetTypeOfBehavior(*objectsContainers[0],
-                               *objectsContainers[1],
-                               behaviorName,
-                               searchInGroups);
+  for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
+       ++it) {
+    for (const auto& object : (*it)->GetObjects()) {
+      if (object->HasBehaviorNamed(behaviorName)) {
+        return object->GetBehavior(behaviorName).GetTypeName();
+      }
+    }
+  }
+
+  return "";
 }
 
 std::vector<gd::String> ObjectsContainersList::GetBehaviorsOfObject(
     const gd::String& objectName, bool searchInGroups) const {
-  if (objectsContainers.size() > 2) {
-    // TODO: rework forwarded methods so they can work with any number of
-    // containers.
-    gd::LogFatalError(
-        "ObjectsContainersList::GetBehaviorsOfObject called with objectsContainers "
-        "not being exactly 2. This is a logical error and will crash.");
-  }
-  if (objectsContainers.size() == 0) {
-    gd::LogWarning("ObjectsContainersList::GetBehaviorsOfObject called without any "
-                   "objectsContainer");
-    std::vector<gd::String> behaviors;
-    return behaviors;
-  }
-  if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
-    return gd::GetBehaviorsOfObject(emptyObjectsContainer,
-                                    *objectsContainers[0], objectName,
-                                    searchInGroups);
-  }
-  return gd::GetBehaviorsOfObject(
-      *objectsContainers[0], *objectsContainers[1], objectName, searchInGroups);
+  std::lock_guard<std::mutex> lock(resolutionsMutex);
+  const auto& resolution = GetObjectOrGroupResolution(objectName);
+  if (!searchInGroups &&
+      resolution.kind == ObjectOrGroupResolution::FoundGroup) {
+    return std::vector<gd::String>();
+  }
+
+  return resolution.behaviorNames;
 }
 
 std::vector<gd::String> ObjectsContainersList::GetBehaviorNamesInObjectOrGroup(
     const gd::String &objectOrGroupName, const gd::String &behaviorType, bool searchInGroups) const {
-  if (objectsContainers.size() > 2) {
-    // TODO: rework forwarded methods so they can work with any number of
-    // containers.
-    gd::LogFatalError(
-        "ObjectsContainersList::GetBehaviorNamesInObjectOrGroup called with objectsContainers "
-        "not being exactly 2. This is a logical error and will crash.");
-  }
-  if (objectsContainers.size() == 0) {
-    gd::LogWarning("ObjectsContainersList::GetBehaviorNamesInObjectOrGroup called without any "
-                   "objectsContainer");
-    std::vector<gd::String> behaviors;
-    return behaviors;
-  }
-  if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
-    return gd::GetBehaviorNamesInObjectOrGroup(emptyObjectsContainer,
-                                    *objectsContainers[0], objectOrGroupName, behaviorType,
-                                    searchInGroups);
-  }
-  return gd::GetBehaviorNamesInObjectOrGroup(
-      *objectsContainers[0], *objectsContainers[1], objectOrGroupName, behaviorType, searchInGroups);
+  std::vector<gd::String> behaviorNames;
+
+  // Search in objects.
+  const gd::Object* object = GetObject(objectOrGroupName);
+  if (object) {
+    behaviorNames = object->GetAllBehaviorNames();
+    KeepBehaviorNamesOfType(*object, behaviorType, behaviorNames);
+    return behaviorNames;
+  }
+
+  if (!searchInGroups) return behaviorNames;
+
+  // Search in groups.
+  // Currently, a group is considered as the "intersection" of all of its
+  // objects. Search "groups is the intersection of its objects" in the
+  // codebase.
+  const gd::ObjectGroup* objectGroup = GetObjectGroup(objectOrGroupName);
+  if (!objectGroup) return behaviorNames;
+
+  const auto& objectNames = objectGroup->GetAllObjectsNames();
+  // Empty groups don't contain any behavior.
+  if (objectNames.empty()) return behaviorNames;
+
+  // Compute the intersection of the behaviors of all objects.
+  behaviorNames =
+      GetBehaviorNamesInObjectOrGroup(objectNames[0], behaviorType, false);
+  for (std::size_t i = 1; i < objectNames.size() && !behaviorNames.empty();
+       ++i) {
+    const gd::Object* groupObject = GetObject(objectNames[i]);
+    if (!groupObject) continue;
+
+    KeepBehaviorNamesOfType(*groupObject, behaviorType, behaviorNames);
+  }
+  return behaviorNames;
 }
 
 bool ObjectsContainersList::IsDefaultBehavior(
-    const gd::String &objectOrGroupName, const gd::String &behaviorType, bool searchInGroups) const {
-  if (objectsContainers.size() > 2) {
-    // TODO: rework forwarded methods so they can work with any number of
-    // containers.
-    gd::LogFatalError(
-        "ObjectsContainersList::IsDefaultBehavior called with objectsContainers "
-        "not being exactly 2. This is a logical error and will crash.");
-  }
-  if (objectsContainers.size() == 0) {
-    return false;
+    const gd::String &objectOrGroupName, const gd::String &behaviorName, bool searchInGroups) const {
+  // Search in objects.
+  const gd::Object* object = GetObject(objectOrGroupName);
+  if (object) {
+    return object->HasBehaviorNamed(behaviorName) &&
+           object->GetBehavior(behaviorName).IsDefaultBehavior();
   }
-  if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
-    return gd::IsDefaultBehavior(emptyObjectsContainer,
-                                    *objectsContainers[0], objectOrGroupName, behaviorType,
-                                    searchInGroups);
+
+  if (!searchInGroups) return false;
+
+  // Search in groups.
+  // Currently, a group is considered as the "intersection" of all of its
+  // objects. Search "groups is the intersection of its objects" in the
+  // codebase.
+  const gd::ObjectGroup* objectGroup = GetObjectGroup(objectOrGroupName);
+  if (!objectGroup) return false;
+
+  const auto& objectNames = objectGroup->GetAllObjectsNames();
+  // Empty groups don't contain any behavior.
+  if (objectNames.empty()) return false;
+
+  for (const auto& objectName : objectNames) {
+    if (!IsDefaultBehavior(objectName, behaviorName, false)) return false;
   }
-  return gd::IsDefaultBehavior(
-      *objectsContainers[0], *objectsContainers[1], objectOrGroupName, behaviorType, searchInGroups);
+  return true;
 }
 
-
 std::vector<gd::String> ObjectsContainersList::GetAnimationNamesOfObject(
     const gd::String &objectOrGroupName) const {
   std::vector<gd::String> animationNames;
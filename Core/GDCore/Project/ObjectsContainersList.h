@@ -1,4 +1,6 @@
 #pragma once
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "Variable.h"
@@ -11,6 +13,7 @@ class Layout;
 class VariablesContainer;
 class Object;
 class ObjectConfiguration;
+class ObjectGroup;
 }  // namespace gd
 
 namespace gd {
@@ -24,12 +27,22 @@ namespace gd {
  * \see gd::Project
  * \see gd::Layout
  *
+ * Containers are searched from the last one (the most "local") to the first
+ * one (the most "global"). The types and behaviors of objects and groups are
+ * cached until an object or a group is modified (see
+ * gd::ObjectsContainer::GetObjectsChangesCount).
+ *
  * \ingroup PlatformDefinition
  */
 class GD_CORE_API ObjectsContainersList {
  public:
   virtual ~ObjectsContainersList(){};
 
+  ObjectsContainersList(const ObjectsContainersList& other)
+      : objectsContainers(other.objectsContainers){};
+
+  ObjectsContainersList& operator=(const ObjectsContainersList& other);
+
   static ObjectsContainersList MakeNewEmptyObjectsContainersList();
 
   static ObjectsContainersList MakeNewObjectsContainersListForProjectAndLayout(
@@ -241,8 +254,33 @@ class GD_CORE_API ObjectsContainersList {
   ObjectsContainersList(){};
 
  private:
+  /**
+   * \brief The type and behaviors of an object or a group.
+   */
+  struct ObjectOrGroupResolution {
+    enum Kind { NotFound, FoundObject, FoundGroup };
+
+    Kind kind = NotFound;
+    gd::String type;
+    std::vector<gd::String> behaviorNames;
+  };
+
+  /**
+   * \brief Return the cached resolution of an object or group, computing it if
+   * needed.
+   *
+   * \warning `resolutionsMutex` must be locked by the caller.
+   */
+  const ObjectOrGroupResolution& GetObjectOrGroupResolution(
+      const gd::String& objectOrGroupName) const;
+
+  ObjectOrGroupResolution ResolveObjectOrGroup(
+      const gd::String& objectOrGroupName) const;
+
   const gd::Object* GetObject(const gd::String& name) const;
 
+  const gd::ObjectGroup* GetObjectGroup(const gd::String& name) const;
+
   bool HasObjectWithVariableNamed(const gd::String& objectName,
                                   const gd::String& variableName) const;
 
@@ -262,10 +300,16 @@ class GD_CORE_API ObjectsContainersList {
                          const gd::Variable& variable)> fn) const;
 
   void Add(const gd::ObjectsContainer& objectsContainer) {
+    std::lock_guard<std::mutex> lock(resolutionsMutex);
     objectsContainers.push_back(&objectsContainer);
+    resolutions.clear();
   };
 
   std::vector<const gd::ObjectsContainer*> objectsContainers;
+
+  mutable std::unordered_map<gd::String, ObjectOrGroupResolution> resolutions;
+  mutable std::size_t resolutionsObjectsChangesCount = 0;
+  mutable std::mutex resolutionsMutex;
 };
 
 }  // namespace gd
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <cctype>
 #include <fstream>
 #include <map>
@@ -300,33 +301,26 @@ bool Project::RemovePlatform(const gd::String& platformName) {
 }
 
 bool Project::HasLayoutNamed(const gd::String& name) const {
-  return (find_if(scenes.begin(),
-                  scenes.end(),
-                  [&name](const std::unique_ptr<gd::Layout>& layout) {
-                    return layout->GetName() == name;
-                  }) != scenes.end());
+  return GetLayoutPosition(name) != gd::String::npos;
 }
 gd::Layout& Project::GetLayout(const gd::String& name) {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), [&name](const std::unique_ptr<gd::Layout>& layout) {
-        return layout->GetName() == name;
-      }));
+  return *scenes[GetLayoutPosition(name)];
 }
 const gd::Layout& Project::GetLayout(const gd::String& name) const {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), [&name](const std::unique_ptr<gd::Layout>& layout) {
-        return layout->GetName() == name;
-      }));
+  return *scenes[GetLayoutPosition(name)];
 }
 gd::Layout& Project::GetLayout(std::size_t index) { return *scenes[index]; }
 const gd::Layout& Project::GetLayout(std::size_t index) const {
   return *scenes[index];
 }
 std::size_t Project::GetLayoutPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < scenes.size(); ++i) {
-    if (scenes[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return scenesIndex.Find(
+      name,
+      scenes.size(),
+      [this](std::size_t index) { return scenes[index]->GetName(); },
+      [this](std::size_t index) {
+        return &scenes[index]->GetNamesIndexLink();
+      });
 }
 std::size_t Project::GetLayoutsCount() const { return scenes.size(); }
 
@@ -334,15 +328,25 @@ void Project::SwapLayouts(std::size_t first, std::size_t second) {
   if (first >= scenes.size() || second >= scenes.size()) return;
 
   std::iter_swap(scenes.begin() + first, scenes.begin() + second);
+  scenesIndex.Invalidate();
 }
 
 gd::Layout& Project::InsertNewLayout(const gd::String& name,
                                      std::size_t position) {
+  bool isAppended = position >= scenes.size();
+  bool wasIndexUpToDate = scenesIndex.IsUpToDate();
   gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
-      position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout())));
+      isAppended ? scenes.end() : scenes.begin() + position, new Layout())));
 
   newlyInsertedLayout.SetName(name);
+  newlyInsertedLayout.ResetPersistentUuid();
+  if (isAppended)
+    scenesIndex.Append(name,
+                       scenes.size() - 1,
+                       wasIndexUpToDate,
+                       &newlyInsertedLayout.GetNamesIndexLink());
+  else
+    scenesIndex.Invalidate();
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
 
   return newlyInsertedLayout;
@@ -350,23 +354,42 @@ gd::Layout& Project::InsertNewLayout(const gd::String& name,
 
 gd::Layout& Project::InsertLayout(const gd::Layout& layout,
                                   std::size_t position) {
+  bool isAppended = position >= scenes.size();
+  bool wasIndexUpToDate = scenesIndex.IsUpToDate();
   gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
-      position < scenes.size() ? scenes.begin() + position : scenes.end(),
+      isAppended ? scenes.end() : scenes.begin() + position,
       new Layout(layout))));
 
+  // A copy of a layout of the project must not be recognized as the same
+  // layout.
+  const gd::String& persistentUuid = newlyInsertedLayout.GetPersistentUuid();
+  if (persistentUuid.empty() ||
+      std::any_of(scenes.begin(),
+                  scenes.end(),
+                  [&](const std::unique_ptr<gd::Layout>& scene) {
+                    return scene.get() != &newlyInsertedLayout &&
+                           scene->GetPersistentUuid() == persistentUuid;
+                  }))
+    newlyInsertedLayout.ResetPersistentUuid();
+
+  if (isAppended)
+    scenesIndex.Append(newlyInsertedLayout.GetName(),
+                       scenes.size() - 1,
+                       wasIndexUpToDate,
+                       &newlyInsertedLayout.GetNamesIndexLink());
+  else
+    scenesIndex.Invalidate();
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
 
   return newlyInsertedLayout;
 }
 
 void Project::RemoveLayout(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Layout> >::iterator scene =
-      find_if(scenes.begin(), scenes.end(), [&name](const std::unique_ptr<gd::Layout>& layout) {
-        return layout->GetName() == name;
-      });
-  if (scene == scenes.end()) return;
+  std::size_t position = GetLayoutPosition(name);
+  if (position == gd::String::npos) return;
 
-  scenes.erase(scene);
+  scenes.erase(scenes.begin() + position);
+  scenesIndex.Invalidate();
 }
 
 bool Project::HasExternalEventsNamed(const gd::String& name) const {
@@ -447,6 +470,7 @@ void Project::MoveLayout(std::size_t oldIndex, std::size_t newIndex) {
   std::unique_ptr<gd::Layout> scene = std::move(scenes[oldIndex]);
   scenes.erase(scenes.begin() + oldIndex);
   scenes.insert(scenes.begin() + newIndex, std::move(scene));
+  scenesIndex.Invalidate();
 };
 
 void Project::MoveExternalEvents(std::size_t oldIndex, std::size_t newIndex) {
@@ -879,6 +903,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
   scenes.clear();
+  scenesIndex.Invalidate();
   const SerializerElement& layoutsElement =
       element.GetChild("layouts", 0, "Scenes");
   layoutsElement.ConsiderAsArrayOf("layout", "Scene");
@@ -1317,6 +1342,7 @@ void Project::Init(const gd::Project& game) {
   objectsContainer = game.objectsContainer;
 
   scenes = gd::Clone(game.scenes);
+  scenesIndex.Invalidate();
 
   externalEvents = gd::Clone(game.externalEvents);
 
@@ -19,6 +19,7 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/Project/Watermark.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamesIndex.h"
 namespace gd {
 class Platform;
 class Layout;
@@ -609,7 +610,7 @@ class GD_CORE_API Project {
 
   /**
    * \brief Add a new empty layout called "name" at the specified
-   * position in the layout list.
+   * position in the layout list. It's given a new persistent UUID.
    */
   gd::Layout& InsertNewLayout(const gd::String& name, std::size_t position);
 
@@ -624,6 +625,8 @@ class GD_CORE_API Project {
    * \note No pointer or reference must be kept on the layout passed
    * as parameter.
    *
+   * \note The copy is given a new persistent UUID if the layout has none, or
+   * if it's the UUID of another layout of the project.
    */
   gd::Layout& InsertLayout(const Layout& layout, std::size_t position);
 
@@ -1124,6 +1127,7 @@ class GD_CORE_API Project {
               ///< found on the layer at the scene
               ///< startup.
   std::vector<std::unique_ptr<gd::Layout> > scenes;  ///< List of all scenes
+  gd::NamesIndex scenesIndex;  ///< Positions of scenes in scenes.
   gd::VariablesContainer variables;  ///< Initial global variables
   gd::ObjectsContainer objectsContainer;
   std::vector<std::unique_ptr<gd::ExternalLayout> >
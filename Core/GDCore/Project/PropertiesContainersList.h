@@ -71,6 +71,21 @@ class GD_CORE_API PropertiesContainersList {
    */
   void ForEachPropertyMatchingSearch(const gd::String& search, std::function<void(const gd::NamedPropertyDescriptor& property)> fn) const;
 
+  /**
+   * \brief Return the properties container at the specified index in the list.
+   */
+  const gd::PropertiesContainer& GetPropertiesContainer(
+      std::size_t index) const {
+    return *propertiesContainers.at(index);
+  }
+
+  /**
+   * \brief Return the number of properties containers.
+   */
+  std::size_t GetPropertiesContainersCount() const {
+    return propertiesContainers.size();
+  }
+
   /** Do not use - should be private but accessible to let Emscripten create a
    * temporary. */
   PropertiesContainersList(){};
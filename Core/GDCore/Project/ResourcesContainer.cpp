@@ -40,22 +40,21 @@ void ResourcesContainer::Init(const ResourcesContainer &other) {
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
     resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
+  resourcesIndex.Invalidate();
 }
 
 Resource &ResourcesContainer::GetResource(const gd::String &name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return *resources[i];
-  }
+  std::size_t position = GetResourcePosition(name);
+  if (position != gd::String::npos)
+    return *resources[position];
 
   return badResource;
 }
 
 const Resource &ResourcesContainer::GetResource(const gd::String &name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return *resources[i];
-  }
+  std::size_t position = GetResourcePosition(name);
+  if (position != gd::String::npos)
+    return *resources[position];
 
   return badResource;
 }
@@ -154,12 +153,7 @@ const gd::String Resource::javaScriptType = "javascript";
 const gd::String Resource::internalInGameEditorOnlySvgType = "internal-in-game-editor-only-svg";
 
 bool ResourcesContainer::HasResource(const gd::String &name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return true;
-  }
-
-  return false;
+  return GetResourcePosition(name) != gd::String::npos;
 }
 
 std::vector<gd::String> ResourcesContainer::GetAllResourceNames() const {
@@ -231,12 +225,15 @@ bool ResourcesContainer::AddResource(const gd::Resource &resource) {
   if (HasResource(resource.GetName()))
     return false;
 
+  bool wasIndexUpToDate = resourcesIndex.IsUpToDate();
   std::shared_ptr<Resource> newResource =
       std::shared_ptr<Resource>(resource.Clone());
   if (newResource == std::shared_ptr<Resource>())
     return false;
 
   resources.push_back(newResource);
+  resourcesIndex.Append(newResource->GetName(), resources.size() - 1,
+                        wasIndexUpToDate, &newResource->GetNamesIndexLink());
   return true;
 }
 
@@ -246,11 +243,14 @@ bool ResourcesContainer::AddResource(const gd::String &name,
   if (HasResource(name))
     return false;
 
+  bool wasIndexUpToDate = resourcesIndex.IsUpToDate();
   std::shared_ptr<Resource> res = CreateResource(kind);
   res->SetFile(filename);
   res->SetName(name);
 
   resources.push_back(res);
+  resourcesIndex.Append(name, resources.size() - 1, wasIndexUpToDate,
+                        &res->GetNamesIndexLink());
 
   return true;
 }
@@ -295,20 +295,23 @@ bool MoveResourceDownInList(std::vector<std::shared_ptr<Resource>> &resources,
 } // namespace
 
 bool ResourcesContainer::MoveResourceUpInList(const gd::String &name) {
+  resourcesIndex.Invalidate();
   return gd::MoveResourceUpInList(resources, name);
 }
 
 bool ResourcesContainer::MoveResourceDownInList(const gd::String &name) {
+  resourcesIndex.Invalidate();
   return gd::MoveResourceDownInList(resources, name);
 }
 
 std::size_t
 ResourcesContainer::GetResourcePosition(const gd::String &name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return i;
-  }
-  return gd::String::npos;
+  return resourcesIndex.Find(
+      name, resources.size(),
+      [this](std::size_t index) { return resources[index]->GetName(); },
+      [this](std::size_t index) {
+        return &resources[index]->GetNamesIndexLink();
+      });
 }
 
 void ResourcesContainer::MoveResource(std::size_t oldIndex,
@@ -319,14 +322,14 @@ void ResourcesContainer::MoveResource(std::size_t oldIndex,
   auto resource = resources[oldIndex];
   resources.erase(resources.begin() + oldIndex);
   resources.insert(resources.begin() + newIndex, resource);
+  resourcesIndex.Invalidate();
 }
 
 std::shared_ptr<gd::Resource>
 ResourcesContainer::GetResourceSPtr(const gd::String &name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return resources[i];
-  }
+  std::size_t position = GetResourcePosition(name);
+  if (position != gd::String::npos)
+    return resources[position];
 
   return std::shared_ptr<gd::Resource>();
 }
@@ -336,6 +339,7 @@ void ResourcesContainer::RenameResource(const gd::String& oldName,
   for (std::size_t i = 0; i < resources.size(); ++i) {
     if (resources[i]->GetName() == oldName) resources[i]->SetName(newName);
   }
+  resourcesIndex.Invalidate();
 }
 
 void ResourcesContainer::RemoveResource(const gd::String &name) {
@@ -346,6 +350,7 @@ void ResourcesContainer::RemoveResource(const gd::String &name) {
     else
       ++i;
   }
+  resourcesIndex.Invalidate();
 }
 
 void ResourcesContainer::UnserializeFrom(const SerializerElement &element) {
@@ -375,6 +380,7 @@ void ResourcesContainer::UnserializeFrom(const SerializerElement &element) {
 
     resources.push_back(resource);
   }
+  resourcesIndex.Invalidate();
 }
 
 void ResourcesContainer::SerializeTo(SerializerElement &element) const {
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamesIndex.h"
 
 namespace gd {
 class Project;
@@ -46,12 +47,22 @@ public:
 
   /** \brief Change the name of the resource with the name passed as parameter.
    */
-  virtual void SetName(const gd::String &name_) { name = name_; }
+  virtual void SetName(const gd::String &name_) {
+    name = name_;
+    namesIndexLink.NotifyNameChanged();
+  }
 
   /** \brief Return the name of the resource.
    */
   virtual const gd::String &GetName() const { return name; }
 
+  /** \brief Return the link used to invalidate the index of the names of the
+   * container of the resource when it's renamed.
+   */
+  const gd::NamesIndexLink &GetNamesIndexLink() const {
+    return namesIndexLink;
+  }
+
   /** \brief Change the kind of the resource
    */
   virtual void SetKind(const gd::String &newKind) { kind = newKind; }
@@ -169,6 +180,7 @@ private:
   gd::String metadata;
   gd::String originName;
   gd::String originIdentifier;
+  gd::NamesIndexLink namesIndexLink;
   bool userAdded = false; ///< True if the resource was added by the user, and
                           ///< not automatically by GDevelop.
 
@@ -774,6 +786,7 @@ private:
   SourceType sourceType = Unknown;
 
   std::vector<std::shared_ptr<Resource>> resources;
+  gd::NamesIndex resourcesIndex;  ///< Positions of resources in resources.
 
   static Resource badResource;
   static gd::String badResourceName;
@@ -43,23 +43,19 @@ VariablesContainer::VariablesContainer(
 }
 
 bool VariablesContainer::Has(const gd::String& name) const {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  return (i != variables.end());
+  return GetPosition(name) != gd::String::npos;
 }
 
 Variable& VariablesContainer::Get(const gd::String& name) {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  if (i != variables.end()) return *i->second;
+  std::size_t position = GetPosition(name);
+  if (position != gd::String::npos) return *variables[position].second;
 
   return badVariable;
 }
 
 const Variable& VariablesContainer::Get(const gd::String& name) const {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  if (i != variables.end()) return *i->second;
+  std::size_t position = GetPosition(name);
+  if (position != gd::String::npos) return *variables[position].second;
 
   return badVariable;
 }
@@ -89,9 +85,12 @@ Variable& VariablesContainer::Insert(const gd::String& name,
   if (position < variables.size()) {
     variables.insert(variables.begin() + position,
                      std::make_pair(name, newVariable));
+    variablesIndex.Invalidate();
     return *variables[position].second;
   } else {
+    bool wasIndexUpToDate = variablesIndex.IsUpToDate();
     variables.push_back(std::make_pair(name, newVariable));
+    variablesIndex.Append(name, variables.size() - 1, wasIndexUpToDate);
     return *variables.back().second;
   }
 }
@@ -101,6 +100,7 @@ void VariablesContainer::Remove(const gd::String& varName) {
       std::remove_if(
           variables.begin(), variables.end(), VariableHasName(varName)),
       variables.end());
+  variablesIndex.Invalidate();
 }
 
 void VariablesContainer::RemoveRecursively(
@@ -115,6 +115,7 @@ void VariablesContainer::RemoveRecursively(
             return &variableToRemove == nameAndVariable.second.get();
           }),
       variables.end());
+  variablesIndex.Invalidate();
 
   for (auto& it : variables) {
     it.second->RemoveRecursively(variableToRemove);
@@ -122,11 +123,10 @@ void VariablesContainer::RemoveRecursively(
 }
 
 std::size_t VariablesContainer::GetPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < variables.size(); ++i) {
-    if (variables[i].first == name) return i;
-  }
-
-  return gd::String::npos;
+  return variablesIndex.Find(
+      name, variables.size(), [this](std::size_t index) {
+        return variables[index].first;
+      });
 }
 
 Variable& VariablesContainer::InsertNew(const gd::String& name,
@@ -139,9 +139,11 @@ bool VariablesContainer::Rename(const gd::String& oldName,
                                 const gd::String& newName) {
   if (Has(newName)) return false;
 
-  auto i = std::find_if(
-      variables.begin(), variables.end(), VariableHasName(oldName));
-  if (i != variables.end()) i->first = newName;
+  std::size_t position = GetPosition(oldName);
+  if (position != gd::String::npos) {
+    variables[position].first = newName;
+    variablesIndex.Invalidate();
+  }
 
   return true;
 }
@@ -155,6 +157,7 @@ void VariablesContainer::Swap(std::size_t firstVariableIndex,
   auto temp = variables[firstVariableIndex];
   variables[firstVariableIndex] = variables[secondVariableIndex];
   variables[secondVariableIndex] = temp;
+  variablesIndex.Invalidate();
 }
 
 void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
@@ -165,6 +168,7 @@ void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
   auto nameAndVariable = variables[oldIndex];
   variables.erase(variables.begin() + oldIndex);
   variables.insert(variables.begin() + newIndex, nameAndVariable);
+  variablesIndex.Invalidate();
 }
 
 void VariablesContainer::ForEachVariableMatchingSearch(
@@ -241,5 +245,6 @@ void VariablesContainer::Init(const gd::VariablesContainer& other) {
     variables.push_back(
         std::make_pair(it.first, std::make_shared<gd::Variable>(*it.second)));
   }
+  variablesIndex.Invalidate();
 }
 }  // namespace gd
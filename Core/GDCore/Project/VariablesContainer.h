@@ -9,6 +9,7 @@
 #include <vector>
 #include "GDCore/Project/Variable.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamesIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -147,7 +148,10 @@ class GD_CORE_API VariablesContainer {
   /**
    * \brief Clear all variables of the container.
    */
-  inline void Clear() { variables.clear(); }
+  inline void Clear() {
+    variables.clear();
+    variablesIndex.Invalidate();
+  }
 
   /**
    * \brief Call the callback for each variable with a name matching the specified search.
@@ -191,6 +195,7 @@ class GD_CORE_API VariablesContainer {
  private:
   SourceType sourceType = Unknown;
   std::vector<std::pair<gd::String, std::shared_ptr<gd::Variable>>> variables;
+  gd::NamesIndex variablesIndex;  ///< Positions of variables in variables.
   mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
                                       ///< useful for computing changesets.
   static gd::Variable badVariable;
@@ -0,0 +1,380 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/BinarySerializer.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+namespace {
+
+const char magic[4] = {'G', 'D', 'S', 'E'};
+const std::uint32_t version = 1;
+
+// Positions of the fields of the header.
+const std::size_t versionPosition = 4;
+const std::size_t rootOffsetPosition = 8;
+const std::size_t stringsTableOffsetPosition = 12;
+const std::size_t stringsCountPosition = 16;
+const std::size_t totalSizePosition = 20;
+const std::size_t headerSize = 24;
+
+enum ValueType : unsigned char {
+  Undefined = 0,
+  Unknown,  ///< Stored as a string, like in gd::SerializerValue.
+  Boolean,
+  String,
+  Int,
+  Double
+};
+
+const unsigned char isArrayFlag = 1;
+
+std::uint32_t ReadU32(const char* data) {
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+  return std::uint32_t(bytes[0]) | (std::uint32_t(bytes[1]) << 8) |
+         (std::uint32_t(bytes[2]) << 16) | (std::uint32_t(bytes[3]) << 24);
+}
+
+std::uint64_t ReadU64(const char* data) {
+  return std::uint64_t(ReadU32(data)) |
+         (std::uint64_t(ReadU32(data + 4)) << 32);
+}
+
+/**
+ * \brief Return the size of the value stored after its type.
+ */
+std::size_t GetValueSize(unsigned char type) {
+  switch (type) {
+    case Boolean:
+      return 1;
+    case Unknown:
+    case String:
+    case Int:
+      return 4;
+    case Double:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * \brief Return the string at the given index of the strings table, or an
+ * empty string if it can't be read.
+ */
+gd::String ReadString(const char* data, std::size_t size, std::uint32_t index) {
+  std::uint32_t stringsTableOffset =
+      ReadU32(data + stringsTableOffsetPosition);
+  if (index >= ReadU32(data + stringsCountPosition)) return "";
+
+  std::size_t position = std::size_t(stringsTableOffset) + index * 4;
+  if (position + 4 > size) return "";
+  std::size_t stringOffset = ReadU32(data + position);
+  if (stringOffset + 4 > size) return "";
+  std::size_t length = ReadU32(data + stringOffset);
+
+  // Strings are also null-terminated, so they can be used in place, but they
+  // can contain null characters: their length is used.
+  if (length >= size - stringOffset - 4 ||
+      data[stringOffset + 4 + length] != '\0')
+    return "";
+  gd::String string;
+  string.Raw().assign(data + stringOffset + 4, length);
+  return string;
+}
+
+SerializerValue ReadValue(const char* data,
+                          std::size_t size,
+                          std::size_t position) {
+  unsigned char type = data[position];
+  const char* value = data + position + 1;
+  switch (type) {
+    case Boolean:
+      return SerializerValue(value[0] != 0);
+    case String:
+      return SerializerValue(ReadString(data, size, ReadU32(value)));
+    case Int:
+      return SerializerValue(static_cast<int>(ReadU32(value)));
+    case Double: {
+      std::uint64_t bits = ReadU64(value);
+      double doubleValue;
+      std::memcpy(&doubleValue, &bits, sizeof(double));
+      return SerializerValue(doubleValue);
+    }
+    case Unknown: {
+      SerializerValue unknownValue;
+      unknownValue.Set(ReadString(data, size, ReadU32(value)));
+      return unknownValue;
+    }
+    default:
+      return SerializerValue();
+  }
+}
+
+/**
+ * \brief Write elements to their binary representation, children first, and
+ * then the strings table.
+ */
+class BinaryWriter {
+ public:
+  BinaryWriter() : buffer(headerSize, '\0') {}
+
+  std::uint32_t WriteElement(const SerializerElement& element) {
+    const auto& children = element.GetAllChildren();
+    std::vector<std::uint32_t> childrenOffsets;
+    childrenOffsets.reserve(children.size());
+    for (const auto& child : children) {
+      childrenOffsets.push_back(WriteElement(*child.second));
+    }
+
+    std::uint32_t offset = buffer.size();
+    if (element.IsValueUndefined())
+      buffer.push_back(Undefined);
+    else
+      WriteValue(element.GetValue());
+    buffer.push_back(element.ConsideredAsArray() ? isArrayFlag : 0);
+    WriteU32(GetStringIndex(element.ConsideredAsArrayOf()));
+
+    const auto& attributes = element.GetAllAttributes();
+    WriteU32(attributes.size());
+    for (const auto& attribute : attributes) {
+      WriteU32(GetStringIndex(attribute.first));
+      WriteValue(attribute.second);
+    }
+
+    WriteU32(children.size());
+    for (std::size_t i = 0; i < children.size(); ++i) {
+      WriteU32(GetStringIndex(children[i].first));
+      WriteU32(childrenOffsets[i]);
+    }
+
+    return offset;
+  }
+
+  std::string Finish(std::uint32_t rootOffset) {
+    std::uint32_t stringsTableOffset = buffer.size();
+    buffer.resize(buffer.size() + strings.size() * 4);
+    for (std::size_t i = 0; i < strings.size(); ++i) {
+      SetU32(stringsTableOffset + i * 4, buffer.size());
+      const std::string& string = strings[i]->Raw();
+      WriteU32(string.size());
+      buffer.append(string);
+      buffer.push_back('\0');
+    }
+
+    std::memcpy(&buffer[0], magic, sizeof(magic));
+    SetU32(versionPosition, version);
+    SetU32(rootOffsetPosition, rootOffset);
+    SetU32(stringsTableOffsetPosition, stringsTableOffset);
+    SetU32(stringsCountPosition, strings.size());
+    SetU32(totalSizePosition, buffer.size());
+    return std::move(buffer);
+  }
+
+ private:
+  void WriteU32(std::uint32_t value) {
+    buffer.push_back(value & 0xFF);
+    buffer.push_back((value >> 8) & 0xFF);
+    buffer.push_back((value >> 16) & 0xFF);
+    buffer.push_back((value >> 24) & 0xFF);
+  }
+
+  void SetU32(std::size_t position, std::uint32_t value) {
+    for (std::size_t i = 0; i < 4; ++i) {
+      buffer[position + i] = (value >> (i * 8)) & 0xFF;
+    }
+  }
+
+  void WriteValue(const SerializerValue& value) {
+    if (value.IsBoolean()) {
+      buffer.push_back(Boolean);
+      buffer.push_back(value.GetBool() ? 1 : 0);
+    } else if (value.IsString()) {
+      buffer.push_back(String);
+      WriteU32(GetStringIndex(value.GetRawString()));
+    } else if (value.IsInt()) {
+      buffer.push_back(Int);
+      WriteU32(static_cast<std::uint32_t>(value.GetInt()));
+    } else if (value.IsDouble()) {
+      buffer.push_back(Double);
+      double doubleValue = value.GetDouble();
+      std::uint64_t bits;
+      std::memcpy(&bits, &doubleValue, sizeof(double));
+      WriteU32(bits & 0xFFFFFFFF);
+      WriteU32(bits >> 32);
+    } else {
+      buffer.push_back(Unknown);
+      WriteU32(GetStringIndex(value.GetRawString()));
+    }
+  }
+
+  std::uint32_t GetStringIndex(const gd::String& string) {
+    auto it = stringIndices.find(string);
+    if (it != stringIndices.end()) return it->second;
+
+    it = stringIndices.emplace(string, strings.size()).first;
+    strings.push_back(&it->first);
+    return it->second;
+  }
+
+  std::string buffer;
+  std::unordered_map<gd::String, std::uint32_t> stringIndices;
+  std::vector<const gd::String*> strings;  ///< The keys of stringIndices,
+                                           ///< by index.
+};
+
+}  // namespace
+
+std::string BinarySerializer::ToBinary(const SerializerElement& element) {
+  BinaryWriter writer;
+  std::uint32_t rootOffset = writer.WriteElement(element);
+  return writer.Finish(rootOffset);
+}
+
+SerializerElement BinarySerializer::FromBinary(const char* data,
+                                               std::size_t size) {
+  return BinarySerializedElement(data, size).ToSerializerElement();
+}
+
+bool BinarySerializer::IsBinary(const char* data, std::size_t size) {
+  return size >= headerSize && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+BinarySerializedElement::BinarySerializedElement(const char* data_,
+                                                 std::size_t size_)
+    : data(nullptr), size(0) {
+  if (!BinarySerializer::IsBinary(data_, size_) ||
+      ReadU32(data_ + versionPosition) != version ||
+      ReadU32(data_ + totalSizePosition) > size_)
+    return;
+
+  Init(data_, size_, ReadU32(data_ + rootOffsetPosition));
+}
+
+void BinarySerializedElement::Init(const char* data_,
+                                   std::size_t size_,
+                                   std::uint32_t offset_) {
+  // The value, the flags and the name of the array children.
+  std::size_t position = offset_;
+  if (position + 1 > size_) return;
+  position += 1 + GetValueSize(data_[position]) + 1 + 4;
+
+  // The attributes, which are skipped.
+  if (position + 4 > size_) return;
+  std::uint32_t attributesCount = ReadU32(data_ + position);
+  position += 4;
+  for (std::uint32_t i = 0; i < attributesCount; ++i) {
+    if (position + 5 > size_) return;
+    position += 5 + GetValueSize(data_[position + 4]);
+  }
+
+  // The children table.
+  if (position + 4 > size_) return;
+  std::uint32_t childrenCount_ = ReadU32(data_ + position);
+  if (position + 4 + std::size_t(childrenCount_) * 8 > size_) return;
+
+  data = data_;
+  size = size_;
+  offset = offset_;
+  childrenOffset = position + 4;
+  childrenCount = childrenCount_;
+}
+
+bool BinarySerializedElement::IsValueUndefined() const {
+  return !IsValid() || data[offset] == Undefined;
+}
+
+SerializerValue BinarySerializedElement::GetValue() const {
+  if (!IsValid()) return SerializerValue();
+  return ReadValue(data, size, offset);
+}
+
+bool BinarySerializedElement::ConsideredAsArray() const {
+  if (!IsValid()) return false;
+  return data[offset + 1 + GetValueSize(data[offset])] & isArrayFlag;
+}
+
+gd::String BinarySerializedElement::GetChildName(std::size_t position) const {
+  if (position >= childrenCount) return "";
+  return ReadString(data, size, ReadU32(data + childrenOffset + position * 8));
+}
+
+BinarySerializedElement BinarySerializedElement::GetChild(
+    std::size_t position) const {
+  BinarySerializedElement child;
+  if (position >= childrenCount) return child;
+
+  // Children are always written before their parent: any other offset would
+  // make a cycle.
+  std::uint32_t childOffset =
+      ReadU32(data + childrenOffset + position * 8 + 4);
+  if (childOffset >= offset) return child;
+
+  child.Init(data, size, childOffset);
+  return child;
+}
+
+BinarySerializedElement BinarySerializedElement::GetChild(
+    const gd::String& name, std::size_t index) const {
+  for (std::size_t i = 0; i < childrenCount; ++i) {
+    if (GetChildName(i) != name) continue;
+    if (index == 0) return GetChild(i);
+    index--;
+  }
+
+  return BinarySerializedElement();
+}
+
+SerializerElement BinarySerializedElement::ToSerializerElement() const {
+  SerializerElement element;
+  UnserializeInto(element);
+  return element;
+}
+
+void BinarySerializedElement::UnserializeInto(
+    SerializerElement& element) const {
+  if (!IsValid()) return;
+
+  unsigned char valueType = data[offset];
+  if (valueType != Undefined) element.SetValue(GetValue());
+
+  std::size_t position = offset + 1 + GetValueSize(valueType);
+  if (data[position] & isArrayFlag) {
+    gd::String arrayOf = ReadString(data, size, ReadU32(data + position + 1));
+    if (arrayOf.empty())
+      element.ConsiderAsArray();
+    else
+      element.ConsiderAsArrayOf(arrayOf);
+  }
+  position += 1 + 4;
+
+  std::uint32_t attributesCount = ReadU32(data + position);
+  position += 4;
+  for (std::uint32_t i = 0; i < attributesCount; ++i) {
+    gd::String name = ReadString(data, size, ReadU32(data + position));
+    SerializerValue value = ReadValue(data, size, position + 4);
+    if (value.IsBoolean())
+      element.SetAttribute(name, value.GetBool());
+    else if (value.IsInt())
+      element.SetAttribute(name, value.GetInt());
+    else if (value.IsDouble())
+      element.SetAttribute(name, value.GetDouble());
+    else
+      element.SetAttribute(name, value.GetRawString());
+    position += 5 + GetValueSize(data[position + 4]);
+  }
+
+  for (std::size_t i = 0; i < childrenCount; ++i) {
+    GetChild(i).UnserializeInto(element.AddChild(GetChildName(i)));
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,180 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerValue.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Convert a gd::SerializerElement from/to a compact binary
+ * representation, faster to read than JSON.
+ *
+ * The binary representation is made of:
+ * - a header (a magic number, the version of the format, the offsets of the
+ *   root element and of the strings table and the total size),
+ * - the elements, each child being stored before its parent. An element
+ *   stores its value, its attributes and then the names of its children with
+ *   their offsets, so any child can be accessed without reading the others,
+ * - the strings table: the offsets of the strings, then the strings, each
+ *   prefixed by its length. Names and values used several times (like the
+ *   names of the children of arrays) are only stored once.
+ *
+ * Offsets are relative to the beginning of the data, and numbers are stored
+ * in little endian, so the data can be used directly after being read from
+ * a file or mapped into memory (with `mmap`): see gd::BinarySerializedElement
+ * to read only the parts needed (for example, a single scene of a project).
+ *
+ * \see gd::Serializer
+ * \see gd::BinarySerializedElement
+ */
+class GD_CORE_API BinarySerializer {
+ public:
+  /**
+   * \brief Serialize a gd::SerializerElement to its binary representation.
+   */
+  static std::string ToBinary(const SerializerElement& element);
+
+  /**
+   * \brief Construct a gd::SerializerElement from its binary representation.
+   *
+   * An empty element is returned if the data is not valid.
+   */
+  static SerializerElement FromBinary(const char* data, std::size_t size);
+
+  /**
+   * \brief Construct a gd::SerializerElement from its binary representation.
+   */
+  static SerializerElement FromBinary(const std::string& data) {
+    return FromBinary(data.data(), data.size());
+  }
+
+  /**
+   * \brief Return true if the data starts like a binary representation of an
+   * element.
+   */
+  static bool IsBinary(const char* data, std::size_t size);
+
+ private:
+  BinarySerializer(){};
+};
+
+/**
+ * \brief A read-only view of an element stored in the binary representation
+ * made by gd::BinarySerializer, reading the data in place.
+ *
+ * Nothing is read until asked, so only the needed parts of a large document
+ * are read and converted to gd::SerializerElement. For example, a single scene
+ * can be read from a whole serialized project:
+ *
+ * \code
+ * gd::BinarySerializedElement projectElement(data, size);
+ * gd::SerializerElement layoutElement =
+ *     projectElement.GetChild("layouts").GetChild(0).ToSerializerElement();
+ * \endcode
+ *
+ * \note The view does not own the data, which must stay alive (and unchanged)
+ * while the view and the views of its children are used.
+ *
+ * \see gd::BinarySerializer
+ */
+class GD_CORE_API BinarySerializedElement {
+ public:
+  /**
+   * \brief Create a view of the root element of the binary representation.
+   *
+   * The view is invalid if the data is not a valid binary representation.
+   */
+  BinarySerializedElement(const char* data, std::size_t size);
+
+  /**
+   * \brief Return true if the element could be read. Invalid elements have no
+   * value and no children.
+   */
+  bool IsValid() const { return data != nullptr; }
+
+  /**
+   * \brief Return true if no value was set for the element.
+   */
+  bool IsValueUndefined() const;
+
+  /**
+   * \brief Return the value of the element.
+   */
+  SerializerValue GetValue() const;
+
+  /**
+   * \brief Check if the element is considered as an array containing its
+   * children.
+   */
+  bool ConsideredAsArray() const;
+
+  /**
+   * \brief Return the number of children of the element.
+   */
+  std::size_t GetChildrenCount() const { return childrenCount; }
+
+  /**
+   * \brief Return the name of the child at the given position.
+   */
+  gd::String GetChildName(std::size_t position) const;
+
+  /**
+   * \brief Return the child at the given position (an invalid element if
+   * there is no such child).
+   */
+  BinarySerializedElement GetChild(std::size_t position) const;
+
+  /**
+   * \brief Return the \a index-th child with the given name (an invalid
+   * element if there is no such child).
+   * \note Complexity is O(number of children).
+   */
+  BinarySerializedElement GetChild(const gd::String& name,
+                                   std::size_t index = 0) const;
+
+  /**
+   * \brief Return true if the element has a child with the given name.
+   */
+  bool HasChild(const gd::String& name) const {
+    return GetChild(name).IsValid();
+  }
+
+  /**
+   * \brief Read the element, with its attributes and all its descendants,
+   * into a new gd::SerializerElement.
+   */
+  SerializerElement ToSerializerElement() const;
+
+  /**
+   * \brief Read the element, with its attributes and all its descendants,
+   * into an empty gd::SerializerElement.
+   */
+  void UnserializeInto(SerializerElement& element) const;
+
+ private:
+  BinarySerializedElement() : data(nullptr), size(0){};
+
+  /**
+   * \brief Initialize the view of the element stored at the given offset,
+   * checking that it's fully contained in the data.
+   */
+  void Init(const char* data_, std::size_t size_, std::uint32_t offset_);
+
+  const char* data;  ///< The data, or nullptr if the element is invalid.
+  std::size_t size;
+  std::uint32_t offset = 0;          ///< The offset of the element.
+  std::uint32_t childrenOffset = 0;  ///< The offset of the children table.
+  std::uint32_t childrenCount = 0;
+};
+
+}  // namespace gd
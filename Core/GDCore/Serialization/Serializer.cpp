@@ -16,6 +16,7 @@
 #include "GDCore/Serialization/SerializerElement.h"
 #include "rapidjson/document.h"
 #include "rapidjson/prettywriter.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/rapidjson.h"
 
 using namespace rapidjson;
@@ -111,14 +112,117 @@ void ElementToRapidJson(const gd::SerializerElement& element,
     }
   }
 }
+/**
+ * \brief Build a gd::SerializerElement from the events sent by a
+ * rapidjson::Reader, without an intermediate rapidjson::Document.
+ *
+ * Values are mapped as in RapidJsonValueToElement. Strings given by the
+ * reader are null-terminated, like the ones of a rapidjson::Document.
+ */
+class SerializerElementSaxHandler
+    : public BaseReaderHandler<UTF8<>, SerializerElementSaxHandler> {
+ public:
+  SerializerElementSaxHandler(gd::SerializerElement& rootElement_)
+      : rootElement(rootElement_){};
+
+  bool Null() {
+    NextElement();
+    return true;
+  }
+  bool Bool(bool b) {
+    NextElement().SetBoolValue(b);
+    return true;
+  }
+  bool Int(int i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint(unsigned u) {
+    NextElement().SetIntValue(u);
+    return true;
+  }
+  bool Int64(int64_t i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint64(uint64_t u) {
+    NextElement().SetIntValue(u);
+    return true;
+  }
+  bool Double(double d) {
+    NextElement().SetValue(d);
+    return true;
+  }
+  bool String(const char* str, SizeType length, bool copy) {
+    NextElement().SetStringValue(str);
+    return true;
+  }
+  bool StartObject() {
+    stack.push_back(std::make_pair(&NextElement(), false));
+    return true;
+  }
+  bool Key(const char* str, SizeType length, bool copy) {
+    pendingKey = str;
+    return true;
+  }
+  bool EndObject(SizeType memberCount) {
+    stack.pop_back();
+    return true;
+  }
+  bool StartArray() {
+    gd::SerializerElement& element = NextElement();
+    element.ConsiderAsArray();
+    stack.push_back(std::make_pair(&element, true));
+    return true;
+  }
+  bool EndArray(SizeType elementCount) {
+    stack.pop_back();
+    return true;
+  }
+
+ private:
+  /**
+   * \brief Return the element where the next value must be stored: the root
+   * element for the first value, then a new child of the object or array
+   * being read.
+   */
+  gd::SerializerElement& NextElement() {
+    if (stack.empty()) return rootElement;
+
+    gd::SerializerElement& parent = *stack.back().first;
+    return stack.back().second
+               ? parent.AddChild("")
+               : parent.AddChild(pendingKey);
+  }
+
+  gd::SerializerElement& rootElement;
+  std::vector<std::pair<gd::SerializerElement*, bool>>
+      stack;  ///< The objects and arrays being read, and if they are arrays.
+  gd::String pendingKey;  ///< The key of the next member of an object.
+};
+
 }  // namespace
 
 SerializerElement Serializer::FromJSON(const char* json) {
+  SerializerElement element;
+  if (json[0] == '\0') return element;
+
+  SerializerElementSaxHandler handler(element);
+  Reader reader;
+  StringStream stream(json);
+  if (reader.Parse(stream, handler).IsError()) {
+    std::cout << "TODO: error while parsing" << std::endl;
+    return SerializerElement();
+  }
+
+  return element;
+}
+
+SerializerElement Serializer::FromJSONUsingDocument(const char* json) {
   SerializerElement element;
   size_t len = strlen(json);
   if (len != 0) {
     Document document;
-
     // In-situ parsing, decode strings directly in the source string. Source
     // must be string.
     char buffer[len + 1];
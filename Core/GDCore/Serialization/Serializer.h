@@ -41,15 +41,31 @@ class GD_CORE_API Serializer {
 
   /**
    * \brief Construct a gd::SerializerElement from a JSON string.
+   *
+   * The elements are created while the JSON is read, without building an
+   * intermediate rapidjson::Document nor copying the string.
    */
   static SerializerElement FromJSON(const char* json);
-
   /**
    * \brief Construct a gd::SerializerElement from a JSON string.
    */
   static SerializerElement FromJSON(const gd::String& json) {
     return FromJSON(json.c_str());
   }
+
+  /**
+   * \brief Construct a gd::SerializerElement from a JSON string, by parsing
+   * it first into a rapidjson::Document.
+   *
+   * This gives the same result as FromJSON but uses more memory (the whole
+   * document and a copy of the string are kept while the elements are
+   * created). Only kept for comparison, in tests and benchmarks.
+   */
+  static SerializerElement FromJSONUsingDocument(const char* json);
+
+  static SerializerElement FromJSONUsingDocument(const gd::String& json) {
+    return FromJSONUsingDocument(json.c_str());
+  }
   ///@}
 
   virtual ~Serializer(){};
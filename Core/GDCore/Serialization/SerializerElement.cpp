@@ -1,24 +1,211 @@
 #include "GDCore/Serialization/SerializerElement.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
+#include <mutex>
+#include <unordered_set>
 
 #include "GDCore/Tools/Log.h"
 
 namespace gd {
 
+/**
+ * \brief The memory where the elements of a document are allocated.
+ *
+ * All the allocations have the same size (a gd::SerializerElement and the
+ * control block of its std::shared_ptr), so the memory of removed elements is
+ * reused. The arena is destroyed when the last element or allocator using it
+ * is destroyed.
+ *
+ * \note Like the elements, an arena must not be modified by several threads
+ * at the same time.
+ */
+class SerializerElementsArena {
+ public:
+  SerializerElementsArena()
+      : referencesCount(0),
+        slotSize(0),
+        nextBlockSlotsCount(8),
+        remainingSlotsCount(0),
+        nextSlot(nullptr),
+        freeSlot(nullptr){};
+
+  void Retain() { referencesCount++; }
+
+  void Release() {
+    if (--referencesCount == 0) delete this;
+  }
+
+  void* Allocate(std::size_t size) {
+    if (slotSize == 0) slotSize = (size + alignment - 1) / alignment * alignment;
+    if (size > slotSize) return ::operator new(size);
+
+    if (freeSlot) {
+      FreeSlot* slot = freeSlot;
+      freeSlot = slot->next;
+      return slot;
+    }
+
+    if (remainingSlotsCount == 0) {
+      // Blocks are small at first, as most documents are small (the content of
+      // a behavior, for example), then grow for large documents.
+      blocks.emplace_back(new char[slotSize * nextBlockSlotsCount]);
+      nextSlot = blocks.back().get();
+      remainingSlotsCount = nextBlockSlotsCount;
+      if (nextBlockSlotsCount < 1024) nextBlockSlotsCount *= 2;
+    }
+
+    void* slot = nextSlot;
+    nextSlot += slotSize;
+    remainingSlotsCount--;
+    return slot;
+  }
+
+  void Deallocate(void* ptr, std::size_t size) {
+    if (size > slotSize) {
+      ::operator delete(ptr);
+      return;
+    }
+
+    FreeSlot* slot = static_cast<FreeSlot*>(ptr);
+    slot->next = freeSlot;
+    freeSlot = slot;
+  }
+
+ private:
+  ~SerializerElementsArena(){};
+
+  struct FreeSlot {
+    FreeSlot* next;
+  };
+  static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+  std::atomic<std::size_t> referencesCount;
+  std::size_t slotSize;
+  std::size_t nextBlockSlotsCount;
+  std::size_t remainingSlotsCount;
+  char* nextSlot;
+  FreeSlot* freeSlot;  ///< The first slot of the list of freed slots.
+  std::vector<std::unique_ptr<char[]>> blocks;
+};
+
+namespace {
+
+/**
+ * \brief A standard allocator using a gd::SerializerElementsArena, used to
+ * allocate the children of elements with std::allocate_shared.
+ */
+template <class T>
+class SerializerElementsArenaAllocator {
+ public:
+  typedef T value_type;
+
+  SerializerElementsArenaAllocator(SerializerElementsArena& arena_)
+      : arena(&arena_) {
+    arena->Retain();
+  }
+  SerializerElementsArenaAllocator(
+      const SerializerElementsArenaAllocator& other)
+      : arena(other.arena) {
+    arena->Retain();
+  }
+  template <class U>
+  SerializerElementsArenaAllocator(
+      const SerializerElementsArenaAllocator<U>& other)
+      : arena(other.arena) {
+    arena->Retain();
+  }
+  SerializerElementsArenaAllocator& operator=(
+      const SerializerElementsArenaAllocator& other) = delete;
+  ~SerializerElementsArenaAllocator() { arena->Release(); }
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena->Allocate(n * sizeof(T)));
+  }
+  void deallocate(T* ptr, std::size_t n) {
+    arena->Deallocate(ptr, n * sizeof(T));
+  }
+
+  template <class U>
+  bool operator==(const SerializerElementsArenaAllocator<U>& other) const {
+    return arena == other.arena;
+  }
+  template <class U>
+  bool operator!=(const SerializerElementsArenaAllocator<U>& other) const {
+    return arena != other.arena;
+  }
+
+  SerializerElementsArena* arena;
+};
+
+const std::map<gd::String, SerializerValue> noAttributes;
+
+}  // namespace
+
 SerializerElement SerializerElement::nullElement;
 
-SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
+SerializerElement::SerializerElement()
+    : valueUndefined(true),
+      isArray(false),
+      arrayOf(InternArrayName("")),
+      deprecatedArrayOf(InternArrayName("")) {}
 
 SerializerElement::SerializerElement(const SerializerValue& value)
-    : valueUndefined(false), elementValue(value), isArray(false) {}
+    : elementValue(value),
+      valueUndefined(false),
+      isArray(false),
+      arrayOf(InternArrayName("")),
+      deprecatedArrayOf(InternArrayName("")) {}
+
+SerializerElement::~SerializerElement() {
+  children.clear();
+  if (arena) arena->Release();
+}
+
+const gd::String* SerializerElement::InternArrayName(const gd::String& name) {
+  static const gd::String emptyName;
+  if (name.empty()) return &emptyName;
+
+  // Names are almost always constants of the code (like "object" or
+  // "layout"), so they are never removed.
+  static std::mutex namesMutex;
+  static std::unordered_set<gd::String> names;
+  std::lock_guard<std::mutex> lock(namesMutex);
+  return &*names.insert(name).first;
+}
+
+std::shared_ptr<SerializerElement> SerializerElement::MakeChild() {
+  if (!arena) {
+    arena = new SerializerElementsArena;
+    arena->Retain();
+  }
+
+  std::shared_ptr<SerializerElement> child =
+      std::allocate_shared<SerializerElement>(
+          SerializerElementsArenaAllocator<SerializerElement>(*arena));
+  child->arena = arena;
+  arena->Retain();
+  return child;
+}
+
+std::map<gd::String, SerializerValue>& SerializerElement::Attributes() {
+  if (!attributes)
+    attributes.reset(new std::map<gd::String, SerializerValue>);
+  return *attributes;
+}
 
-SerializerElement::~SerializerElement() {}
+const std::map<gd::String, SerializerValue>&
+SerializerElement::GetAllAttributes() const {
+  return attributes ? *attributes : noAttributes;
+}
 
 const SerializerValue& SerializerElement::GetValue() const {
-  if (valueUndefined && attributes.find("value") != attributes.end())
-    return attributes.find("value")->second;
+  if (valueUndefined && attributes &&
+      attributes->find("value") != attributes->end())
+    return attributes->find("value")->second;
 
   return elementValue;
 }
@@ -29,7 +216,7 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
                       // support code using attributes. Make sure that any
                       // existing child with this name is removed (otherwise it
                       // would erase the attribute at serialization).
-  attributes[name].SetBool(value);
+  Attributes()[name].SetBool(value);
   return *this;
 }
 
@@ -39,7 +226,7 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
                       // support code using attributes. Make sure that any
                       // existing child with this name is removed (otherwise it
                       // would erase the attribute at serialization).
-  attributes[name].SetString(value);
+  Attributes()[name].SetString(value);
   return *this;
 }
 
@@ -49,7 +236,7 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
                       // support code using attributes. Make sure that any
                       // existing child with this name is removed (otherwise it
                       // would erase the attribute at serialization).
-  attributes[name].SetInt(value);
+  Attributes()[name].SetInt(value);
   return *this;
 }
 
@@ -64,9 +251,9 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
     gd::LogError("Attribute \"" + name +
                  "\" was set to NaN - this is not allowed (would not be "
                  "serialized correctly to JSON). Defaulting to 0.");
-    attributes[name].SetDouble(0);
+    Attributes()[name].SetDouble(0);
   } else {
-    attributes[name].SetDouble(value);
+    Attributes()[name].SetDouble(value);
   }
 
   return *this;
@@ -75,11 +262,11 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
 bool SerializerElement::GetBoolAttribute(const gd::String& name,
                                          bool defaultValue,
                                          gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end()) {
-    return attributes.find(name)->second.GetBool();
-  } else if (!deprecatedName.empty() &&
-             attributes.find(deprecatedName) != attributes.end()) {
-    return attributes.find(deprecatedName)->second.GetBool();
+  if (attributes && attributes->find(name) != attributes->end()) {
+    return attributes->find(name)->second.GetBool();
+  } else if (attributes && !deprecatedName.empty() &&
+             attributes->find(deprecatedName) != attributes->end()) {
+    return attributes->find(deprecatedName)->second.GetBool();
   } else {
     if (HasChild(name, deprecatedName)) {
       SerializerElement& child = GetChild(name, 0, deprecatedName);
@@ -96,11 +283,11 @@ gd::String SerializerElement::GetStringAttribute(  // TODO: Use const ref?
     const gd::String& name,
     gd::String defaultValue,
     gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetString();
-  else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetString();
+  if (attributes && attributes->find(name) != attributes->end())
+    return attributes->find(name)->second.GetString();
+  else if (attributes && !deprecatedName.empty() &&
+           attributes->find(deprecatedName) != attributes->end())
+    return attributes->find(deprecatedName)->second.GetString();
   else {
     if (HasChild(name, deprecatedName)) {
       SerializerElement& child = GetChild(name, 0, deprecatedName);
@@ -114,11 +301,11 @@ gd::String SerializerElement::GetStringAttribute(  // TODO: Use const ref?
 int SerializerElement::GetIntAttribute(const gd::String& name,
                                        int defaultValue,
                                        gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetInt();
-  else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetInt();
+  if (attributes && attributes->find(name) != attributes->end())
+    return attributes->find(name)->second.GetInt();
+  else if (attributes && !deprecatedName.empty() &&
+           attributes->find(deprecatedName) != attributes->end())
+    return attributes->find(deprecatedName)->second.GetInt();
   else {
     if (HasChild(name, deprecatedName)) {
       SerializerElement& child = GetChild(name, 0, deprecatedName);
@@ -132,11 +319,11 @@ int SerializerElement::GetIntAttribute(const gd::String& name,
 double SerializerElement::GetDoubleAttribute(const gd::String& name,
                                              double defaultValue,
                                              gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetDouble();
-  else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetDouble();
+  if (attributes && attributes->find(name) != attributes->end())
+    return attributes->find(name)->second.GetDouble();
+  else if (attributes && !deprecatedName.empty() &&
+           attributes->find(deprecatedName) != attributes->end())
+    return attributes->find(deprecatedName)->second.GetDouble();
   else {
     if (HasChild(name, deprecatedName)) {
       SerializerElement& child = GetChild(name, 0, deprecatedName);
@@ -148,31 +335,33 @@ double SerializerElement::GetDoubleAttribute(const gd::String& name,
 }
 
 bool SerializerElement::HasAttribute(const gd::String& name) const {
-  return attributes.find(name) != attributes.end();
+  return attributes && attributes->find(name) != attributes->end();
 }
 
 SerializerElement& SerializerElement::AddChild(gd::String name) {
   if (isArray) {
-    if (name != arrayOf) {
+    if (name != *arrayOf) {
       std::cout << "WARNING: Adding a child, to a SerializerElement which is "
                    "considered as an array, with a name ("
                 << name << ") which is not the same as the array elements ("
-                << arrayOf << "). Child was renamed." << std::endl;
-      name = arrayOf;
+                << *arrayOf << "). Child was renamed." << std::endl;
+      name = *arrayOf;
     }
   }
 
   // In case of children of objects, there can be only one child with
   // a given name.
-  // Note: searching for the existing children is O(number of children). This
-  // could be improved, but in practice has no visible impact on saving
-  // large projects.
-  if (!isArray && HasChild(name)) {
-    return GetChild(name);
+  if (!isArray) {
+    std::size_t position = FindChildPosition(name, "", false, 0);
+    if (position != children.size()) return *children[position].second;
   }
 
-  std::shared_ptr<SerializerElement> newElement(new SerializerElement);
+  std::shared_ptr<SerializerElement> newElement = MakeChild();
   children.push_back(std::make_pair(name, newElement));
+  if (childrenIndex)
+    (*childrenIndex)[children.back().first].push_back(children.size() - 1);
+  else if (children.size() >= childrenIndexThreshold)
+    UpdateChildrenIndex();
 
   return *newElement;
 }
@@ -185,19 +374,9 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
     return nullElement;
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == arrayOf || children[i].first.empty() ||
-        (!deprecatedArrayOf.empty() &&
-         children[i].first == deprecatedArrayOf)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
-    }
-  }
+  std::size_t position =
+      FindChildPosition(*arrayOf, *deprecatedArrayOf, true, index);
+  if (position != children.size()) return *children[position].second;
 
   std::cout << "ERROR: Requested out of bound child at index " << index
             << std::endl;
@@ -207,27 +386,18 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
 SerializerElement& SerializerElement::GetChild(
     gd::String name, std::size_t index, gd::String deprecatedName) const {
   if (isArray) {
-    if (name != arrayOf) {
+    if (name != *arrayOf) {
       std::cout << "WARNING: Getting a child, from a SerializerElement which "
                    "is considered as an array, with a name ("
                 << name << ") which is not the same as the array elements ("
-                << arrayOf << ")." << std::endl;
-      name = arrayOf;
+                << *arrayOf << ")." << std::endl;
+      name = *arrayOf;
     }
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name || (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
-    }
-  }
+  std::size_t position =
+      FindChildPosition(name, deprecatedName, isArray, index);
+  if (position != children.size()) return *children[position].second;
 
   std::cout << "Child " << name << " not found in SerializerElement::GetChild"
             << std::endl;
@@ -245,16 +415,22 @@ std::size_t SerializerElement::GetChildrenCount(
       return 0;
     }
 
-    name = arrayOf;
-    deprecatedName = deprecatedArrayOf;
+    name = *arrayOf;
+    deprecatedName = *deprecatedArrayOf;
+  }
+
+  if (childrenIndex) {
+    std::size_t count = 0;
+    for (const auto* positions :
+         GetIndexedPositions(name, deprecatedName, isArray))
+      count += positions->size();
+    return count;
   }
 
   std::size_t currentIndex = 0;
   for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name || (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
+    if (ChildNameMatches(
+            children[i].first, name, deprecatedName, isArray))
       currentIndex++;
   }
 
@@ -263,38 +439,130 @@ std::size_t SerializerElement::GetChildrenCount(
 
 bool SerializerElement::HasChild(const gd::String& name,
                                  gd::String deprecatedName) const {
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+  return FindChildPosition(name, deprecatedName, false, 0) != children.size();
+}
+
+void SerializerElement::RemoveChild(const gd::String& name) {
+  if (childrenIndex && childrenIndex->find(name) == childrenIndex->end())
+    return;
+
+  auto newEnd =
+      std::remove_if(children.begin(),
+                     children.end(),
+                     [&name](const std::pair<gd::String,
+                                             std::shared_ptr<SerializerElement> >&
+                                 child) { return child.first == name; });
+  if (newEnd == children.end()) return;
 
-    if (children[i].first == name ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
-      return true;
+  children.erase(newEnd, children.end());
+  UpdateChildrenIndex();
+}
+
+bool SerializerElement::ChildNameMatches(const gd::String& childName,
+                                         const gd::String& name,
+                                         const gd::String& otherName,
+                                         bool includeUnnamed) {
+  return childName == name || (includeUnnamed && childName.empty()) ||
+         (!otherName.empty() && childName == otherName);
+}
+
+std::vector<const std::vector<std::size_t>*>
+SerializerElement::GetIndexedPositions(const gd::String& name,
+                                       const gd::String& otherName,
+                                       bool includeUnnamed) const {
+  std::vector<const std::vector<std::size_t>*> positions;
+  auto addPositions = [&](const gd::String& childName) {
+    auto it = childrenIndex->find(childName);
+    if (it == childrenIndex->end()) return;
+    for (const auto* addedPositions : positions)
+      if (addedPositions == &it->second) return;
+
+    positions.push_back(&it->second);
+  };
+
+  addPositions(name);
+  if (!otherName.empty()) addPositions(otherName);
+  if (includeUnnamed) addPositions("");
+  return positions;
+}
+
+std::size_t SerializerElement::FindChildPosition(const gd::String& name,
+                                                 const gd::String& otherName,
+                                                 bool includeUnnamed,
+                                                 std::size_t index) const {
+  if (!childrenIndex) {
+    std::size_t currentIndex = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (ChildNameMatches(children[i].first, name, otherName, includeUnnamed)) {
+        if (index == currentIndex)
+          return i;
+        else
+          currentIndex++;
+      }
+    }
+
+    return children.size();
   }
 
-  return false;
+  std::vector<const std::vector<std::size_t>*> positions =
+      GetIndexedPositions(name, otherName, includeUnnamed);
+  if (positions.empty()) return children.size();
+  if (positions.size() == 1) {
+    return index < positions[0]->size() ? (*positions[0])[index]
+                                        : children.size();
+  }
+
+  // Children with different names are matching: walk on their positions in
+  // the order of the children.
+  std::vector<std::size_t> nextPositions(positions.size(), 0);
+  for (std::size_t currentIndex = 0;; ++currentIndex) {
+    std::size_t smallest = positions.size();
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      if (nextPositions[i] < positions[i]->size() &&
+          (smallest == positions.size() ||
+           (*positions[i])[nextPositions[i]] <
+               (*positions[smallest])[nextPositions[smallest]]))
+        smallest = i;
+    }
+    if (smallest == positions.size()) return children.size();
+
+    std::size_t position = (*positions[smallest])[nextPositions[smallest]];
+    if (currentIndex == index) return position;
+    nextPositions[smallest]++;
+  }
 }
 
-void SerializerElement::RemoveChild(const gd::String& name) {
-  for (size_t i = 0; i < children.size();) {
-    if (children[i].first == name)
-      children.erase(children.begin() + i);
-    else
-      ++i;
+void SerializerElement::UpdateChildrenIndex() {
+  if (children.size() < childrenIndexThreshold) {
+    childrenIndex.reset();
+    return;
   }
+
+  childrenIndex.reset(
+      new std::unordered_map<gd::String, std::vector<std::size_t> >);
+  for (std::size_t i = 0; i < children.size(); ++i)
+    (*childrenIndex)[children[i].first].push_back(i);
 }
 
 void SerializerElement::Init(const gd::SerializerElement& other) {
   valueUndefined = other.valueUndefined;
   elementValue = other.elementValue;
-  attributes = other.attributes;
-
-  children.clear();
+  if (other.attributes)
+    Attributes() = *other.attributes;
+  else
+    attributes.reset();
+
+  // The children are copied into the arena of this element.
+  std::vector<std::pair<gd::String, std::shared_ptr<SerializerElement> > >
+      copiedChildren;
+  copiedChildren.reserve(other.children.size());
   for (const auto& child : other.children) {
-    children.push_back(
-        std::make_pair(child.first,
-                       std::shared_ptr<SerializerElement>(
-                           new SerializerElement(*child.second))));
+    std::shared_ptr<SerializerElement> copiedChild = MakeChild();
+    copiedChild->Init(*child.second);
+    copiedChildren.push_back(std::make_pair(child.first, copiedChild));
   }
+  children.swap(copiedChildren);
+  UpdateChildrenIndex();
 
   isArray = other.isArray;
   arrayOf = other.arrayOf;
@@ -309,6 +577,7 @@ void SerializerElement::SetMultilineStringValue(const gd::String& value) {
 
   std::vector<gd::String> lines = value.Split('\n');
   children.clear();
+  childrenIndex.reset();
   ConsiderAsArrayOf("");
   for (const auto& line : lines) {
     AddChild("").SetStringValue(line);
@@ -9,11 +9,16 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Serialization/SerializerValue.h"
 #include "GDCore/String.h"
 
+namespace gd {
+class SerializerElementsArena;
+}
+
 namespace gd {
 
 /**
@@ -29,9 +34,16 @@ namespace gd {
  * converted to a JavaScript object.
  *
  * \note Children are stored with their order preserved, but this also
- * means that their access/removal is O(number of children). This class
+ * means that their removal is O(number of children). Their access is also
+ * O(number of children), unless the element has many children: in this case,
+ * an index of the positions of the children by name is maintained. This class
  * is not appropriated for a use in game where fast access is required.
  *
+ * \note To keep the elements of large documents (like a serialized project)
+ * small, the children of an element and all their descendants are allocated
+ * from an arena shared by the whole document, the names of the array children
+ * are interned and the attributes are only allocated if used.
+ *
  * \see gd::Serializer
  */
 class GD_CORE_API SerializerElement {
@@ -332,9 +344,7 @@ class GD_CORE_API SerializerElement {
   /**
    * \brief Return all the attributes of the element.
    */
-  const std::map<gd::String, SerializerValue> &GetAllAttributes() const {
-    return attributes;
-  };
+  const std::map<gd::String, SerializerValue> &GetAllAttributes() const;
   ///@}
 
   /** \name Children
@@ -372,8 +382,8 @@ class GD_CORE_API SerializerElement {
   void ConsiderAsArrayOf(const gd::String &name,
                          const gd::String &deprecatedName = "") const {
     ConsiderAsArray();
-    arrayOf = name;
-    deprecatedArrayOf = deprecatedName;
+    arrayOf = InternArrayName(name);
+    deprecatedArrayOf = InternArrayName(deprecatedName);
   };
 
   /**
@@ -382,7 +392,7 @@ class GD_CORE_API SerializerElement {
    *
    * Return an empty string if the element is not considered as an array.
    */
-  const gd::String &ConsideredAsArrayOf() const { return arrayOf; };
+  const gd::String &ConsideredAsArrayOf() const { return *arrayOf; };
 
   /**
    * \brief Add a child at the end of the children list with the given name and
@@ -426,7 +436,8 @@ class GD_CORE_API SerializerElement {
 
   /**
    * \brief Return true if the specified child exists.
-   * \note Complexity is O(number of children).
+   * \note Complexity is O(number of children), or O(1) for elements with
+   * many children.
    * \param name The name of the child to find.
    */
   bool HasChild(const gd::String &name, gd::String deprecatedName = "") const;
@@ -456,16 +467,76 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement &other);
 
-  bool valueUndefined = true;  ///< If true, the element does not have a value.
+  /**
+   * \brief Create a new element, allocated from the arena of this element
+   * (created if needed), to be added as a child.
+   */
+  std::shared_ptr<SerializerElement> MakeChild();
+
+  /**
+   * \brief Return the position, in children, of the \a index-th child named
+   * \a name or \a otherName (if not empty) or without name (if \a
+   * includeUnnamed is true). Return the number of children if not found.
+   */
+  std::size_t FindChildPosition(const gd::String &name,
+                                const gd::String &otherName,
+                                bool includeUnnamed,
+                                std::size_t index) const;
+
+  /**
+   * \brief Return the positions, from the children index, of the children
+   * matching the names (see FindChildPosition).
+   */
+  std::vector<const std::vector<std::size_t> *> GetIndexedPositions(
+      const gd::String &name,
+      const gd::String &otherName,
+      bool includeUnnamed) const;
+
+  static bool ChildNameMatches(const gd::String &childName,
+                               const gd::String &name,
+                               const gd::String &otherName,
+                               bool includeUnnamed);
+
+  /**
+   * \brief Build the children index if there are enough children, or remove
+   * it otherwise.
+   *
+   * \note The index is kept up to date when children are added or removed,
+   * rather than built when a child is searched, so that elements can be read
+   * by several threads at the same time.
+   */
+  void UpdateChildrenIndex();
+
+  /**
+   * \brief Return the attributes, allocating them if needed.
+   */
+  std::map<gd::String, SerializerValue> &Attributes();
+
+  /**
+   * \brief Return an interned string equal to \a name, valid for the whole
+   * lifetime of the program.
+   */
+  static const gd::String *InternArrayName(const gd::String &name);
+
   SerializerValue elementValue;
+  bool valueUndefined = true;  ///< If true, the element does not have a value.
+  mutable bool isArray = false;  ///< true if element is considered as an array
 
-  std::map<gd::String, SerializerValue> attributes;
+  std::unique_ptr<std::map<gd::String, SerializerValue> >
+      attributes;  ///< Only allocated when an attribute is set.
   std::vector<std::pair<gd::String, std::shared_ptr<SerializerElement> > >
       children;
-  mutable bool isArray = false;  ///< true if element is considered as an array
-  mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
-                               ///< parsed elements).
-  mutable gd::String deprecatedArrayOf;  ///< Alternate name for children
+  std::unique_ptr<std::unordered_map<gd::String, std::vector<std::size_t> > >
+      childrenIndex;  ///< The positions of the children, by name. Only used
+                      ///< when there are at least childrenIndexThreshold
+                      ///< children.
+  static constexpr std::size_t childrenIndexThreshold = 16;
+  SerializerElementsArena *arena =
+      nullptr;  ///< The arena of the document, where children are allocated.
+  mutable const gd::String *arrayOf;  ///< The name of the children (was useful
+                                      ///< for XML parsed elements).
+  mutable const gd::String
+      *deprecatedArrayOf;  ///< Alternate name for children
 };
 
 }  // namespace gd
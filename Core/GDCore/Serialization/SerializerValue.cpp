@@ -3,155 +3,97 @@
 
 namespace gd {
 
-SerializerValue::SerializerValue()
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {}
+SerializerValue::SerializerValue() : type(Type::Unknown), doubleValue(0) {}
 
 SerializerValue::SerializerValue(bool val)
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {
-  SetBool(val);
-}
+    : type(Type::Boolean), booleanValue(val) {}
+
 SerializerValue::SerializerValue(const gd::String &val)
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {
-  SetString(val);
-}
-SerializerValue::SerializerValue(int val)
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {
-  SetInt(val);
-}
+    : type(Type::String), doubleValue(0), stringValue(val) {}
+
+SerializerValue::SerializerValue(int val) : type(Type::Int), intValue(val) {}
+
 SerializerValue::SerializerValue(double val)
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {
-  SetDouble(val);
-}
+    : type(Type::Double), doubleValue(val) {}
 
 bool SerializerValue::GetBool() const {
-  if (isString || isUnknown)
-    return stringValue != "false";
-  else if (isInt)
-    return intValue != 0;
-  else if (isDouble)
-    return doubleValue != 0.0;
-
-  return booleanValue;
+  switch (type) {
+    case Type::Boolean:
+      return booleanValue;
+    case Type::Int:
+      return intValue != 0;
+    case Type::Double:
+      return doubleValue != 0.0;
+    default:
+      return stringValue != "false";
+  }
 }
 
 gd::String SerializerValue::GetString() const {
-  if (isBoolean)
-    return booleanValue ? gd::String("true") : gd::String("false");
-  else if (isInt)
-    return gd::String::From(intValue);
-  else if (isDouble)
-    return gd::String::From(doubleValue);
-  else if (isUnknown)
-    return stringValue;
-
-  return stringValue;
+  switch (type) {
+    case Type::Boolean:
+      return booleanValue ? gd::String("true") : gd::String("false");
+    case Type::Int:
+      return gd::String::From(intValue);
+    case Type::Double:
+      return gd::String::From(doubleValue);
+    default:
+      return stringValue;
+  }
 }
 
 int SerializerValue::GetInt() const {
-  if (isBoolean)
-    return booleanValue ? 1 : 0;
-  else if (isString || isUnknown)
-    return stringValue.To<int>();
-  else if (isDouble)
-    return doubleValue;
-
-  return intValue;
+  switch (type) {
+    case Type::Boolean:
+      return booleanValue ? 1 : 0;
+    case Type::Int:
+      return intValue;
+    case Type::Double:
+      return doubleValue;
+    default:
+      return stringValue.To<int>();
+  }
 }
 
 double SerializerValue::GetDouble() const {
-  if (isBoolean)
-    return booleanValue ? 1 : 0;
-  else if (isString || isUnknown)
-    return stringValue.To<double>();
-  else if (isInt)
-    return intValue;
-
-  return doubleValue;
+  switch (type) {
+    case Type::Boolean:
+      return booleanValue ? 1 : 0;
+    case Type::Int:
+      return intValue;
+    case Type::Double:
+      return doubleValue;
+    default:
+      return stringValue.To<double>();
+  }
 }
 
 void SerializerValue::Set(const gd::String &val) {
-  isUnknown = true;
-  isBoolean = false;
-  isString = false;
-  isInt = false;
-  isDouble = false;
-
+  type = Type::Unknown;
   stringValue = val;
 }
 
 void SerializerValue::SetBool(bool val) {
-  isUnknown = false;
-  isBoolean = true;
-  isString = false;
-  isInt = false;
-  isDouble = false;
-
+  type = Type::Boolean;
   booleanValue = val;
+  stringValue.clear();
 }
 
 void SerializerValue::SetString(const gd::String &val) {
-  isUnknown = false;
-  isBoolean = false;
-  isString = true;
-  isInt = false;
-  isDouble = false;
-
+  type = Type::String;
   stringValue = val;
 }
 
 void SerializerValue::SetInt(int val) {
-  isUnknown = false;
-  isBoolean = false;
-  isString = false;
-  isInt = true;
-  isDouble = false;
-
+  type = Type::Int;
   intValue = val;
+  stringValue.clear();
 }
 
 void SerializerValue::SetDouble(double val) {
-  isUnknown = false;
-  isBoolean = false;
-  isString = false;
-  isInt = false;
-  isDouble = true;
-
+  type = Type::Double;
   doubleValue = val;
+  stringValue.clear();
 }
 
 }  // namespace gd
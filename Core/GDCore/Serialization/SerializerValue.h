@@ -14,6 +14,9 @@ namespace gd {
 /**
  * \brief A value stored inside a gd::SerializerElement.
  *
+ * The type of the value is stored as a tag, and only the member for this
+ * type is used: booleans, integers and doubles share the same storage.
+ *
  * \see gd::Serializer
  * \see gd::SerializerElement
  */
@@ -24,7 +27,6 @@ class GD_CORE_API SerializerValue {
   SerializerValue(const gd::String &val);
   SerializerValue(int val);
   SerializerValue(double val);
-  virtual ~SerializerValue(){};
 
   /**
    * Set the value, its type being a boolean.
@@ -80,32 +82,37 @@ class GD_CORE_API SerializerValue {
   /**
    * \brief Return true if the value is a boolean.
    */
-  bool IsBoolean() const { return isBoolean; }
+  bool IsBoolean() const { return type == Type::Boolean; }
   /**
    * \brief Return true if the value is a string.
    */
-  bool IsString() const { return isString; }
+  bool IsString() const { return type == Type::String; }
   /**
    * \brief Return true if the value is an int.
    */
-  bool IsInt() const { return isInt; }
+  bool IsInt() const { return type == Type::Int; }
   /**
    * \brief Return true if the value is a double.
    */
-  bool IsDouble() const { return isDouble; }
+  bool IsDouble() const { return type == Type::Double; }
 
  private:
-  bool isUnknown;  ///< If true, the type is unknown but the value is stored as
-                   ///< a string in stringValue member.
-  bool isBoolean;
-  bool isString;
-  bool isInt;
-  bool isDouble;
-
-  bool booleanValue;
-  gd::String stringValue;
-  int intValue;
-  double doubleValue;
+  enum class Type : unsigned char {
+    Unknown,  ///< The type is unknown but the value is stored as a string in
+              ///< stringValue member.
+    Boolean,
+    String,
+    Int,
+    Double
+  };
+
+  Type type;
+  union {
+    bool booleanValue;
+    int intValue;
+    double doubleValue;
+  };
+  gd::String stringValue;  ///< Only used by strings and unknown values.
 };
 
 }  // namespace gd
@@ -19,17 +19,17 @@ namespace gd
 
 constexpr String::size_type String::npos;
 
-String::String() : m_string()
+String::String() : m_string(), m_size(0)
 {
 
 }
 
-String::String(const char *characters) : m_string()
+String::String(const char *characters) : m_string(), m_size(0)
 {
     *this = characters;
 }
 
-String::String(const std::u32string &string) : m_string()
+String::String(const std::u32string &string) : m_string(), m_size(0)
 {
     *this = string;
 }
@@ -37,12 +37,13 @@ String::String(const std::u32string &string) : m_string()
 String& String::operator=(const char *characters)
 {
     m_string = std::string(characters);
+    InvalidateSize();
     return *this;
 }
 
 String& String::operator=(const std::u32string &string)
 {
-    m_string.clear();
+    clear();
 
     //In theory, an UTF8 character can be up to 6 bytes (even if in the current Unicode standard,
     //the last character is 4 bytes long when encoded in UTF8).
@@ -62,7 +63,18 @@ String& String::operator=(const std::u32string &string)
 
 String::size_type String::size() const
 {
-    return std::distance(begin(), end());
+    size_type cachedSize = GetCachedSize();
+    if(cachedSize == npos)
+    {
+        //ASCII characters are one byte long, so there is no need to decode them.
+        bool isAscii = std::all_of(m_string.begin(), m_string.end(),
+            [](char byte) { return static_cast<unsigned char>(byte) < 0x80; });
+
+        cachedSize = isAscii ? m_string.size() : std::distance(begin(), end());
+        m_size.store(cachedSize, std::memory_order_relaxed);
+    }
+
+    return cachedSize;
 }
 
 String::iterator String::begin()
@@ -191,12 +203,16 @@ String& String::ReplaceInvalid( value_type replacement )
     ::utf8::replace_invalid(m_string.begin(), m_string.end(), std::back_inserter(validStr), replacement);
 
     m_string = validStr;
+    InvalidateSize();
 
     return *this;
 }
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
+    if(IsAscii())
+        return static_cast<unsigned char>(m_string[position]);
+
     const_iterator it = begin();
     std::advance(it, position);
     return *it;
@@ -204,13 +220,19 @@ String::value_type String::operator[]( const String::size_type position ) const
 
 String& String::operator+=( const String &other )
 {
+    size_type cachedSize = GetCachedSize();
+    size_type otherCachedSize = other.GetCachedSize();
+
     m_string += other.m_string;
+    SetCachedSize(cachedSize != npos && otherCachedSize != npos ?
+        cachedSize + otherCachedSize : npos);
     return *this;
 }
 
 String& String::operator+=( const char *other )
 {
     m_string += other;
+    InvalidateSize();
     return *this;
 }
 
@@ -223,20 +245,37 @@ String& String::operator+=( value_type character )
 void String::push_back( String::value_type character )
 {
     ::utf8::unchecked::append(character, std::back_inserter(m_string));
+
+    size_type cachedSize = GetCachedSize();
+    if(cachedSize != npos)
+        SetCachedSize(cachedSize + 1);
 }
 
 void String::pop_back()
 {
     m_string.erase((--end()).base(), end().base());
+
+    size_type cachedSize = GetCachedSize();
+    if(cachedSize != npos && cachedSize > 0)
+        SetCachedSize(cachedSize - 1);
 }
 
 String& String::insert( size_type pos, const String &str )
 {
+    size_type newSize = size() + str.size();
+    if(IsAscii())
+    {
+        m_string.insert(pos, str.m_string);
+        SetCachedSize(newSize);
+        return *this;
+    }
+
     iterator it = begin();
     std::advance(it, pos);
 
     //Use the real position as bytes using the std::string::iterators
     m_string.insert( std::distance(m_string.begin(), it.base()), str.m_string );
+    SetCachedSize(newSize);
 
     return *this;
 }
@@ -280,6 +319,7 @@ String &String::RemoveConsecutiveOccurrences(iterator i1,
 String& String::replace( iterator i1, iterator i2, const String &str )
 {
     m_string.replace(i1.base(), i2.base(), str.m_string);
+    InvalidateSize();
 
     return *this;
 }
@@ -287,6 +327,7 @@ String& String::replace( iterator i1, iterator i2, const String &str )
 String& String::replace( iterator i1, iterator i2, size_type n, const char c )
 {
     m_string.replace(i1.base(), i2.base(), n, c);
+    InvalidateSize();
 
     return *this;
 }
@@ -296,6 +337,20 @@ String& String::replace( String::size_type pos, String::size_type len, const cha
     if(pos > size())
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
+    if(IsAscii())
+    {
+        size_type removedCount = std::min(len, size() - pos);
+        size_type newSize = size() - removedCount + 1;
+
+        m_string.replace(pos, removedCount, 1, c);
+        if(static_cast<unsigned char>(c) < 0x80)
+            SetCachedSize(newSize);
+        else
+            InvalidateSize();
+
+        return *this;
+    }
+
     iterator i1 = begin();
     std::advance( i1, pos );
 
@@ -314,6 +369,17 @@ String& String::replace( String::size_type pos, String::size_type len, const Str
     if(pos > size())
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
+    if(IsAscii())
+    {
+        size_type removedCount = std::min(len, size() - pos);
+        size_type newSize = size() - removedCount + str.size();
+
+        m_string.replace(pos, removedCount, str.m_string);
+        SetCachedSize(newSize);
+
+        return *this;
+    }
+
     iterator i1 = begin();
     std::advance( i1, pos );
 
@@ -329,11 +395,13 @@ String& String::replace( String::size_type pos, String::size_type len, const Str
 
 String::iterator String::erase( String::iterator first, String::iterator last )
 {
+    InvalidateSize();
     return iterator( m_string.erase( first.base(), last.base() ) );
 }
 
 String::iterator String::erase( String::iterator p )
 {
+    InvalidateSize();
     return iterator( m_string.erase( p.base() ) );
 }
 
@@ -342,6 +410,17 @@ void String::erase( String::size_type pos, String::size_type len )
     if(pos > size())
         throw std::out_of_range("[gd::String::erase] starting pos greater than size");
 
+    if(IsAscii())
+    {
+        size_type removedCount = std::min(len, size() - pos);
+        size_type newSize = size() - removedCount;
+
+        m_string.erase(pos, removedCount);
+        SetCachedSize(newSize);
+
+        return;
+    }
+
     iterator i1 = begin();
     std::advance(i1, pos);
 
@@ -443,6 +522,7 @@ String& String::Normalize(String::NormForm form)
         newStr = utf8proc_NFKC((unsigned char*)m_string.c_str());
 
     m_string = (char*)newStr;
+    InvalidateSize();
 
     free(newStr);
 
@@ -453,6 +533,16 @@ String String::substr( String::size_type start, String::size_type length ) const
 {
     String str;
 
+    if(IsAscii())
+    {
+        if(start > m_string.size())
+            throw std::out_of_range("[gd::String::substr] starting pos greater than size");
+
+        str.m_string = m_string.substr(start, length);
+        str.SetCachedSize(str.m_string.size());
+        return str;
+    }
+
     const_iterator startIt = begin();
     while(start > 0 && startIt != end())
     {
@@ -463,19 +553,31 @@ String String::substr( String::size_type start, String::size_type length ) const
         throw std::out_of_range("[gd::String::substr] starting pos greater than size");
 
     const_iterator endIt = startIt;
+    size_type charactersCount = 0;
     while(length > 0 && endIt != end())
     {
         ++endIt;
         --length;
+        ++charactersCount;
     }
 
     str.m_string = std::string( startIt.base(), endIt.base() );
+    str.SetCachedSize(charactersCount);
 
     return str;
 }
 
 String::size_type String::find( const String &search, String::size_type pos ) const
 {
+    if(IsAscii())
+    {
+        if(pos >= m_string.size())
+            return npos;
+
+        std::string::size_type findPos = m_string.find( search.m_string, pos );
+        return findPos != std::string::npos ? findPos : npos;
+    }
+
     const_iterator it = begin();
 
     //Move to pos
@@ -514,6 +616,13 @@ String::size_type String::find( const String::value_type search, String::size_ty
 
 String::size_type String::rfind( const String &search, String::size_type pos ) const
 {
+    if(IsAscii())
+    {
+        std::string::size_type findPos = m_string.rfind( search.m_string,
+            pos < m_string.size() ? pos : std::string::npos );
+        return findPos != std::string::npos ? findPos : npos;
+    }
+
     //Move to pos + 1 (we will then get the last byte of the character at pos)
     const_iterator it = begin();
     std::string::const_iterator baseIt;
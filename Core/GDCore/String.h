@@ -9,6 +9,7 @@
 #ifndef GDCORE_UTF8_STRING_H
 #define GDCORE_UTF8_STRING_H
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -120,6 +121,15 @@ public:
      */
     String(const std::u32string &string);
 
+    String(const String &other)
+        : m_string(other.m_string), m_size(other.GetCachedSize()) {}
+
+    String(String &&other) noexcept
+        : m_string(std::move(other.m_string)), m_size(other.GetCachedSize())
+    {
+        other.InvalidateSize();
+    }
+
 /**
  * \}
  */
@@ -142,6 +152,21 @@ public:
 
     String& operator=(const std::u32string &string);
 
+    String& operator=(const String &other)
+    {
+        m_string = other.m_string;
+        SetCachedSize(other.GetCachedSize());
+        return *this;
+    }
+
+    String& operator=(String &&other) noexcept
+    {
+        m_string = std::move(other.m_string);
+        SetCachedSize(other.GetCachedSize());
+        other.InvalidateSize();
+        return *this;
+    }
+
 /**
  * \}
  */
@@ -158,6 +183,9 @@ public:
 
     /**
      * \brief Returns the string's length.
+     *
+     * \note The length is cached: this is linear on the string size only the
+     * first time it's called after the string was modified.
      */
     size_type size() const;
 
@@ -171,7 +199,7 @@ public:
      *
      * **Iterators :** Obviously, all iterators are invalidated.
      */
-    void clear() { m_string.clear(); }
+    void clear() { m_string.clear(); SetCachedSize(0); }
 
     void reserve(gd::String::size_type size) { m_string.reserve(size); }
 
@@ -338,15 +366,19 @@ public:
     /**
      * \brief Returns the code point at the specified position
      * \warning This operator has a linear complexity on the character's
-     * position. You should avoid to use it in a loop and use the iterators
-     * provided by this class instead.
+     * position (unless the string is only made of ASCII characters). You should
+     * avoid to use it in a loop and use the iterators provided by this class
+     * instead.
      */
     value_type operator[]( const size_type position ) const;
 
     /**
      * \brief Get the raw UTF8-encoded std::string
+     *
+     * \warning Don't keep the returned reference to modify the string later,
+     * as the cached length of the string is only reset when this is called.
      */
-    std::string& Raw() { return m_string; }
+    std::string& Raw() { InvalidateSize(); return m_string; }
 
     /**
      * \brief Get the raw UTF8-encoded std::string
@@ -677,8 +709,25 @@ public:
  */
 
 private:
+    size_type GetCachedSize() const { return m_size.load(std::memory_order_relaxed); }
+    void SetCachedSize(size_type size) { m_size.store(size, std::memory_order_relaxed); }
+    void InvalidateSize() { SetCachedSize(npos); }
+
+    /**
+     * \brief Return true if all the characters are one byte long (i.e: the
+     * string is only made of ASCII characters), so that positions in
+     * characters are the same as positions in bytes.
+     */
+    bool IsAscii() const { return size() == m_string.size(); }
+
     std::string m_string; ///< Internal std::string container
 
+    /**
+     * The number of characters of the string, or npos if it must be computed
+     * again. Atomic so that a const String can be read from several threads.
+     */
+    mutable std::atomic<size_type> m_size;
+
 };
 
 /**
@@ -859,8 +908,10 @@ namespace std
  * \section Performance Performance
  * The UTF8 encoding has the advantage to reduce the RAM consumption compared to UTF16 or UTF32 for strings using a lot
  * of latin characters. But the characters variable length brings some performance issues compared to fixed size encoding.
- * That's why the complexity of each methods is written in their documentation. For instance, the size() method is linear
- * on the string size and so is the operator[]().
+ * That's why the complexity of each methods is written in their documentation. For instance, the operator[]() is linear
+ * on the string size. To limit this, the number of characters is cached (so size() is only linear the first time it's
+ * called after a modification), and strings only made of ASCII characters (which are most of the identifiers and the
+ * generated code) are directly indexed by bytes by operator[](), substr(), find(), rfind(), insert(), replace() and erase().
  *
  * \section Conversion Conversions from/to other string types
  * The String handles implicit conversion with std::String (implicit constructor and implicit conversion
@@ -37,5 +37,14 @@ gd::String GetTranslation(const gd::String& str) {
   return GetTranslation(str.c_str());
 }
 
+}  // namespace gd
+#else
+#include "GDCore/Tools/Localization.h"
+
+namespace gd {
+gd::String GetTranslation(const char* str) { return gd::String(str); }
+
+gd::String GetTranslation(const gd::String& str) { return str; }
+
 }  // namespace gd
 #endif
@@ -16,21 +16,26 @@
  * of the underlying platform (Emscripten for GDevelop 5).
  */
 
-#if defined(EMSCRIPTEN)
-// When compiling with Emscripten, use a translation function that is calling a
-// JS method on the module, so that an external translation library can be used.
-
 #include "GDCore/String.h"
-#if defined(_)
-#undef _
-#endif
 
 namespace gd {
+/**
+ * \brief Return the translation of the string. It's only translated when
+ * compiling with Emscripten, otherwise the string is returned unchanged.
+ */
 gd::String GetTranslation(const gd::String& str);
 
 gd::String GetTranslation(const char* str);
 }  // namespace gd
 
+#if defined(EMSCRIPTEN)
+// When compiling with Emscripten, use a translation function that is calling a
+// JS method on the module, so that an external translation library can be used.
+
+#if defined(_)
+#undef _
+#endif
+
 #define _(s) gd::GetTranslation(u8##s)
 
 #else
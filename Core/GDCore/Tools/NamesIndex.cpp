@@ -0,0 +1,13 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/NamesIndex.h"
+
+namespace gd {
+
+constexpr std::size_t NamesIndex::notUpToDate;
+std::mutex NamesIndex::buildMutex;
+
+}  // namespace gd
@@ -0,0 +1,218 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Stored by the elements of a list indexed by a gd::NamesIndex, so that
+ * they can invalidate the index of their list when they are renamed (for
+ * instance with gd::Object::SetName) without knowing their container.
+ *
+ * The link is set by the index when it indexes the element. Copying an element
+ * doesn't copy its link: the copy is linked when it's indexed in its own list.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API NamesIndexLink {
+ public:
+  NamesIndexLink(){};
+  NamesIndexLink(const NamesIndexLink& other){};
+  NamesIndexLink& operator=(const NamesIndexLink& other) { return *this; };
+
+  /**
+   * \brief Invalidate the index of the list of the element, if any. Must be
+   * called when the element is renamed.
+   */
+  void NotifyNameChanged() {
+    if (renamesCount) (*renamesCount)++;
+  }
+
+ private:
+  friend class NamesIndex;
+
+  /// The renames count of the index of the list of the element.
+  mutable std::shared_ptr<std::atomic<std::size_t>> renamesCount;
+};
+
+/**
+ * \brief An index of the positions of the elements of a list by their names,
+ * so that containers can find an element without iterating on the whole list.
+ *
+ * The index is built the first time it's used. Containers must call
+ * Invalidate when they change the list (or only Append when an element is
+ * added at the end). Elements can also be renamed without their container
+ * knowing it (for instance with gd::Object::SetName), so they must store a
+ * gd::NamesIndexLink, given to Find and Append, and notify it when they are
+ * renamed: this only invalidates the index of their own list.
+ *
+ * The index has a single writer: the list and the index must not be modified
+ * while the index is used. Building the index is thread-safe though, so a
+ * container can be read from several threads at the same time. The positions
+ * (and the renames count) are only allocated when the index is first used,
+ * and the mutex is shared by all the indexes, so that lots of small
+ * containers (like the local variables of events) stay small.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API NamesIndex {
+ public:
+  NamesIndex() : upToDateRenamesCount(notUpToDate){};
+
+  /**
+   * \brief Copying an index gives an empty index, which will be built again
+   * from the list of the copied container.
+   */
+  NamesIndex(const NamesIndex& other)
+      : upToDateRenamesCount(notUpToDate){};
+
+  NamesIndex& operator=(const NamesIndex& other) {
+    Invalidate();
+    return *this;
+  };
+
+  /**
+   * \brief Return the position of the first element named \a name, or
+   * gd::String::npos if there is none.
+   *
+   * The index is built (under a lock) if needed. The positions are then read
+   * without the lock, which is safe because they are only changed by the
+   * writer of the list, which must not modify it while it's read.
+   *
+   * \param count The number of elements in the list.
+   * \param getNameAt A function returning the name of the element at a
+   * position, used if the index must be built.
+   * \param getLinkAt A function returning a pointer to the gd::NamesIndexLink
+   * of the element at a position (or nullptr if the elements can't be renamed
+   * without their container knowing it).
+   */
+  template <typename GetNameAt, typename GetLinkAt>
+  std::size_t Find(const gd::String& name,
+                   std::size_t count,
+                   GetNameAt getNameAt,
+                   GetLinkAt getLinkAt) const {
+    if (!IsUpToDate()) {
+      std::lock_guard<std::mutex> lock(buildMutex);
+      if (!IsUpToDate()) {
+        if (!index) index.reset(new Index());
+        std::size_t currentRenamesCount = GetRenamesCount();
+
+        index->positions.clear();
+        index->positions.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+          index->positions.emplace(getNameAt(i), i);
+          const gd::NamesIndexLink* link = getLinkAt(i);
+          if (link) {
+            CreateRenamesCount();
+            Link(link);
+          }
+        }
+        upToDateRenamesCount.store(currentRenamesCount,
+                                   std::memory_order_release);
+      }
+    }
+
+    auto it = index->positions.find(name);
+    return it != index->positions.end() ? it->second : gd::String::npos;
+  }
+
+  /**
+   * \brief Return the position of the first element named \a name, for a list
+   * where elements are only renamed by their container.
+   */
+  template <typename GetNameAt>
+  std::size_t Find(const gd::String& name,
+                   std::size_t count,
+                   GetNameAt getNameAt) const {
+    return Find(name, count, getNameAt, [](std::size_t) {
+      return static_cast<const gd::NamesIndexLink*>(nullptr);
+    });
+  }
+
+  /**
+   * \brief Return true if the index can be used without being built again.
+   */
+  bool IsUpToDate() const {
+    std::size_t upToDate =
+        upToDateRenamesCount.load(std::memory_order_acquire);
+    return upToDate != notUpToDate && upToDate == GetRenamesCount();
+  }
+
+  /**
+   * \brief Update the index after an element was added at the end of the
+   * list.
+   *
+   * \param wasUpToDate The value of IsUpToDate before the element was added.
+   * \param link The link of the element, if it can be renamed without its
+   * container knowing it.
+   */
+  void Append(const gd::String& name,
+              std::size_t position,
+              bool wasUpToDate,
+              const gd::NamesIndexLink* link = nullptr) {
+    if (!wasUpToDate) {
+      Invalidate();
+      return;
+    }
+
+    index->positions.emplace(name, position);
+    if (link) {
+      CreateRenamesCount();
+      Link(link);
+    }
+  }
+
+  /**
+   * \brief Mark the index as needing to be built again.
+   */
+  void Invalidate() { upToDateRenamesCount = notUpToDate; }
+
+ private:
+  /**
+   * \brief Create the renames count if needed, when an element with a link is
+   * indexed. It's only read once the index is up to date, so creating it while
+   * the index is built is safe.
+   */
+  void CreateRenamesCount() const {
+    if (!index->renamesCount)
+      index->renamesCount = std::make_shared<std::atomic<std::size_t>>(0);
+  }
+
+  /**
+   * \brief Return the renames count. Only called once the index is built, or
+   * while it's built.
+   */
+  std::size_t GetRenamesCount() const {
+    return index->renamesCount ? index->renamesCount->load() : 0;
+  }
+
+  void Link(const gd::NamesIndexLink* link) const {
+    link->renamesCount = index->renamesCount;
+  }
+
+  struct Index {
+    std::unordered_map<gd::String, std::size_t> positions;
+    /// Incremented when an indexed element is renamed (shared with their
+    /// links). Only created for lists of elements having a link.
+    std::shared_ptr<std::atomic<std::size_t>> renamesCount;
+  };
+
+  static constexpr std::size_t notUpToDate = static_cast<std::size_t>(-1);
+  static std::mutex buildMutex;
+
+  mutable std::unique_ptr<Index> index;
+  mutable std::atomic<std::size_t> upToDateRenamesCount;
+};
+
+}  // namespace gd
@@ -0,0 +1,68 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Symbol.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace gd {
+
+namespace {
+
+/**
+ * The table of all the interned strings, with their hashes. Elements of an
+ * unordered_map are never moved, so symbols can point to them.
+ */
+std::unordered_map<gd::String, std::size_t>& GetInternedStrings() {
+  static std::unordered_map<gd::String, std::size_t> internedStrings;
+  return internedStrings;
+}
+
+std::mutex& GetInternedStringsMutex() {
+  static std::mutex internedStringsMutex;
+  return internedStringsMutex;
+}
+
+}  // namespace
+
+Symbol::Symbol() {
+  static const Entry* emptyStringEntry = Intern("");
+  entry = emptyStringEntry;
+}
+
+const Symbol::Entry* Symbol::Intern(const gd::String& string) {
+  std::lock_guard<std::mutex> lock(GetInternedStringsMutex());
+  auto& internedStrings = GetInternedStrings();
+  auto it = internedStrings.find(string);
+  if (it == internedStrings.end()) {
+    it = internedStrings.emplace(string, std::hash<gd::String>()(string))
+             .first;
+  }
+
+  return &*it;
+}
+
+const Symbol::Entry* Symbol::Find(const gd::String& string) {
+  std::lock_guard<std::mutex> lock(GetInternedStringsMutex());
+  auto& internedStrings = GetInternedStrings();
+  auto it = internedStrings.find(string);
+  return it != internedStrings.end() ? &*it : nullptr;
+}
+
+bool Symbol::FindInterned(const gd::String& string, Symbol& symbol) {
+  const Entry* foundEntry = Find(string);
+  if (!foundEntry) return false;
+
+  symbol.entry = foundEntry;
+  return true;
+}
+
+std::size_t Symbol::GetInternedStringsCount() {
+  std::lock_guard<std::mutex> lock(GetInternedStringsMutex());
+  return GetInternedStrings().size();
+}
+
+}  // namespace gd
@@ -0,0 +1,94 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An interned string, used for identifiers that are repeated a lot in
+ * a project (object names and layers of instances, types of instructions...).
+ *
+ * Each different string is stored only once, in a global table shared by all
+ * the symbols, and a symbol is only a pointer to it. This means that:
+ * - a symbol takes the memory of a pointer, whatever the length of the string,
+ * - two symbols are compared by comparing their pointers,
+ * - the hash of the string is computed once, when the string is interned.
+ *
+ * Strings are never removed from the table, so symbols should only be used for
+ * identifiers and not for arbitrary texts.
+ *
+ * Interning a string is thread-safe.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API Symbol {
+ public:
+  /**
+   * \brief Construct the symbol of an empty string.
+   */
+  Symbol();
+
+  /**
+   * \brief Construct the symbol of a string, interning the string if it's the
+   * first time it's used.
+   */
+  explicit Symbol(const gd::String& string) : entry(Intern(string)){};
+
+  /**
+   * \brief Set \a symbol to the symbol of a string and return true if the
+   * string is already interned. Otherwise, return false without interning it.
+   *
+   * Use this to compare a string to symbols without filling the table: if the
+   * string was never interned, no symbol can be equal to it.
+   */
+  static bool FindInterned(const gd::String& string, Symbol& symbol);
+
+  /**
+   * \brief Return the interned string.
+   */
+  const gd::String& GetString() const { return entry->first; }
+
+  /**
+   * \brief Return the (precomputed) hash of the string.
+   */
+  std::size_t GetHash() const { return entry->second; }
+
+  bool operator==(const Symbol& other) const { return entry == other.entry; }
+  bool operator!=(const Symbol& other) const { return entry != other.entry; }
+
+  /**
+   * \brief Return the number of strings interned so far.
+   */
+  static std::size_t GetInternedStringsCount();
+
+ private:
+  /**
+   * An interned string and its hash, stored in the global table.
+   */
+  typedef std::pair<const gd::String, std::size_t> Entry;
+
+  static const Entry* Intern(const gd::String& string);
+  static const Entry* Find(const gd::String& string);
+
+  const Entry* entry;
+};
+
+}  // namespace gd
+
+namespace std {
+template <>
+struct GD_CORE_API hash<gd::Symbol> {
+  size_t operator()(const gd::Symbol& symbol) const {
+    return symbol.GetHash();
+  }
+};
+}  // namespace std
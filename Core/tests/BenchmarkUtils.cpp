@@ -0,0 +1,85 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkUtils.h"
+
+#include <chrono>
+#include <iostream>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/String.h"
+
+float DoBenchmark(const gd::String &benchmarkName,
+                  std::size_t runsCount,
+                  std::function<void()> func) {
+  long long totalTimeInMicroseconds = 0;
+  for (std::size_t i = 0; i < runsCount; i++) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+
+    totalTimeInMicroseconds +=
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+            .count();
+  }
+
+  float averageTimeInMicroseconds =
+      (float)totalTimeInMicroseconds / (float)runsCount;
+  std::cout << benchmarkName << " benchmark (" << runsCount
+            << " runs): " << averageTimeInMicroseconds << " microseconds"
+            << std::endl;
+  return averageTimeInMicroseconds;
+}
+
+void InsertLayoutsWithEvents(gd::Project &project,
+                             std::size_t layoutsCount,
+                             std::size_t eventsCount) {
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomething");
+  instruction.SetParametersCount(1);
+
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    gd::Layout &layout = project.InsertNewLayout(
+        "Scene " + gd::String::From(i), project.GetLayoutsCount());
+    for (std::size_t j = 0; j < eventsCount; ++j) {
+      layout.GetVariables()
+          .InsertNew("Variable" + gd::String::From(j))
+          .SetString("Value " + gd::String::From(j));
+
+      gd::StandardEvent event;
+      event.SetFolded(j % 2 == 0);
+      event.GetConditions().Insert(instruction);
+      event.GetActions().Insert(instruction);
+      layout.GetEvents().InsertEvent(event);
+    }
+  }
+}
+
+void InsertObjects(gd::Project &project,
+                   gd::Layout &layout,
+                   const gd::String &namePrefix,
+                   std::size_t objectsCount,
+                   bool withInstances) {
+  for (std::size_t i = 0; i < objectsCount; ++i) {
+    const gd::String name = namePrefix + gd::String::From(i);
+    layout.GetObjects().InsertNewObject(project,
+                                        "MyExtension::Sprite",
+                                        name,
+                                        layout.GetObjects().GetObjectsCount());
+    if (withInstances) {
+      gd::InitialInstance &instance =
+          layout.GetInitialInstances().InsertNewInitialInstance();
+      instance.SetObjectName(name);
+      instance.SetX(i);
+    }
+  }
+}
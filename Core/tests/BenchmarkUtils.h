@@ -0,0 +1,50 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef BENCHMARK_UTILS
+#define BENCHMARK_UTILS
+#include <cstddef>
+#include <functional>
+
+namespace gd {
+class String;
+class Project;
+class Layout;
+}  // namespace gd
+
+/**
+ * Run the function \a runsCount times, and print the average time it took.
+ *
+ * Benchmarks are in their own test cases, named "... - Benchmarks", so that
+ * only them print something.
+ *
+ * \return The average time, in microseconds.
+ */
+float DoBenchmark(const gd::String &benchmarkName,
+                  std::size_t runsCount,
+                  std::function<void()> func);
+
+/**
+ * Insert layouts in the project, each with \a eventsCount standard events
+ * (with an action and a condition, MyExtension::DoSomething) and as many
+ * variables.
+ */
+void InsertLayoutsWithEvents(gd::Project &project,
+                             std::size_t layoutsCount,
+                             std::size_t eventsCount);
+
+/**
+ * Insert sprites (MyExtension::Sprite, see SetupProjectWithDummyPlatform) in
+ * the layout, named \a namePrefix followed by their number, each with an
+ * instance if \a withInstances is true.
+ */
+void InsertObjects(gd::Project &project,
+                   gd::Layout &layout,
+                   const gd::String &namePrefix,
+                   std::size_t objectsCount,
+                   bool withInstances);
+
+#endif
@@ -80,7 +80,8 @@ TEST_CASE("EventsList", "[common][events]") {
     #if defined(WINDOWS)
       REQUIRE(3000 >= endMemory - startMemory);
     #else
-      REQUIRE(1650 >= endMemory - startMemory);
+      // Each gd::String caches its length, which adds a bit of memory.
+      REQUIRE(1750 >= endMemory - startMemory);
     #endif
   }
 }
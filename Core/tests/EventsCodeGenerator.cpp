@@ -7,14 +7,84 @@
  * @file Tests covering events of GDevelop Core.
  */
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include <functional>
 #include <memory>
+#include "BenchmarkUtils.h"
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/CodeOutput.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
+namespace {
+
+/**
+ * Create an extension with a standard event generating a call to a function,
+ * and the code of its sub events. \a beforeGeneration is called before the
+ * code of each event is generated.
+ */
+std::shared_ptr<gd::PlatformExtension> CreateStandardEventExtension(
+    std::function<void(gd::EventsCodeGenerationContext& context)>
+        beforeGeneration) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(
+      "BuiltinCommonInstructions", "instruction extension", "", "", "");
+  extension
+      ->AddEvent("Standard",
+                 "Standard event",
+                 "",
+                 "",
+                 "",
+                 std::make_shared<gd::StandardEvent>())
+      .SetCodeGenerator([beforeGeneration](
+                            gd::BaseEvent& event,
+                            gd::EventsCodeGenerator& codeGenerator,
+                            gd::EventsCodeGenerationContext& context) {
+        beforeGeneration(context);
+
+        gd::String code = "doSomething();\n";
+        if (event.HasSubEvents()) {
+          gd::EventsCodeGenerationContext subEventsContext;
+          subEventsContext.Reuse(context);
+          code += "{\n" +
+                  codeGenerator.GenerateEventsListCode(event.GetSubEvents(),
+                                                       subEventsContext) +
+                  "}\n";
+        }
+        return code;
+      });
+
+  return extension;
+}
+
+/**
+ * Insert \a eventsPerLevel standard events in the list, and as many in the
+ * sub events of the events for which \a hasSubEvents returns true, up to the
+ * given depth.
+ */
+void InsertNestedEvents(gd::EventsList& events,
+                        std::size_t depth,
+                        std::size_t eventsPerLevel,
+                        std::function<bool(std::size_t position)> hasSubEvents) {
+  for (std::size_t i = 0; i < eventsPerLevel; ++i) {
+    auto& event = dynamic_cast<gd::StandardEvent&>(
+        events.InsertEvent(gd::StandardEvent()));
+    event.SetType("BuiltinCommonInstructions::Standard");
+    if (depth > 1 && hasSubEvents(i))
+      InsertNestedEvents(
+          event.GetSubEvents(), depth - 1, eventsPerLevel, hasSubEvents);
+  }
+}
+
+}  // namespace
+
 TEST_CASE("EventsCodeGenerator", "[common][events]") {
   SECTION("Basics") {
     gd::Project project;
@@ -31,4 +101,99 @@ TEST_CASE("EventsCodeGenerator", "[common][events]") {
     REQUIRE(codeGenerator.ConvertToString("{\"hello\":\r\n\"world \\\" \"}") ==
             "{\\\"hello\\\":\\r\\n\\\"world \\\\\\\" \\\"}");
   }
+
+  SECTION("Code output") {
+    gd::String largeCode;
+    for (std::size_t i = 0; i < 200; ++i) largeCode += "0123456789";
+    gd::CodeOutput output;
+    REQUIRE(output.empty());
+    output += "Hello";
+    output += gd::String(" ");
+    output += gd::String(largeCode);
+    output += " world";
+    REQUIRE(output.size() == 2012);
+    REQUIRE(output.ToString() == "Hello " + largeCode + " world");
+
+    // Outputs can be appended to other outputs (and to themselves) without
+    // being changed.
+    gd::CodeOutput otherOutput;
+    otherOutput += "[";
+    otherOutput += output;
+    otherOutput += "]";
+    otherOutput += otherOutput;
+    REQUIRE(output.ToString() == "Hello " + largeCode + " world");
+    REQUIRE(otherOutput.ToString() ==
+            "[Hello " + largeCode + " world][Hello " + largeCode + " world]");
+    REQUIRE(otherOutput.size() == otherOutput.ToString().size());
+  }
+}
+
+TEST_CASE("EventsCodeGenerator - Benchmarks", "[common][events]") {
+  SECTION("Deeply nested events") {
+    gd::Platform platform;
+    platform.AddExtension(
+        CreateStandardEventExtension([](gd::EventsCodeGenerationContext&) {}));
+
+    gd::Project project;
+    auto& layout = project.InsertNewLayout("Scene", 0);
+    const std::size_t eventsPerLevel = 5;
+    InsertNestedEvents(
+        layout.GetEvents(), 200, eventsPerLevel, [&](std::size_t position) {
+          return position == eventsPerLevel - 1;
+        });
+
+    gd::String code;
+    DoBenchmark("Code generation of events 200 levels deep", 1, [&]() {
+      gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+      unsigned int maxDepthLevelReached = 0;
+      gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
+      code = codeGenerator.GenerateEventsListCode(layout.GetEvents(), context);
+    });
+
+    REQUIRE(code.find("doSomething();") != gd::String::npos);
+  }
+
+  SECTION("Deep and wide events using many objects") {
+    gd::Platform platform;
+    std::size_t eventsCount = 0;
+    platform.AddExtension(CreateStandardEventExtension(
+        [&eventsCount](gd::EventsCodeGenerationContext& context) {
+          // Use a few objects, depending on the position of the event. The
+          // first one is shared by the events at the same depth, so that
+          // lists are reused by the last events.
+          std::size_t seed = eventsCount++ * 7;
+          for (std::size_t i = 0; i < 4; ++i) {
+            gd::String objectName =
+                "Object" + gd::String::From(i == 0 ? context.GetContextDepth()
+                                                   : (seed + i * 37) % 300);
+            if (i == 3)
+              context.ObjectsListNeededOrEmptyIfJustDeclared(objectName);
+            else
+              context.ObjectsListNeeded(objectName);
+          }
+        }));
+
+    gd::Project project;
+    auto& layout = project.InsertNewLayout("Scene", 0);
+    InsertNestedEvents(layout.GetEvents(), 6, 6, [](std::size_t position) {
+      return position % 2 == 0;
+    });
+
+    gd::String code;
+    DoBenchmark(
+        "Code generation of events 6 levels deep, using 300 objects", 1, [&]() {
+          gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+          unsigned int maxDepthLevelReached = 0;
+          gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
+          // Like the scene events, where all the objects are available.
+          for (std::size_t i = 0; i < 300; ++i) {
+            context.ObjectsListNeeded("Object" + gd::String::From(i));
+          }
+          code =
+              codeGenerator.GenerateEventsListCode(layout.GetEvents(), context);
+        });
+
+    REQUIRE(code.find("/* Reuse ") != gd::String::npos);
+    REQUIRE(code.find("GetObjectsRawPointers") == gd::String::npos);
+  }
 }
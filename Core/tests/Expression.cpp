@@ -0,0 +1,111 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the parsed tree cached by gd::Expression.
+ */
+#include "GDCore/Events/Expression.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/UsedExtensionsFinder.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("Expression", "[common][events]") {
+  SECTION("The tree is parsed once") {
+    gd::Expression::ResetParsesCount();
+    gd::Expression expression("1+2");
+
+    auto node = expression.GetRootNode();
+    REQUIRE(node != nullptr);
+    REQUIRE(expression.GetRootNode() == node);
+    REQUIRE(gd::Expression::GetParsesCount() == 1);
+  }
+
+  SECTION("The tree is shared between copies") {
+    gd::Expression::ResetParsesCount();
+    gd::Expression expression("1+2");
+    auto node = expression.GetRootNode();
+
+    gd::Expression copiedExpression(expression);
+    REQUIRE(copiedExpression.GetRootNode() == node);
+
+    gd::Expression assignedExpression;
+    assignedExpression = expression;
+    REQUIRE(assignedExpression.GetRootNode() == node);
+    REQUIRE(gd::Expression::GetParsesCount() == 1);
+  }
+
+  SECTION("The tree is parsed again when the expression is changed") {
+    gd::Expression expression("1+2");
+    expression.GetRootNode();
+    gd::Expression copiedExpression(expression);
+    REQUIRE(copiedExpression.GetRootNode() == expression.GetRootNode());
+
+    copiedExpression = gd::Expression("3+4");
+    REQUIRE(copiedExpression.GetRootNode() != expression.GetRootNode());
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                *copiedExpression.GetRootNode()) == "3 + 4");
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                *expression.GetRootNode()) == "1 + 2");
+  }
+
+  SECTION("Trees modified by workers are not shared") {
+    gd::Expression expression("MyObject.X()");
+    gd::Expression copiedExpression(expression);
+    auto sharedNode = expression.GetRootNode();
+
+    auto node = copiedExpression.GetRootNodeForModification();
+    REQUIRE(node != sharedNode);
+    auto functionCall = dynamic_cast<gd::FunctionCallNode *>(node);
+    REQUIRE(functionCall != nullptr);
+    functionCall->objectName = "MyRenamedObject";
+
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            "MyRenamedObject.X()");
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                *expression.GetRootNode()) == "MyObject.X()");
+
+    // A tree not shared can be modified in place.
+    REQUIRE(copiedExpression.GetRootNodeForModification() == node);
+  }
+
+  SECTION("A copied project is not parsed again") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    for (std::size_t i = 0; i < 100; i++) {
+      gd::StandardEvent &event =
+          dynamic_cast<gd::StandardEvent &>(layout.GetEvents().InsertNewEvent(
+              project, "BuiltinCommonInstructions::Standard"));
+
+      gd::Instruction instruction;
+      instruction.SetType("MyExtension::DoSomething");
+      instruction.SetParametersCount(1);
+      instruction.SetParameter(0, gd::Expression("1+2*MyExtension::GetNumber()"));
+      event.GetActions().Insert(instruction);
+    }
+
+    gd::Expression::ResetParsesCount();
+    gd::UsedExtensionsFinder::ScanProject(project);
+    REQUIRE(gd::Expression::GetParsesCount() == 100);
+
+    gd::Expression::ResetParsesCount();
+    gd::UsedExtensionsFinder::ScanProject(project);
+    REQUIRE(gd::Expression::GetParsesCount() == 0);
+
+    gd::Project copiedProject = project;
+    gd::Expression::ResetParsesCount();
+    gd::UsedExtensionsFinder::ScanProject(copiedProject);
+    REQUIRE(gd::Expression::GetParsesCount() == 0);
+  }
+}
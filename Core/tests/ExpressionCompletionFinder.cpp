@@ -5,16 +5,21 @@
  */
 #include "GDCore/IDE/Events/ExpressionCompletionFinder.h"
 
+#include <functional>
 #include <vector>
 
+#include "BenchmarkUtils.h"
 #include "DummyPlatform.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/ExpressionCompletionSession.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ParameterMetadataContainer.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/Project/PropertiesContainer.h"
 #include "catch.hpp"
 
 TEST_CASE("ExpressionCompletionFinder", "[common][events]") {
@@ -438,4 +443,168 @@ TEST_CASE("ExpressionCompletionFinder", "[common][events]") {
               expectedExactFunctionCompletions);
     }
   }
+
+  SECTION("Completion session") {
+    auto& object2 = layout1.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyÉlanObject", 1);
+    object2.GetVariables().InsertNew("myObjectVariable");
+    layout1.GetObjects().GetObjectGroups().InsertNew("MyGroup");
+    project.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    project.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyGlobalObject", 1);
+    project.GetVariables().InsertNew("myGlobalVariable");
+    layout1.GetVariables().InsertNew("MyObject");
+    layout1.GetVariables().InsertNew("myObjectMyObject");
+
+    gd::PropertiesContainer propertiesContainer(
+        gd::EventsFunctionsContainer::Extension);
+    propertiesContainer.InsertNew("MyProperty", 0).SetType("Number");
+    propertiesContainer.InsertNew("myVariable", 1).SetType("Number");
+    gd::ParameterMetadataContainer parameters;
+    parameters.InsertNewParameter("MyParameter", 0).SetType("number");
+    parameters.InsertNewParameter("MyObjectParameter", 1).SetType("object");
+    projectScopedContainers.AddPropertiesContainer(propertiesContainer);
+    projectScopedContainers.AddParameters(parameters);
+
+    auto toStrings =
+        [](const std::vector<gd::ExpressionCompletionDescription>&
+               completions) {
+          std::vector<gd::String> completionsAsString;
+          for (const auto& completion : completions) {
+            completionsAsString.push_back(completion.ToString());
+          }
+          return completionsAsString;
+        };
+
+    SECTION("Completions are the same as without a session") {
+      const std::vector<gd::String> expressions = {
+          "",
+          "My",
+          "my",
+          "MYOBJ",
+          "élan",
+          "Object",
+          "objectmy",
+          "Group",
+          "Property",
+          "Parameter",
+          "MyObject.",
+          "MyObject.myObj",
+          "MyObject.MyBehavior::Func(",
+          "1 + MyObject.GetObjectNumber() + myVar",
+          "MysteryString(\"a\", myVariable, Glob)",
+          "myVariable.child[0]",
+          "(Unknown"};
+      const std::vector<gd::String> types = {"number", "string", "object"};
+
+      for (const gd::String& type : types) {
+        gd::ExpressionCompletionSession session(
+            platform, projectScopedContainers, type);
+        for (const gd::String& expression : expressions) {
+          for (size_t position = 0; position <= expression.size();
+               ++position) {
+            INFO(type << " " << expression << " " << position);
+            REQUIRE(toStrings(session.GetCompletionDescriptionsFor(
+                        expression, position)) ==
+                    getCompletionsFor(type, expression, position));
+          }
+        }
+      }
+    }
+
+    SECTION("Completions are updated when identifiers are changed") {
+      gd::ExpressionCompletionSession session(
+          platform, projectScopedContainers, "number");
+      REQUIRE(session.GetCompletionDescriptionsFor("Other", 0).size() == 1);
+      const gd::ExpressionNode* node = session.GetExpressionNode();
+      REQUIRE(session.GetCompletionDescriptionsFor("Other", 1).size() == 1);
+      REQUIRE(session.GetExpressionNode() == node);
+
+      layout1.GetObjects().InsertNewObject(
+          project, "MyExtension::Sprite", "MyOtherObject", 0);
+      REQUIRE(session.GetCompletionDescriptionsFor("Other", 2).size() == 2);
+      REQUIRE(session.GetCompletionDescriptionsFor("Other", 2) ==
+              gd::ExpressionCompletionFinder::GetCompletionDescriptionsFor(
+                  platform,
+                  projectScopedContainers,
+                  "number",
+                  *parser.ParseExpression("Other"),
+                  2));
+
+      layout1.GetVariables().InsertNew("myOtherVariable");
+      REQUIRE(session.GetCompletionDescriptionsFor("Other", 2).size() == 3);
+
+      // Removed and renamed identifiers are no longer completed.
+      layout1.GetVariables().Remove("myOtherVariable");
+      propertiesContainer.Get("MyProperty").SetName("MyOtherProperty");
+      parameters.RemoveParameter("MyParameter");
+      for (const gd::String& expression : {"Other", "Parameter", "Property"}) {
+        REQUIRE(toStrings(session.GetCompletionDescriptionsFor(expression, 2)) ==
+                getCompletionsFor("number", expression, 2));
+      }
+      // The renamed property is completed instead of the removed variable.
+      REQUIRE(session.GetCompletionDescriptionsFor("Other", 2).size() == 3);
+    }
+  }
+}
+
+TEST_CASE("ExpressionCompletionFinder - Benchmarks", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& layout1 = project.InsertNewLayout("Layout1", 0);
+  InsertObjects(project, layout1, "Enemy", 5000, false);
+  for (std::size_t i = 0; i < 1000; ++i) {
+    layout1.GetVariables().InsertNew("Score" + gd::String::From(i));
+  }
+
+  gd::ProjectScopedContainers projectScopedContainers =
+      gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForProjectAndLayout(project, layout1);
+  gd::ExpressionParser2 parser;
+
+  SECTION("Completions of an expression typed one character at a time") {
+    const gd::String typedExpression = "1 + Enemy42.X() + Score12";
+    auto typeExpression =
+        [&](const gd::String& benchmarkName,
+            std::function<std::size_t(const gd::String& expression,
+                                      size_t position)> getCompletions) {
+          std::size_t completionsCount = 0;
+          std::size_t position = 0;
+          DoBenchmark(benchmarkName, typedExpression.size(), [&]() {
+            position++;
+            completionsCount += getCompletions(
+                typedExpression.substr(0, position), position - 1);
+          });
+          return completionsCount;
+        };
+
+    std::size_t completionsCount = typeExpression(
+        "Completions without a session (per keystroke)",
+        [&](const gd::String& expression, size_t position) {
+          return gd::ExpressionCompletionFinder::GetCompletionDescriptionsFor(
+                     platform,
+                     projectScopedContainers,
+                     "number",
+                     *parser.ParseExpression(expression),
+                     position)
+              .size();
+        });
+
+    gd::ExpressionCompletionSession session(
+        platform, projectScopedContainers, "number");
+    DoBenchmark("Completion session index of 6000 names", 1, [&]() {
+      session.GetIdentifiersIndex();
+    });
+    REQUIRE(session.GetIdentifiersIndex().GetNamesCount() == 6000);
+
+    REQUIRE(typeExpression("Completions with a session (per keystroke)",
+                           [&](const gd::String& expression, size_t position) {
+                             return session
+                                 .GetCompletionDescriptionsFor(expression,
+                                                               position)
+                                 .size();
+                           }) == completionsCount);
+  }
 }
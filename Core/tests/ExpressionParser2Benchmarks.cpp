@@ -3,8 +3,7 @@
  * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
  * reserved. This project is released under the MIT License.
  */
-#include <chrono>
-#include <numeric>
+#include "BenchmarkUtils.h"
 #include "DummyPlatform.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Extensions/Platform.h"
@@ -46,31 +45,8 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
     parseExpressionWithType("unknown");
   };
 
-  auto doBenchmark = [](const gd::String &benchmarkName,
-                        const size_t runsCount,
-                        std::function<void()> func) {
-    std::vector<long long> timesInMicroseconds;
-
-    for (size_t i = 0; i < runsCount; i++) {
-      auto start = std::chrono::steady_clock::now();
-      func();
-      auto end = std::chrono::steady_clock::now();
-
-      timesInMicroseconds.push_back(
-          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
-              .count());
-    }
-
-    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
-              << (float)std::accumulate(timesInMicroseconds.begin(),
-                                        timesInMicroseconds.end(),
-                                        0) /
-                     (float)runsCount
-              << " microseconds" << std::endl;
-  };
-
   SECTION("Parse long expression") {
-    doBenchmark("Parse long expression", 10, [&]() {
+    DoBenchmark("Parse long expression", 10, [&]() {
       REQUIRE_NOTHROW(parseExpression(
           "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
           "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
@@ -117,12 +93,72 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
     });
   }
 
-  SECTION("Parse long expression") {
-    doBenchmark("Long identifier", 100, [&]() {
+  SECTION("Parse long identifier") {
+    DoBenchmark("Long identifier", 100, [&]() {
       REQUIRE_NOTHROW(parseExpression(
           "MyLoooooongIdentifierThatNeverStoooooopsAndContinueAgainAndAgainAndA"
           "gainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"
           "AndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"));
     });
   }
+
+  auto makeExpression = [](size_t length) {
+    gd::String expression;
+    while (expression.size() < length) {
+      expression += "MySpriteObject.X()+cos(3.14)*StrLength(\"Hello world\")+";
+    }
+    expression += "0";
+    return expression;
+  };
+
+  SECTION("Parse expressions of increasing length") {
+    // Parsing time per character should stay roughly constant: parsing must
+    // scale linearly with the length of the expression.
+    const gd::String expression1k = makeExpression(1000);
+    const gd::String expression10k = makeExpression(10000);
+
+    DoBenchmark("Parse 1k characters expression", 10, [&]() {
+      REQUIRE_NOTHROW(parser.ParseExpression(expression1k));
+    });
+    DoBenchmark("Parse 10k characters expression", 10, [&]() {
+      REQUIRE_NOTHROW(parser.ParseExpression(expression10k));
+    });
+  }
+
+  SECTION("Allocations of nodes") {
+    // Nodes are allocated in blocks: the number of allocations done on the
+    // system must be a fraction of the number of nodes.
+    const gd::String expression = makeExpression(10000);
+
+    std::size_t allocatedBlocksCount =
+        gd::ExpressionNodeArena::GetAllocatedBlocksCount();
+    gd::ExpressionNodeArena::ResetCounters();
+    auto node = parser.ParseExpression(expression);
+    REQUIRE(node != nullptr);
+    std::size_t allocationsCount =
+        gd::ExpressionNodeArena::GetAllocationsCount();
+    std::size_t systemAllocationsCount =
+        gd::ExpressionNodeArena::GetSystemAllocationsCount();
+    REQUIRE(allocationsCount > systemAllocationsCount * 10);
+
+    // Each tree has its own blocks, given back when the tree is destroyed.
+    auto smallNode = parser.ParseExpression("1 + 2");
+    REQUIRE(gd::ExpressionNodeArena::GetAllocatedBlocksCount() ==
+            allocatedBlocksCount + systemAllocationsCount + 1);
+    node.reset();
+    REQUIRE(gd::ExpressionNodeArena::GetAllocatedBlocksCount() ==
+            allocatedBlocksCount + 1);
+    smallNode.reset();
+    REQUIRE(gd::ExpressionNodeArena::GetAllocatedBlocksCount() ==
+            allocatedBlocksCount);
+
+    // Nodes created outside of an arena are allocated as usual.
+    gd::ExpressionNodeArena::ResetCounters();
+    auto textNode = gd::make_unique<gd::TextNode>("Hello");
+    REQUIRE(gd::ExpressionNodeArena::GetAllocationsCount() == 0);
+
+    DoBenchmark("Parse and destroy 10k characters expression", 10, [&]() {
+      parser.ParseExpression(expression);
+    });
+  }
 }
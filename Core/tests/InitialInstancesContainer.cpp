@@ -12,8 +12,10 @@
 #include <initializer_list>
 #include <map>
 
+#include "BenchmarkUtils.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/InitialInstancesSpatialIndex.h"
 #include "GDCore/Tools/VersionWrapper.h"
 
 void AddNewInitialInstance(gd::InitialInstancesContainer &container,
@@ -225,4 +227,107 @@ TEST_CASE("InitialInstancesContainer", "[common][instances]") {
     REQUIRE(container.SomeInstancesAreOnLayer("layer3") == false);
     REQUIRE(container.SomeInstancesAreOnLayer("layer5") == false);
   }
+
+  SECTION("Copy") {
+    gd::InitialInstancesContainer copiedContainer = container;
+    copiedContainer.RenameInstancesOfObject("object1", "object4");
+
+    AllInstancesFunctor func;
+    container.IterateOverInstances(func);
+    REQUIRE(func.Compare({MakeInstance("object1", "layer1", 10),
+                          MakeInstance("object1", "layer2", 10),
+                          MakeInstance("object1", "layer1", 14),
+                          MakeInstance("object2", "layer1", 12),
+                          MakeInstance("object2", "layer1", 10),
+                          MakeInstance("object3", "layer2", 11),
+                          MakeInstance("object3", "layer2", 9)}) == true);
+    REQUIRE(copiedContainer.HasInstancesOfObject("object4") == true);
+    REQUIRE(copiedContainer.GetInstancesCount() == 7);
+  }
+}
+
+TEST_CASE("InitialInstancesSpatialIndex", "[common][instances]") {
+  gd::InitialInstancesContainer container;
+  auto addInstance = [&container](const gd::String &layer, double x, double y) {
+    auto &instance = container.InsertNewInitialInstance();
+    instance.SetObjectName("MyObject");
+    instance.SetLayer(layer);
+    instance.SetX(x);
+    instance.SetY(y);
+    return &instance;
+  };
+
+  SECTION("Find instances in a rectangle") {
+    auto *instance1 = addInstance("", 10, 10);
+    auto *instance2 = addInstance("", 300, 20);
+    auto *instance3 = addInstance("", -600, -400);
+    addInstance("", 5000, 5000);
+    addInstance("OtherLayer", 10, 10);
+
+    gd::InitialInstancesSpatialIndex index(256);
+    index.Build(container);
+    REQUIRE(index.GetLayerInstancesCount("") == 4);
+    REQUIRE(index.GetLayerInstancesCount("OtherLayer") == 1);
+    REQUIRE(index.GetLayerInstancesCount("UnknownLayer") == 0);
+
+    auto instances = index.GetInstancesInRectangle("", 0, 0, 400, 100);
+    REQUIRE(instances.size() == 2);
+    REQUIRE(std::find(instances.begin(), instances.end(), instance1) !=
+            instances.end());
+    REQUIRE(std::find(instances.begin(), instances.end(), instance2) !=
+            instances.end());
+
+    instances = index.GetInstancesInRectangle("", -1000, -1000, 20, 20);
+    REQUIRE(instances.size() == 2);
+    REQUIRE(std::find(instances.begin(), instances.end(), instance3) !=
+            instances.end());
+
+    // A rectangle larger than the scene finds every instance of the layer.
+    REQUIRE(index.GetInstancesInRectangle("", -1e9, -1e9, 1e9, 1e9).size() ==
+            4);
+    REQUIRE(index.GetInstancesInRectangle("OtherLayer", 0, 0, 20, 20).size() ==
+            1);
+    REQUIRE(index.GetInstancesInRectangle("UnknownLayer", 0, 0, 20, 20)
+                .empty());
+  }
+}
+
+TEST_CASE("InitialInstancesSpatialIndex - Benchmarks", "[common][instances]") {
+  // A scene with tile-like instances on a 250x200 grid.
+  gd::InitialInstancesContainer container;
+  for (std::size_t y = 0; y < 200; y++) {
+    for (std::size_t x = 0; x < 250; x++) {
+      auto &instance = container.InsertNewInitialInstance();
+      instance.SetObjectName("MyObject");
+      instance.SetX(x * 32);
+      instance.SetY(y * 32);
+    }
+  }
+  const std::size_t queriesCount = 100;
+
+  gd::InitialInstancesSpatialIndex index(256);
+  index.Build(container);
+
+  std::size_t linearFoundCount = 0;
+  DoBenchmark("Instances in a rectangle, with a linear search",
+              queriesCount,
+              [&]() {
+                container.IterateOverInstances(
+                    [&](gd::InitialInstance &instance) {
+                      if (instance.GetLayer() == "" &&
+                          instance.GetX() >= 1000 && instance.GetX() <= 1800 &&
+                          instance.GetY() >= 1000 && instance.GetY() <= 1600)
+                        linearFoundCount++;
+                      return false;
+                    });
+              });
+
+  std::size_t indexedFoundCount = 0;
+  DoBenchmark(
+      "Instances in a rectangle, with the index", queriesCount, [&]() {
+        indexedFoundCount +=
+            index.GetInstancesInRectangle("", 1000, 1000, 1800, 1600).size();
+      });
+
+  REQUIRE(indexedFoundCount == linearFoundCount);
 }
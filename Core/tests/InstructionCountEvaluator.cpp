@@ -7,10 +7,12 @@
 
 #include <algorithm>
 
+#include "BenchmarkUtils.h"
 #include "DummyPlatform.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "catch.hpp"
@@ -35,6 +37,53 @@ TEST_CASE("InstructionsCountEvaluator", "[events]") {
 
     REQUIRE(gd::InstructionsCountEvaluator::ScanProject(project) == 1);
   }
+
+  SECTION("Can count instructions with several threads") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    for (std::size_t i = 0; i < 20; ++i) {
+      auto &layout =
+          project.InsertNewLayout("Layout" + gd::String::From(i), i);
+      auto &externalEvents = project.InsertNewExternalEvents(
+          "ExternalEvents" + gd::String::From(i), i);
+      for (std::size_t j = 0; j < 500; ++j) {
+        gd::StandardEvent event;
+        gd::Instruction instruction;
+        instruction.SetType("MyExtension::DoSomething");
+        instruction.SetParametersCount(1);
+        event.GetActions().Insert(instruction);
+        event.GetConditions().Insert(instruction);
+        layout.GetEvents().InsertEvent(event);
+        externalEvents.GetEvents().InsertEvent(event);
+      }
+    }
+
+    for (std::size_t threadsCount : {1, 2, 4, 8}) {
+      REQUIRE(gd::InstructionsCountEvaluator::ScanProject(
+                  project, threadsCount) == 40000);
+    }
+  }
+}
+
+TEST_CASE("InstructionsCountEvaluator - Benchmarks", "[events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  InsertLayoutsWithEvents(project, 40, 500);
+
+  for (std::size_t threadsCount : {1, 2, 4, 8}) {
+    int instructionsCount = 0;
+    DoBenchmark("InstructionsCountEvaluator with " +
+                    gd::String::From(threadsCount) + " thread(s)",
+                1,
+                [&]() {
+                  instructionsCount =
+                      gd::InstructionsCountEvaluator::ScanProject(
+                          project, threadsCount);
+                });
+    REQUIRE(instructionsCount == 40000);
+  }
 }
 
 } // namespace
\ No newline at end of file
@@ -0,0 +1,198 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lookup of metadata by gd::MetadataProvider.
+ */
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+
+#include <memory>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Tools/Symbol.h"
+#include "catch.hpp"
+
+namespace {
+
+// The linear search that was done by gd::MetadataProvider before the metadata
+// were indexed, used to compare results and speed.
+const gd::InstructionMetadata* LinearSearchActionMetadata(
+    const gd::Platform& platform, const gd::String& actionType) {
+  for (auto& extension : platform.GetAllPlatformExtensions()) {
+    const auto& allActions = extension->GetAllActions();
+    if (allActions.find(actionType) != allActions.end())
+      return &allActions.find(actionType)->second;
+
+    for (const gd::String& objectType : extension->GetExtensionObjectsTypes()) {
+      const auto& allObjectsActions =
+          extension->GetAllActionsForObject(objectType);
+      if (allObjectsActions.find(actionType) != allObjectsActions.end())
+        return &allObjectsActions.find(actionType)->second;
+    }
+
+    for (const gd::String& behaviorType : extension->GetBehaviorsTypes()) {
+      const auto& allBehaviorsActions =
+          extension->GetAllActionsForBehavior(behaviorType);
+      if (allBehaviorsActions.find(actionType) != allBehaviorsActions.end())
+        return &allBehaviorsActions.find(actionType)->second;
+    }
+  }
+
+  return nullptr;
+}
+
+const gd::ObjectMetadata* LinearSearchObjectMetadata(
+    const gd::Platform& platform, const gd::String& objectType) {
+  for (auto& extension : platform.GetAllPlatformExtensions()) {
+    auto objectsTypes = extension->GetExtensionObjectsTypes();
+    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
+      if (objectsTypes[j] == objectType)
+        return &extension->GetObjectMetadata(objectType);
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace
+
+TEST_CASE("MetadataProvider", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  SECTION("Metadata are found by type") {
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(
+                platform, "MyExtension::DoSomething")
+                .GetExtension()
+                .GetName() == "MyExtension");
+    REQUIRE(&gd::MetadataProvider::GetActionMetadata(
+                platform, "MyExtension::DoSomething") ==
+            LinearSearchActionMetadata(platform, "MyExtension::DoSomething"));
+    REQUIRE(&gd::MetadataProvider::GetActionMetadata(
+                platform, "MyExtension::BehaviorDoSomething") ==
+            LinearSearchActionMetadata(platform,
+                                       "MyExtension::BehaviorDoSomething"));
+    REQUIRE(&gd::MetadataProvider::GetObjectMetadata(platform,
+                                                     "MyExtension::Sprite") ==
+            LinearSearchObjectMetadata(platform, "MyExtension::Sprite"));
+    REQUIRE(!gd::MetadataProvider::IsBadBehaviorMetadata(
+        gd::MetadataProvider::GetBehaviorMetadata(platform,
+                                                  "MyExtension::MyBehavior")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetObjectNumber")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetBehaviorStrExpressionMetadata(
+            platform,
+            "MyExtension::MyBehavior",
+            "GetBehaviorStringWith1Param")));
+  }
+
+  SECTION("Instructions metadata are found by the symbols of their types") {
+    REQUIRE(&gd::MetadataProvider::GetActionMetadata(
+                platform, gd::Symbol("MyExtension::DoSomething")) ==
+            LinearSearchActionMetadata(platform, "MyExtension::DoSomething"));
+    REQUIRE(&gd::MetadataProvider::GetActionMetadata(
+                platform, gd::Symbol("SetNumberObjectVariable")) ==
+            LinearSearchActionMetadata(platform, "SetNumberObjectVariable"));
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetConditionMetadata(
+            platform, gd::Symbol("NumberVariable"))));
+    REQUIRE(&gd::MetadataProvider::GetExtensionAndConditionMetadata(
+                 platform, gd::Symbol("NumberVariable"))
+                 .GetMetadata() ==
+            &gd::MetadataProvider::GetConditionMetadata(platform,
+                                                        "NumberVariable"));
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(
+            platform, gd::Symbol("UnknownAction"))));
+  }
+
+  SECTION("Object expressions fall back to the base object expressions") {
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetFromBaseExpression")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "UnknownObject", "GetFromBaseExpression")));
+  }
+
+  SECTION("Unknown types give bad metadata") {
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform, "UnknownAction")));
+    REQUIRE(gd::MetadataProvider::IsBadObjectMetadata(
+        gd::MetadataProvider::GetObjectMetadata(platform, "UnknownObject")));
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "UnknownExpression")));
+  }
+
+  SECTION("Metadata of added and removed extensions are updated") {
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "OtherExtension::DoOther")));
+
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(
+        "OtherExtension", "Other testing extension", "", "", "");
+    extension->AddAction("DoOther", "Do other", "", "", "", "", "");
+    platform.AddExtension(extension);
+
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "OtherExtension::DoOther")));
+
+    platform.RemoveExtension("OtherExtension");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "OtherExtension::DoOther")));
+  }
+}
+
+TEST_CASE("MetadataProvider - Benchmarks", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  const std::vector<gd::String> actionTypes = {
+      "MyExtension::DoSomething",
+      "MyExtension::BehaviorDoSomething",
+      "SetNumberObjectVariable",
+      "UnknownAction"};
+  const std::size_t lookupsCount = 100000;
+
+  DoBenchmark("Action metadata linear search", 1, [&]() {
+    for (std::size_t i = 0; i < lookupsCount; i++) {
+      LinearSearchActionMetadata(platform, actionTypes[i % actionTypes.size()]);
+    }
+  });
+  DoBenchmark("Action metadata indexed search", 1, [&]() {
+    for (std::size_t i = 0; i < lookupsCount; i++) {
+      gd::MetadataProvider::GetActionMetadata(
+          platform, actionTypes[i % actionTypes.size()]);
+    }
+  });
+
+  std::vector<gd::Symbol> actionSymbols;
+  for (const gd::String& type : actionTypes)
+    actionSymbols.push_back(gd::Symbol(type));
+  DoBenchmark("Action metadata indexed search by symbol", 1, [&]() {
+    for (std::size_t i = 0; i < lookupsCount; i++) {
+      gd::MetadataProvider::GetActionMetadata(
+          platform, actionSymbols[i % actionSymbols.size()]);
+    }
+  });
+}
@@ -0,0 +1,318 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the names indexes used by containers to find elements
+ * by their names.
+ */
+#include "GDCore/Tools/NamesIndex.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesContainer.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "catch.hpp"
+
+TEST_CASE("NamesIndex", "[common]") {
+  SECTION("Renaming an element only invalidates the index of its list") {
+    std::vector<gd::String> names = {"Element1", "Element2"};
+    std::vector<gd::String> otherNames = {"Element1"};
+    gd::NamesIndexLink links[2];
+    gd::NamesIndexLink otherLink;
+    gd::NamesIndex index;
+    gd::NamesIndex otherIndex;
+    index.Invalidate();
+    otherIndex.Invalidate();
+    auto find = [&](const gd::String &name) {
+      return index.Find(
+          name,
+          names.size(),
+          [&](std::size_t i) { return names[i]; },
+          [&](std::size_t i) { return &links[i]; });
+    };
+    auto findInOther = [&](const gd::String &name) {
+      return otherIndex.Find(
+          name,
+          otherNames.size(),
+          [&](std::size_t i) { return otherNames[i]; },
+          [&](std::size_t) { return &otherLink; });
+    };
+
+    REQUIRE(find("Element2") == 1);
+    REQUIRE(findInOther("Element1") == 0);
+    REQUIRE(index.IsUpToDate());
+    REQUIRE(otherIndex.IsUpToDate());
+
+    names[1] = "RenamedElement2";
+    links[1].NotifyNameChanged();
+    REQUIRE(!index.IsUpToDate());
+    REQUIRE(otherIndex.IsUpToDate());
+    REQUIRE(find("Element2") == gd::String::npos);
+    REQUIRE(find("RenamedElement2") == 1);
+
+    // A copy of an element is not linked to the list of the original.
+    gd::NamesIndexLink copiedLink = links[0];
+    copiedLink.NotifyNameChanged();
+    REQUIRE(index.IsUpToDate());
+
+    // Appended elements are linked.
+    names.push_back("Element3");
+    gd::NamesIndexLink appendedLink;
+    index.Append("Element3", 2, index.IsUpToDate(), &appendedLink);
+    REQUIRE(find("Element3") == 2);
+    appendedLink.NotifyNameChanged();
+    REQUIRE(!index.IsUpToDate());
+  }
+
+  SECTION("ObjectsContainer") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::ObjectsContainer container(gd::ObjectsContainer::SourceType::Scene);
+
+    container.InsertNewObject(project, "MyExtension::Sprite", "Object1", 0);
+    container.InsertNewObject(project, "MyExtension::Sprite", "Object2", 1);
+    REQUIRE(container.GetObjectPosition("Object1") == 0);
+    REQUIRE(container.GetObjectPosition("Object2") == 1);
+
+    // Insert in the middle.
+    container.InsertNewObject(project, "MyExtension::Sprite", "Object3", 0);
+    REQUIRE(container.GetObjectPosition("Object3") == 0);
+    REQUIRE(container.GetObjectPosition("Object1") == 1);
+    REQUIRE(container.GetObject("Object2").GetName() == "Object2");
+
+    // Rename an object directly.
+    container.GetObject("Object1").SetName("RenamedObject1");
+    REQUIRE(!container.HasObjectNamed("Object1"));
+    REQUIRE(container.GetObjectPosition("RenamedObject1") == 1);
+
+    container.MoveObject(0, 2);
+    REQUIRE(container.GetObjectPosition("RenamedObject1") == 0);
+    REQUIRE(container.GetObjectPosition("Object3") == 2);
+
+    container.RemoveObject("RenamedObject1");
+    REQUIRE(!container.HasObjectNamed("RenamedObject1"));
+    REQUIRE(container.GetObjectPosition("Object2") == 0);
+    REQUIRE(container.GetObjectPosition("Object3") == 1);
+
+    // The copy has its own index.
+    gd::ObjectsContainer copy = container;
+    container.RemoveObject("Object2");
+    REQUIRE(copy.GetObjectPosition("Object2") == 0);
+    REQUIRE(container.GetObjectPosition("Object3") == 0);
+
+    // Objects of the copy are renamed without changing the original.
+    copy.GetObject("Object3").SetName("RenamedObject3");
+    REQUIRE(copy.GetObjectPosition("RenamedObject3") == 1);
+    REQUIRE(container.GetObjectPosition("Object3") == 0);
+    REQUIRE(!container.HasObjectNamed("RenamedObject3"));
+
+    // Replace an object by another one.
+    container.GetObject("Object3") = copy.GetObject("Object2");
+    REQUIRE(!container.HasObjectNamed("Object3"));
+    REQUIRE(container.GetObjectPosition("Object2") == 0);
+  }
+
+  SECTION("VariablesContainer") {
+    gd::VariablesContainer container;
+    container.InsertNew("Variable1");
+    container.InsertNew("Variable2");
+    container.InsertNew("Variable3", 0);
+    REQUIRE(container.GetPosition("Variable3") == 0);
+    REQUIRE(container.GetPosition("Variable1") == 1);
+    REQUIRE(container.GetPosition("Variable2") == 2);
+
+    container.Rename("Variable1", "RenamedVariable1");
+    REQUIRE(!container.Has("Variable1"));
+    REQUIRE(container.GetPosition("RenamedVariable1") == 1);
+
+    container.Swap(0, 2);
+    REQUIRE(container.GetPosition("Variable2") == 0);
+    REQUIRE(container.GetPosition("Variable3") == 2);
+
+    container.Move(0, 1);
+    REQUIRE(container.GetPosition("RenamedVariable1") == 0);
+    REQUIRE(container.GetPosition("Variable2") == 1);
+
+    container.Remove("RenamedVariable1");
+    REQUIRE(container.GetPosition("Variable2") == 0);
+    REQUIRE(container.GetPosition("Variable3") == 1);
+
+    container.Clear();
+    REQUIRE(!container.Has("Variable2"));
+  }
+
+  SECTION("ResourcesContainer") {
+    gd::ResourcesContainer container(gd::ResourcesContainer::SourceType::Global);
+    container.AddResource("Resource1", "res/1.png", "image");
+    container.AddResource("Resource2", "res/2.png", "image");
+    REQUIRE(container.GetResourcePosition("Resource2") == 1);
+
+    container.RenameResource("Resource1", "RenamedResource1");
+    REQUIRE(!container.HasResource("Resource1"));
+    REQUIRE(container.GetResourcePosition("RenamedResource1") == 0);
+
+    // Rename a resource directly.
+    container.GetResource("Resource2").SetName("RenamedResource2");
+    REQUIRE(!container.HasResource("Resource2"));
+    REQUIRE(container.GetResource("RenamedResource2").GetFile() == "res/2.png");
+
+    container.MoveResourceDownInList("RenamedResource1");
+    REQUIRE(container.GetResourcePosition("RenamedResource1") == 1);
+
+    container.RemoveResource("RenamedResource2");
+    REQUIRE(container.GetResourcePosition("RenamedResource1") == 0);
+  }
+
+  SECTION("Project layouts") {
+    gd::Project project;
+    project.InsertNewLayout("Scene1", 0);
+    project.InsertNewLayout("Scene2", 1);
+    project.InsertNewLayout("Scene3", 0);
+    REQUIRE(project.GetLayoutPosition("Scene3") == 0);
+    REQUIRE(project.GetLayoutPosition("Scene2") == 2);
+
+    project.GetLayout("Scene1").SetName("RenamedScene1");
+    REQUIRE(!project.HasLayoutNamed("Scene1"));
+    REQUIRE(project.GetLayout("RenamedScene1").GetName() == "RenamedScene1");
+
+    project.SwapLayouts(0, 2);
+    REQUIRE(project.GetLayoutPosition("Scene2") == 0);
+
+    project.RemoveLayout("Scene2");
+    REQUIRE(project.GetLayoutPosition("RenamedScene1") == 0);
+    REQUIRE(project.GetLayoutPosition("Scene3") == 1);
+
+    // Replace a layout by another one.
+    gd::Layout layout;
+    layout.SetName("OtherScene");
+    project.GetLayout("Scene3") = layout;
+    REQUIRE(!project.HasLayoutNamed("Scene3"));
+    REQUIRE(project.GetLayoutPosition("OtherScene") == 1);
+  }
+}
+
+TEST_CASE("NamesIndex - Benchmarks", "[common]") {
+  const std::size_t lookupsCount = 1000;
+  auto doBenchmark = [&](const gd::String &benchmarkName,
+                         std::size_t elementsCount,
+                         std::function<bool(const gd::String &)> hasElement,
+                         std::function<bool(const gd::String &)> linearSearch) {
+    const gd::String lookups = gd::String::From(lookupsCount) +
+                               " lookups among " +
+                               gd::String::From(elementsCount) + " elements";
+    DoBenchmark(benchmarkName + ", linear search, " + lookups, 1, [&]() {
+      for (std::size_t i = 0; i < lookupsCount; ++i) {
+        REQUIRE(linearSearch("Element" +
+                             gd::String::From((i * 7919) % elementsCount)));
+      }
+    });
+    DoBenchmark(benchmarkName + ", " + lookups, 1, [&]() {
+      for (std::size_t i = 0; i < lookupsCount; ++i) {
+        REQUIRE(hasElement("Element" +
+                           gd::String::From((i * 7919) % elementsCount)));
+      }
+    });
+    REQUIRE(!hasElement("MissingElement"));
+  };
+
+  for (std::size_t elementsCount : {10, 1000, 50000}) {
+    SECTION("ObjectsContainer with " + std::to_string(elementsCount) +
+            " objects") {
+      gd::Platform platform;
+      gd::Project project;
+      SetupProjectWithDummyPlatform(project, platform);
+      gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+      InsertObjects(project, layout, "Element", elementsCount, false);
+      const gd::ObjectsContainer &container = layout.GetObjects();
+
+      doBenchmark(
+          "ObjectsContainer::HasObjectNamed",
+          elementsCount,
+          [&](const gd::String &name) {
+            return container.HasObjectNamed(name);
+          },
+          [&](const gd::String &name) {
+            for (const auto &object : container.GetObjects()) {
+              if (object->GetName() == name) return true;
+            }
+            return false;
+          });
+    }
+
+    SECTION("VariablesContainer with " + std::to_string(elementsCount) +
+            " variables") {
+      gd::VariablesContainer container;
+      for (std::size_t i = 0; i < elementsCount; ++i) {
+        container.InsertNew("Element" + gd::String::From(i));
+      }
+
+      doBenchmark(
+          "VariablesContainer::Has",
+          elementsCount,
+          [&](const gd::String &name) { return container.Has(name); },
+          [&](const gd::String &name) {
+            for (std::size_t i = 0; i < container.Count(); ++i) {
+              if (container.GetNameAt(i) == name) return true;
+            }
+            return false;
+          });
+    }
+
+    SECTION("ResourcesContainer with " + std::to_string(elementsCount) +
+            " resources") {
+      gd::ResourcesContainer container(
+          gd::ResourcesContainer::SourceType::Global);
+      for (std::size_t i = 0; i < elementsCount; ++i) {
+        container.AddResource(
+            "Element" + gd::String::From(i), "res/image.png", "image");
+      }
+
+      doBenchmark(
+          "ResourcesContainer::HasResource",
+          elementsCount,
+          [&](const gd::String &name) { return container.HasResource(name); },
+          [&](const gd::String &name) {
+            for (const auto &resource : container.GetAllResources()) {
+              if (resource->GetName() == name) return true;
+            }
+            return false;
+          });
+    }
+
+    SECTION("Project with " + std::to_string(elementsCount) + " layouts") {
+      gd::Project project;
+      // Layouts are large, so don't create more than a (very) big project
+      // would have.
+      const std::size_t layoutsCount =
+          std::min<std::size_t>(elementsCount, 5000);
+      for (std::size_t i = 0; i < layoutsCount; ++i) {
+        project.InsertNewLayout("Element" + gd::String::From(i),
+                                project.GetLayoutsCount());
+      }
+
+      doBenchmark(
+          "Project::HasLayoutNamed",
+          layoutsCount,
+          [&](const gd::String &name) { return project.HasLayoutNamed(name); },
+          [&](const gd::String &name) {
+            for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+              if (project.GetLayout(i).GetName() == name) return true;
+            }
+            return false;
+          });
+    }
+  }
+}
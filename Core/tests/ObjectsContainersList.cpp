@@ -176,6 +176,81 @@ TEST_CASE("ObjectContainersList (GetTypeOfObject)", "[common]") {
     REQUIRE(objectsContainersList.GetTypeOfObject(
                 "MyGroup") == "");
   }
+
+  SECTION("Find the type of an object with a single container") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    layout.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                        "MyObject", 0);
+
+    auto objectsContainersList = gd::ObjectsContainersList::
+        MakeNewObjectsContainersListForContainer(layout.GetObjects());
+
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyObject") ==
+            "MyExtension::Sprite");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyWrongObject") == "");
+  }
+
+  SECTION("Update the type of a group when objects or the group change") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    gd::Object &object1 = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject1", 0);
+    // This object is global.
+    gd::Object &object2 = project.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject2", 0);
+
+    auto &group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+    group.AddObject(object1.GetName());
+    group.AddObject(object2.GetName());
+
+    auto objectsContainersList = gd::ObjectsContainersList::
+        MakeNewObjectsContainersListForProjectAndLayout(project, layout);
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") ==
+            "MyExtension::Sprite");
+
+    // Add an object of another type in the group.
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::FakeObjectWithDefaultBehavior", "MyObject3", 0);
+    group.AddObject("MyObject3");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") == "");
+
+    group.RemoveObject("MyObject3");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") ==
+            "MyExtension::Sprite");
+
+    // Rename an object without updating the group.
+    object1.SetName("MyRenamedObject1");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") == "");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyRenamedObject1") ==
+            "MyExtension::Sprite");
+
+    group.RenameObject("MyObject1", "MyRenamedObject1");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") ==
+            "MyExtension::Sprite");
+
+    // Change the type of an object.
+    object2.SetType("MyExtension::FakeObjectWithDefaultBehavior");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") == "");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyObject2") ==
+            "MyExtension::FakeObjectWithDefaultBehavior");
+
+    // Rename the group.
+    layout.GetObjects().GetObjectGroups().Rename("MyGroup", "MyRenamedGroup");
+    REQUIRE(!objectsContainersList.HasObjectOrGroupNamed("MyGroup"));
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") == "");
+
+    // Remove an object.
+    project.GetObjects().RemoveObject("MyObject2");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyObject2") == "");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyRenamedGroup") == "");
+  }
 }
 
 TEST_CASE("ObjectContainersList (GetTypeOfBehaviorInObjectOrGroup)",
@@ -399,6 +474,44 @@ TEST_CASE("ObjectContainersList (GetBehaviorsOfObject)", "[common]") {
         objectsContainersList.GetBehaviorsOfObject("MyGroup", true);
     REQUIRE(behaviors.size() == 1);
     REQUIRE(behaviors[0] == "MyBehavior");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup", false)
+                .empty());
+  }
+
+  SECTION("Update the behaviors of a group when behaviors change") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    gd::Object &object1 = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject1", 0);
+    object1.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    gd::Object &object2 = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject2", 0);
+
+    auto &group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+    group.AddObject(object1.GetName());
+    group.AddObject(object2.GetName());
+
+    auto objectsContainersList = gd::ObjectsContainersList::
+        MakeNewObjectsContainersListForProjectAndLayout(project, layout);
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup").empty());
+    REQUIRE(!objectsContainersList.HasBehaviorInObjectOrGroup("MyGroup",
+                                                              "MyBehavior"));
+
+    object2.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup").size() == 1);
+    REQUIRE(objectsContainersList.HasBehaviorInObjectOrGroup("MyGroup",
+                                                             "MyBehavior"));
+
+    object1.RenameBehavior("MyBehavior", "MyRenamedBehavior");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup").empty());
+    REQUIRE(objectsContainersList.HasBehaviorInObjectOrGroup(
+        "MyObject1", "MyRenamedBehavior"));
+
+    object1.RemoveBehavior("MyRenamedBehavior");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyObject1").empty());
   }
 }
 
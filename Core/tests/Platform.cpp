@@ -0,0 +1,321 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the extensions of gd::Platform, including extensions
+ * declared on first use.
+ */
+#include "GDCore/Extensions/Platform.h"
+
+#include <memory>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/BehaviorsSharedData.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * \brief Create an extension with an object, a behavior and the given number
+ * of actions, conditions and expressions.
+ */
+std::shared_ptr<gd::PlatformExtension> CreateExtension(
+    const gd::String& name, std::size_t instructionsCount) {
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(name, name + " extension", "", "", "");
+  extension->AddInstructionOrExpressionGroupMetadata(name + " group")
+      .SetIcon("res/" + name + ".png");
+
+  auto& object = extension->AddObject<gd::ObjectConfiguration>(
+      "Object", "Object", "An object", "res/object.png");
+  object.AddExpression("ObjectValue", "Value", "", "", "")
+      .AddParameter("object", "Object", name + "::Object");
+  extension->AddBehavior("Behavior",
+                         "Behavior",
+                         "Behavior",
+                         "A behavior",
+                         "",
+                         "res/behavior.png",
+                         "Behavior",
+                         std::make_shared<gd::Behavior>(),
+                         std::make_shared<gd::BehaviorsSharedData>());
+
+  for (std::size_t i = 0; i < instructionsCount; ++i) {
+    gd::String suffix = gd::String::From(i);
+    extension
+        ->AddAction("Do" + suffix,
+                    "Do something " + suffix,
+                    "Do something with the object.",
+                    "Do something with _PARAM0_ and _PARAM1_",
+                    "Group",
+                    "res/action.png",
+                    "res/action24.png")
+        .AddParameter("object", "Object", name + "::Object")
+        .AddParameter("expression", "Value")
+        .SetFunctionName("doSomething" + suffix);
+    extension
+        ->AddCondition("Is" + suffix,
+                       "Is something " + suffix,
+                       "Check something on the object.",
+                       "_PARAM0_ is something",
+                       "Group",
+                       "res/condition.png",
+                       "res/condition24.png")
+        .AddParameter("object", "Object", name + "::Object")
+        .SetFunctionName("isSomething" + suffix);
+    extension
+        ->AddExpression("Value" + suffix,
+                        "Value " + suffix,
+                        "A value.",
+                        "Group",
+                        "res/expression.png")
+        .AddParameter("expression", "Value")
+        .SetFunctionName("getValue" + suffix);
+  }
+
+  return extension;
+}
+
+}  // namespace
+
+TEST_CASE("Platform", "[common]") {
+  SECTION("Lazy extensions are only declared when used") {
+    gd::Platform platform;
+    std::size_t declarationsCount = 0;
+    platform.AddExtension(CreateExtension("Eager", 3));
+    platform.AddLazyExtension("Lazy", [&declarationsCount]() {
+      declarationsCount++;
+      return CreateExtension("Lazy", 3);
+    });
+    platform.AddLazyExtension("OtherLazy", [&declarationsCount]() {
+      declarationsCount++;
+      return CreateExtension("OtherLazy", 3);
+    });
+    platform.AddExtension(CreateExtension("LastEager", 3));
+
+    REQUIRE(platform.IsExtensionLoaded("Lazy"));
+    REQUIRE(!platform.IsExtensionLoaded("Unknown"));
+    REQUIRE(declarationsCount == 0);
+
+    // Searching types of other extensions does not declare the extension.
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform, "Eager::Do1")));
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform, "LastEager::Do9")));
+    REQUIRE(declarationsCount == 0);
+
+    // Searching a type of the extension declares it (only once).
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(
+                platform, "Lazy::Do2")
+                .GetExtension()
+                .GetName() == "Lazy");
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetConditionMetadata(platform, "Lazy::Is0")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "Lazy::Object", "ObjectValue")));
+    REQUIRE(declarationsCount == 1);
+
+    // Objects can also be created.
+    REQUIRE(
+        platform.CreateObjectConfiguration("OtherLazy::Object")->GetType() ==
+        "OtherLazy::Object");
+    REQUIRE(declarationsCount == 2);
+
+    // All extensions are kept in the order they were added.
+    const auto& extensions = platform.GetAllPlatformExtensions();
+    REQUIRE(extensions.size() == 4);
+    REQUIRE(extensions[0]->GetName() == "Eager");
+    REQUIRE(extensions[1]->GetName() == "Lazy");
+    REQUIRE(extensions[2]->GetName() == "OtherLazy");
+    REQUIRE(extensions[3]->GetName() == "LastEager");
+    REQUIRE(extensions[1]->GetAllActions().size() == 3);
+    REQUIRE(declarationsCount == 2);
+  }
+
+  SECTION("Lazy extensions are declared when all extensions are needed") {
+    gd::Platform platform;
+    std::size_t declarationsCount = 0;
+    platform.AddLazyExtension("Lazy", [&declarationsCount]() {
+      declarationsCount++;
+      return CreateExtension("Lazy", 3);
+    });
+
+    REQUIRE(platform.GetInstructionOrExpressionGroupMetadata("Lazy group")
+                .GetIcon() == "res/Lazy.png");
+    REQUIRE(declarationsCount == 1);
+
+    platform.AddLazyExtension("OtherLazy", [&declarationsCount]() {
+      declarationsCount++;
+      return CreateExtension("OtherLazy", 3);
+    });
+    REQUIRE(platform.GetExtension("OtherLazy")->GetAllConditions().size() ==
+            3);
+    REQUIRE(declarationsCount == 2);
+
+    platform.AddLazyExtension("RemovedLazy", [&declarationsCount]() {
+      declarationsCount++;
+      return CreateExtension("RemovedLazy", 3);
+    });
+    platform.RemoveExtension("RemovedLazy");
+    REQUIRE(!platform.IsExtensionLoaded("RemovedLazy"));
+    platform.GetMetadataIndex();
+    REQUIRE(platform.GetAllPlatformExtensions().size() == 2);
+    REQUIRE(declarationsCount == 2);
+  }
+
+  SECTION("Lazy extensions are declared in the order they were added") {
+    gd::Platform platform;
+    std::vector<gd::String> declaredExtensions;
+    for (const gd::String& name : {"Zeta", "Alpha", "Mu"}) {
+      platform.AddLazyExtension(name, [&declaredExtensions, name]() {
+        declaredExtensions.push_back(name);
+        return CreateExtension(name, 1);
+      });
+    }
+
+    platform.GetAllPlatformExtensions();
+    REQUIRE(declaredExtensions ==
+            (std::vector<gd::String>{"Zeta", "Alpha", "Mu"}));
+  }
+
+  SECTION("Lazy extensions are declared when types outside of a namespace "
+          "are searched") {
+    gd::Platform platform;
+    std::vector<gd::String> declaredExtensions;
+    auto addLazyExtension = [&](const gd::String& name,
+                                std::size_t instructionsCount) {
+      platform.AddLazyExtension(
+          name, [&declaredExtensions, name, instructionsCount]() {
+            declaredExtensions.push_back(name);
+            return CreateExtension(name, instructionsCount);
+          });
+    };
+    // Like the builtin extensions, these extensions have no namespace.
+    platform.AddExtension(CreateExtension("Sprite", 1));
+    addLazyExtension("Lazy", 3);
+    addLazyExtension("BuiltinTime", 3);
+    platform.AddExtension(CreateExtension("BuiltinFile", 3));
+    addLazyExtension("LastLazy", 3);
+
+    // Types provided by an extension loaded before the lazy extensions don't
+    // declare them.
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(platform, "Do0")
+                .GetExtension()
+                .GetName() == "Sprite");
+    REQUIRE(declaredExtensions.empty());
+
+    // Types are provided by the first extension declaring them in the loading
+    // order, even if it's not declared yet.
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(platform, "Do2")
+                .GetExtension()
+                .GetName() == "BuiltinTime");
+    REQUIRE(declaredExtensions ==
+            (std::vector<gd::String>{"Lazy", "BuiltinTime"}));
+    REQUIRE(gd::MetadataProvider::GetExtensionAndExpressionMetadata(platform,
+                                                                    "Value1")
+                .GetExtension()
+                .GetName() == "BuiltinTime");
+    REQUIRE(gd::MetadataProvider::GetExtensionAndObjectExpressionMetadata(
+                platform, "Object", "ObjectValue")
+                .GetExtension()
+                .GetName() == "Sprite");
+    REQUIRE(declaredExtensions.size() == 2);
+
+    // Unknown types can be provided by any extension.
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform, "Unknown::Do1")));
+    REQUIRE(declaredExtensions ==
+            (std::vector<gd::String>{"Lazy", "BuiltinTime", "LastLazy"}));
+  }
+}
+
+TEST_CASE("Platform - Benchmarks", "[common]") {
+  SECTION("Platform startup") {
+    const std::size_t extensionsCount = 40;
+    const std::size_t instructionsCount = 50;
+
+    DoBenchmark("Setup of the dummy platform of the tests", 1, []() {
+      gd::Project project;
+      gd::Platform platform;
+      SetupProjectWithDummyPlatform(project, platform);
+    });
+
+    DoBenchmark("Declaration of the builtin extensions of GDCore", 1, []() {
+      gd::Platform platform;
+      std::vector<void (*)(gd::PlatformExtension&)> implementers = {
+          &gd::BuiltinExtensionsImplementer::ImplementsAdvancedExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsAudioExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsBaseObjectExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsCameraExtension,
+          &gd::BuiltinExtensionsImplementer::
+              ImplementsCommonConversionsExtension,
+          &gd::BuiltinExtensionsImplementer::
+              ImplementsCommonInstructionsExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsExternalLayoutsExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsFileExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsKeyboardExtension,
+          &gd::BuiltinExtensionsImplementer::
+              ImplementsMathematicalToolsExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsMouseExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsNetworkExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsSceneExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsSpriteExtension,
+          &gd::BuiltinExtensionsImplementer::
+              ImplementsStringInstructionsExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsTimeExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsVariablesExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsWindowExtension,
+          &gd::BuiltinExtensionsImplementer::ImplementsAsyncExtension};
+      for (auto implementer : implementers) {
+        auto extension = std::make_shared<gd::PlatformExtension>();
+        implementer(*extension);
+        platform.AddExtension(extension);
+      }
+    });
+
+    DoBenchmark(
+        gd::String::From(extensionsCount) +
+            " extensions declared at startup and a first lookup",
+        1,
+        [&]() {
+          gd::Platform platform;
+          for (std::size_t i = 0; i < extensionsCount; ++i) {
+            platform.AddExtension(CreateExtension(
+                "Extension" + gd::String::From(i), instructionsCount));
+          }
+          gd::MetadataProvider::GetActionMetadata(platform, "Extension7::Do3");
+        });
+
+    DoBenchmark(
+        gd::String::From(extensionsCount) +
+            " extensions declared on first use and a first lookup",
+        1,
+        [&]() {
+          gd::Platform platform;
+          for (std::size_t i = 0; i < extensionsCount; ++i) {
+            gd::String name = "Extension" + gd::String::From(i);
+            platform.AddLazyExtension(name, [name, instructionsCount]() {
+              return CreateExtension(name, instructionsCount);
+            });
+          }
+          REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+              gd::MetadataProvider::GetActionMetadata(platform,
+                                                      "Extension7::Do3")));
+        });
+  }
+}
@@ -0,0 +1,327 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the copy of the resources of a project, using the
+ * local disk.
+ */
+#include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+
+#if !defined(_WIN32)
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/fs.h>
+#endif
+
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesContainer.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * \brief A file system using the local disk, counting the copied and linked
+ * files.
+ */
+class LocalFileSystem : public gd::AbstractFileSystem {
+ public:
+  virtual void MkDir(const gd::String& path) {
+    if (path.empty() || DirExists(path)) return;
+    MkDir(DirNameFrom(path));
+    mkdir(path.c_str(), 0755);
+  }
+  virtual bool DirExists(const gd::String& path) {
+    struct stat status;
+    return stat(path.c_str(), &status) == 0 && S_ISDIR(status.st_mode);
+  }
+  virtual bool FileExists(const gd::String& path) {
+    struct stat status;
+    return stat(path.c_str(), &status) == 0 && S_ISREG(status.st_mode);
+  }
+  virtual bool ClearDir(const gd::String& directory) {
+    for (const gd::String& file : ReadDir(directory)) {
+      if (unlink(file.c_str()) != 0) return false;
+    }
+    return true;
+  }
+  virtual gd::String GetTempDir() { return "/tmp"; }
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    std::size_t slash = file.rfind("/");
+    return slash == gd::String::npos ? file : file.substr(slash + 1);
+  }
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    std::size_t slash = file.rfind("/");
+    return slash == gd::String::npos ? "" : file.substr(0, slash);
+  }
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (IsAbsolute(filename)) return true;
+    filename = baseDirectory + "/" + filename;
+    return true;
+  }
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (filename.find(baseDirectory + "/") != 0) return false;
+    filename = filename.substr(baseDirectory.size() + 1);
+    return true;
+  }
+  virtual bool CopyFile(const gd::String& file, const gd::String& destination) {
+    copiedFilesCount++;
+    std::ifstream input(file.c_str(), std::ios::binary);
+    std::ofstream output(destination.c_str(),
+                         std::ios::binary | std::ios::trunc);
+    if (!input || !output) return false;
+    output << input.rdbuf();
+    return static_cast<bool>(output);
+  }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    std::ofstream output(file.c_str(), std::ios::binary | std::ios::trunc);
+    output << content.Raw();
+    return static_cast<bool>(output);
+  }
+  virtual gd::String ReadFile(const gd::String& file) {
+    std::ifstream input(file.c_str(), std::ios::binary);
+    std::ostringstream content;
+    content << input.rdbuf();
+    return gd::String::FromUTF8(content.str());
+  }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    std::vector<gd::String> files;
+    DIR* dir = opendir(path.c_str());
+    if (!dir) return files;
+    while (struct dirent* entry = readdir(dir)) {
+      gd::String file = path + "/" + entry->d_name;
+      if (FileExists(file) &&
+          (extension.empty() ||
+           file.rfind(extension) == file.size() - extension.size()))
+        files.push_back(file);
+    }
+    closedir(dir);
+    return files;
+  }
+  virtual bool GetFileStatus(const gd::String& file,
+                             std::uint64_t& size,
+                             std::int64_t& modificationTime) {
+    struct stat status;
+    if (stat(file.c_str(), &status) != 0) return false;
+
+    size = status.st_size;
+#if defined(__linux__)
+    modificationTime =
+        status.st_mtim.tv_sec * 1000000000LL + status.st_mtim.tv_nsec;
+#else
+    modificationTime = status.st_mtime * 1000000000LL;
+#endif
+    return true;
+  }
+  virtual bool LinkFile(const gd::String& file,
+                        const gd::String& destination) {
+    unlink(destination.c_str());
+#if defined(__linux__) && defined(FICLONE)
+    // Try a copy-on-write clone first (Btrfs, XFS...), then a hard link.
+    int input = open(file.c_str(), O_RDONLY);
+    if (input >= 0) {
+      int output = open(destination.c_str(), O_WRONLY | O_CREAT, 0644);
+      bool cloned = output >= 0 && ioctl(output, FICLONE, input) == 0;
+      if (output >= 0) close(output);
+      close(input);
+      if (cloned) {
+        linkedFilesCount++;
+        return true;
+      }
+      unlink(destination.c_str());
+    }
+#endif
+    if (link(file.c_str(), destination.c_str()) != 0) return false;
+
+    linkedFilesCount++;
+    return true;
+  }
+  virtual bool RemoveFile(const gd::String& file) {
+    return unlink(file.c_str()) == 0;
+  }
+  virtual bool IsThreadSafe() const { return true; }
+
+  std::atomic<std::size_t> copiedFilesCount{0};
+  std::atomic<std::size_t> linkedFilesCount{0};
+};
+
+gd::String MakeTemporaryDirectory() {
+  char directory[] = "/tmp/gdcore-tests-XXXXXX";
+  REQUIRE(mkdtemp(directory) != nullptr);
+  return directory;
+}
+
+void RemoveDirectory(const gd::String& path) {
+  DIR* dir = opendir(path.c_str());
+  if (!dir) return;
+  while (struct dirent* entry = readdir(dir)) {
+    gd::String name = entry->d_name;
+    if (name == "." || name == "..") continue;
+    gd::String file = path + "/" + name;
+    if (unlink(file.c_str()) != 0) RemoveDirectory(file);
+  }
+  closedir(dir);
+  rmdir(path.c_str());
+}
+
+void SetupProjectWithResources(gd::Project& project,
+                               LocalFileSystem& fs,
+                               const gd::String& projectDirectory,
+                               std::size_t resourcesCount) {
+  project.SetProjectFile(projectDirectory + "/game.json");
+  for (std::size_t i = 0; i < resourcesCount; ++i) {
+    gd::String file = "images/sub" + gd::String::From(i % 3) + "/image" +
+                      gd::String::From(i) + ".png";
+    gd::String absoluteFile = projectDirectory + "/" + file;
+    fs.MkDir(fs.DirNameFrom(absoluteFile));
+    fs.WriteToFile(absoluteFile, "Content of image " + gd::String::From(i));
+    project.GetResourcesManager().AddResource(
+        "Image" + gd::String::From(i), file, "image");
+  }
+}
+
+}  // namespace
+
+TEST_CASE("ProjectResourcesCopier", "[common]") {
+  SECTION("Copy all the resources to a directory") {
+    LocalFileSystem fs;
+    gd::Project project;
+    gd::String projectDirectory = MakeTemporaryDirectory();
+    gd::String destinationDirectory = MakeTemporaryDirectory();
+    SetupProjectWithResources(project, fs, projectDirectory, 20);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false);
+    REQUIRE(fs.copiedFilesCount == 20);
+    REQUIRE(fs.ReadFile(destinationDirectory + "/images/sub2/image5.png") ==
+            "Content of image 5");
+    REQUIRE(!fs.FileExists(destinationDirectory + "/" +
+                           gd::ProjectResourcesCopier::GetManifestFilename()));
+
+    // Without skipping unchanged files, everything is copied again.
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false);
+    REQUIRE(fs.copiedFilesCount == 40);
+
+    RemoveDirectory(projectDirectory);
+    RemoveDirectory(destinationDirectory);
+  }
+
+  SECTION("Skip unchanged files") {
+    LocalFileSystem fs;
+    gd::Project project;
+    gd::String projectDirectory = MakeTemporaryDirectory();
+    gd::String destinationDirectory = MakeTemporaryDirectory();
+    SetupProjectWithResources(project, fs, projectDirectory, 20);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false, true, true, true);
+    REQUIRE(fs.copiedFilesCount == 20);
+    REQUIRE(fs.FileExists(destinationDirectory + "/" +
+                          gd::ProjectResourcesCopier::GetManifestFilename()));
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false, true, true, true);
+    REQUIRE(fs.copiedFilesCount == 20);
+
+    // A changed original file is copied again.
+    fs.WriteToFile(projectDirectory + "/images/sub1/image4.png",
+                   "New content of image 4");
+    // A removed or changed destination file is copied again.
+    unlink((destinationDirectory + "/images/sub0/image0.png").c_str());
+    fs.WriteToFile(destinationDirectory + "/images/sub1/image1.png",
+                   "Modified copy of image 1");
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false, true, true, true);
+    REQUIRE(fs.copiedFilesCount == 23);
+    REQUIRE(fs.ReadFile(destinationDirectory + "/images/sub1/image4.png") ==
+            "New content of image 4");
+    REQUIRE(fs.ReadFile(destinationDirectory + "/images/sub0/image0.png") ==
+            "Content of image 0");
+    REQUIRE(fs.ReadFile(destinationDirectory + "/images/sub1/image1.png") ==
+            "Content of image 1");
+
+    // A new resource is copied.
+    fs.WriteToFile(projectDirectory + "/images/new.png", "New image");
+    project.GetResourcesManager().AddResource(
+        "NewImage", "images/new.png", "image");
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false, true, true, true);
+    REQUIRE(fs.copiedFilesCount == 24);
+    REQUIRE(fs.ReadFile(destinationDirectory + "/images/new.png") ==
+            "New image");
+
+    RemoveDirectory(projectDirectory);
+    RemoveDirectory(destinationDirectory);
+  }
+
+  SECTION("Link files") {
+    LocalFileSystem fs;
+    gd::Project project;
+    gd::String projectDirectory = MakeTemporaryDirectory();
+    gd::String destinationDirectory = MakeTemporaryDirectory();
+    SetupProjectWithResources(project, fs, projectDirectory, 10);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false, true, true, true, true);
+    // Linking can fail on some file systems, in which case files are copied.
+    REQUIRE((fs.linkedFilesCount + fs.copiedFilesCount) == 10);
+    REQUIRE(fs.ReadFile(destinationDirectory + "/images/sub0/image3.png") ==
+            "Content of image 3");
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false, true, true, true, true);
+    REQUIRE((fs.linkedFilesCount + fs.copiedFilesCount) == 10);
+
+    RemoveDirectory(projectDirectory);
+    RemoveDirectory(destinationDirectory);
+  }
+
+  SECTION("Copy files that were linked without changing the originals") {
+    LocalFileSystem fs;
+    gd::Project project;
+    gd::String projectDirectory = MakeTemporaryDirectory();
+    gd::String destinationDirectory = MakeTemporaryDirectory();
+    SetupProjectWithResources(project, fs, projectDirectory, 10);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false, true, true, false, true);
+    REQUIRE((fs.linkedFilesCount + fs.copiedFilesCount) == 10);
+
+    // Copying the files again must not write through the links.
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, destinationDirectory, false);
+    REQUIRE(fs.ReadFile(projectDirectory + "/images/sub0/image3.png") ==
+            "Content of image 3");
+    REQUIRE(fs.ReadFile(destinationDirectory + "/images/sub0/image3.png") ==
+            "Content of image 3");
+
+    // Modifying a copy does not modify its original.
+    fs.WriteToFile(destinationDirectory + "/images/sub1/image1.png",
+                   "Modified copy of image 1");
+    REQUIRE(fs.ReadFile(projectDirectory + "/images/sub1/image1.png") ==
+            "Content of image 1");
+
+    RemoveDirectory(projectDirectory);
+    RemoveDirectory(destinationDirectory);
+  }
+}
+#endif
@@ -0,0 +1,370 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the snapshots of a project.
+ */
+#include "GDCore/IDE/ProjectSnapshot.h"
+
+#include <memory>
+
+#include "BenchmarkUtils.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::Layout &SetupLayout(gd::Project &project,
+                        const gd::String &name,
+                        std::size_t instancesCount) {
+  auto &layout = project.InsertNewLayout(name, project.GetLayoutsCount());
+  layout.ResetPersistentUuid();
+  layout.GetVariables().InsertNew("MyVariable", 0).SetValue(1);
+  layout.GetVariables()
+      .InsertNew("MyStructure", 1)
+      .GetChild("MyChild")
+      .SetValue(2);
+  layout.GetVariables().ResetPersistentUuid();
+
+  layout.GetObjects()
+      .InsertNewObject(project, "MyExtension::Sprite", "MySprite", 0)
+      .ResetPersistentUuid();
+  for (std::size_t i = 0; i < instancesCount; ++i) {
+    auto &instance = layout.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName("MySprite");
+    instance.SetX(i);
+  }
+  for (std::size_t i = 0; i < 3; ++i) {
+    layout.GetEvents().InsertNewEvent(
+        project, "BuiltinCommonInstructions::Standard");
+  }
+
+  return layout;
+}
+
+gd::String GetLayoutJson(const gd::Layout &layout) {
+  gd::SerializerElement element;
+  layout.SerializeTo(element);
+  return gd::Serializer::ToJSON(element);
+}
+
+}  // namespace
+
+TEST_CASE("ProjectSnapshot", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = SetupLayout(project, "Layout1", 20);
+  SetupLayout(project, "Layout2", 20);
+  project.InsertNewExternalEvents("ExternalEvents1", 0);
+  project.GetVariables().InsertNew("MyGlobalVariable", 0).SetValue(3);
+  project.GetVariables().ResetPersistentUuid();
+
+  gd::ProjectSnapshot snapshot(project);
+
+  SECTION("Unchanged project") {
+    gd::ProjectSnapshot newSnapshot(project, &snapshot);
+    REQUIRE(newSnapshot.GetNodesCount() == snapshot.GetNodesCount());
+    REQUIRE(newSnapshot.GetSharedNodesCount(snapshot) ==
+            snapshot.GetNodesCount());
+    REQUIRE(newSnapshot.GetLayout("Layout1") == snapshot.GetLayout("Layout1"));
+
+    auto changeset =
+        gd::ProjectSnapshot::ComputeChangeset(snapshot, newSnapshot);
+    REQUIRE(!changeset.globalObjectsAndVariables.HasChanges());
+    REQUIRE(changeset.layouts.addedNames.empty());
+    REQUIRE(changeset.layouts.removedNames.empty());
+    REQUIRE(changeset.layouts.modifiedElements.empty());
+    REQUIRE(changeset.externalEvents.modifiedElements.empty());
+  }
+
+  SECTION("Snapshots without a previous one are compared by content") {
+    gd::ProjectSnapshot newSnapshot(project);
+    REQUIRE(newSnapshot.GetSharedNodesCount(snapshot) == 0);
+
+    auto changeset =
+        gd::ProjectSnapshot::ComputeChangeset(snapshot, newSnapshot);
+    REQUIRE(!changeset.globalObjectsAndVariables.HasChanges());
+    REQUIRE(changeset.layouts.modifiedElements.empty());
+  }
+
+  SECTION("Modified, added and removed instances") {
+    gd::InitialInstance *fifthInstance = nullptr;
+    gd::InitialInstance *sixthInstance = nullptr;
+    std::size_t position = 0;
+    layout.GetInitialInstances().IterateOverInstances(
+        [&](gd::InitialInstance &instance) {
+          if (position == 4) fifthInstance = &instance;
+          if (position == 5) sixthInstance = &instance;
+          position++;
+          return false;
+        });
+    fifthInstance->SetX(1000);
+
+    gd::ProjectSnapshot modifiedSnapshot(project, &snapshot);
+    // Only the instance node is new.
+    REQUIRE(modifiedSnapshot.GetSharedNodesCount(snapshot) ==
+            snapshot.GetNodesCount() - 1);
+    REQUIRE(modifiedSnapshot.GetLayout("Layout2") ==
+            snapshot.GetLayout("Layout2"));
+
+    auto changeset =
+        gd::ProjectSnapshot::ComputeChangeset(snapshot, modifiedSnapshot);
+    REQUIRE(changeset.layouts.modifiedElements.size() == 1);
+    const auto &layoutChangeset = changeset.layouts.modifiedElements[0];
+    REQUIRE(layoutChangeset.newName == "Layout1");
+    REQUIRE(!layoutChangeset.propertiesChanged);
+    REQUIRE(layoutChangeset.arraysChangesets.size() == 1);
+    const auto &instancesChangeset =
+        layoutChangeset.arraysChangesets.find("instances")->second;
+    REQUIRE(instancesChangeset.modifiedPositions ==
+            std::vector<std::size_t>{4});
+    REQUIRE(instancesChangeset.addedPositions.empty());
+    REQUIRE(instancesChangeset.removedPositions.empty());
+    REQUIRE(modifiedSnapshot.GetLayout("Layout1")
+                ->GetArray("instances")
+                ->at(4)
+                ->GetKey() == fifthInstance->GetPersistentUuid());
+
+    layout.GetInitialInstances().RemoveInstance(*sixthInstance);
+    layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+        "MySprite");
+    gd::ProjectSnapshot otherSnapshot(project, &modifiedSnapshot);
+    REQUIRE(otherSnapshot.GetSharedNodesCount(modifiedSnapshot) ==
+            modifiedSnapshot.GetNodesCount() - 1);
+
+    changeset =
+        gd::ProjectSnapshot::ComputeChangeset(modifiedSnapshot, otherSnapshot);
+    REQUIRE(changeset.layouts.modifiedElements.size() == 1);
+    const auto &otherInstancesChangeset =
+        changeset.layouts.modifiedElements[0]
+            .arraysChangesets.find("instances")
+            ->second;
+    REQUIRE(otherInstancesChangeset.modifiedPositions.empty());
+    REQUIRE(otherInstancesChangeset.addedPositions ==
+            std::vector<std::size_t>{19});
+    REQUIRE(otherInstancesChangeset.removedPositions ==
+            std::vector<std::size_t>{5});
+  }
+
+  SECTION("Modified and moved events") {
+    layout.GetEvents().GetEvent(1).SetDisabled(true);
+
+    gd::ProjectSnapshot modifiedSnapshot(project, &snapshot);
+    auto changeset =
+        gd::ProjectSnapshot::ComputeChangeset(snapshot, modifiedSnapshot);
+    REQUIRE(changeset.layouts.modifiedElements.size() == 1);
+    const auto &eventsChangeset = changeset.layouts.modifiedElements[0]
+                                      .arraysChangesets.find("events")
+                                      ->second;
+    // Events are only recognized by their content.
+    REQUIRE(eventsChangeset.addedPositions == std::vector<std::size_t>{1});
+    REQUIRE(eventsChangeset.removedPositions.size() == 1);
+    REQUIRE(eventsChangeset.modifiedPositions.empty());
+
+    // Moving an event is not a change.
+    layout.GetEvents().MoveEventToAnotherEventsList(
+        layout.GetEvents().GetEvent(1), layout.GetEvents(), 0);
+    gd::ProjectSnapshot movedSnapshot(project, &modifiedSnapshot);
+    REQUIRE(movedSnapshot.GetSharedNodesCount(modifiedSnapshot) ==
+            modifiedSnapshot.GetNodesCount());
+    changeset =
+        gd::ProjectSnapshot::ComputeChangeset(modifiedSnapshot, movedSnapshot);
+    REQUIRE(changeset.layouts.modifiedElements.empty());
+  }
+
+  SECTION("Renamed, added and removed layouts") {
+    layout.SetName("RenamedLayout");
+    project.RemoveLayout("Layout2");
+    SetupLayout(project, "Layout3", 1);
+
+    gd::ProjectSnapshot modifiedSnapshot(project, &snapshot);
+    REQUIRE(modifiedSnapshot.GetLayout("Layout1") == nullptr);
+    REQUIRE(modifiedSnapshot.GetLayout("RenamedLayout") != nullptr);
+
+    auto changeset =
+        gd::ProjectSnapshot::ComputeChangeset(snapshot, modifiedSnapshot);
+    REQUIRE(changeset.layouts.addedNames == std::vector<gd::String>{"Layout3"});
+    REQUIRE(changeset.layouts.removedNames ==
+            std::vector<gd::String>{"Layout2"});
+    REQUIRE(changeset.layouts.modifiedElements.size() == 1);
+    const auto &layoutChangeset = changeset.layouts.modifiedElements[0];
+    REQUIRE(layoutChangeset.oldName == "Layout1");
+    REQUIRE(layoutChangeset.newName == "RenamedLayout");
+    REQUIRE(layoutChangeset.arraysChangesets.empty());
+  }
+
+  SECTION("Duplicated layouts") {
+    REQUIRE(!project.InsertNewLayout("Layout3", 2).GetPersistentUuid().empty());
+
+    gd::Layout &duplicatedLayout = project.InsertLayout(layout, 3);
+    REQUIRE(duplicatedLayout.GetPersistentUuid() != layout.GetPersistentUuid());
+    duplicatedLayout.SetName("DuplicatedLayout");
+
+    // A layout that is not in the project keeps its UUID.
+    gd::Layout otherLayout(layout);
+    project.RemoveLayout("Layout1");
+    REQUIRE(project.InsertLayout(otherLayout, 0).GetPersistentUuid() ==
+            otherLayout.GetPersistentUuid());
+
+    gd::ProjectSnapshot modifiedSnapshot(project, &snapshot);
+    auto changeset =
+        gd::ProjectSnapshot::ComputeChangeset(snapshot, modifiedSnapshot);
+    REQUIRE(changeset.layouts.addedNames ==
+            (std::vector<gd::String>{"Layout3", "DuplicatedLayout"}));
+    REQUIRE(changeset.layouts.removedNames.empty());
+  }
+
+  SECTION("Layouts are restored as they were") {
+    gd::String originalJson = GetLayoutJson(layout);
+    gd::ProjectSnapshot originalSnapshot(project, &snapshot);
+    REQUIRE(gd::Serializer::ToJSON(originalSnapshot.GetLayout("Layout1")
+                                       ->ToSerializerElement()) ==
+            originalJson);
+
+    layout.GetVariables().Remove("MyVariable");
+    layout.GetObjects().RemoveObject("MySprite");
+    layout.GetEvents().RemoveEvent(0);
+    layout.GetInitialInstances().InsertNewInitialInstance();
+    gd::ProjectSnapshot modifiedSnapshot(project, &originalSnapshot);
+    REQUIRE(GetLayoutJson(layout) != originalJson);
+
+    layout.UnserializeFrom(
+        project,
+        originalSnapshot.GetLayout("Layout1")->ToSerializerElement());
+    REQUIRE(GetLayoutJson(layout) == originalJson);
+  }
+
+  SECTION("Variables changesets") {
+    gd::SerializerElement originalSerializedVariables;
+    layout.GetVariables().SerializeTo(originalSerializedVariables);
+
+    layout.GetVariables().Rename("MyVariable", "MyRenamedVariable");
+    layout.GetVariables().Get("MyStructure").RenameChild("MyChild",
+                                                         "MyRenamedChild");
+    layout.GetVariables().InsertNew("MyNewVariable", 2);
+    gd::ProjectSnapshot modifiedSnapshot(project, &snapshot);
+
+    auto changeset = gd::ProjectSnapshot::ComputeVariablesChangeset(
+        *snapshot.GetLayout("Layout1"),
+        *modifiedSnapshot.GetLayout("Layout1"));
+    auto expectedChangeset =
+        gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
+            originalSerializedVariables, layout.GetVariables());
+    REQUIRE(changeset.oldToNewVariableNames ==
+            expectedChangeset.oldToNewVariableNames);
+    REQUIRE(changeset.oldToNewVariableNames.size() == 1);
+    REQUIRE(changeset.addedVariableNames ==
+            expectedChangeset.addedVariableNames);
+    REQUIRE(changeset.addedVariableNames.size() == 1);
+    REQUIRE(changeset.typeChangedVariableNames ==
+            expectedChangeset.typeChangedVariableNames);
+    REQUIRE(changeset.valueChangedVariableNames ==
+            expectedChangeset.valueChangedVariableNames);
+    REQUIRE(changeset.removedVariableNames.empty());
+    REQUIRE(changeset.modifiedVariables.size() == 1);
+    REQUIRE(changeset.modifiedVariables.find("MyStructure")
+                ->second->oldToNewVariableNames.find("MyChild")
+                ->second == "MyRenamedChild");
+
+    layout.GetVariables().Remove("MyNewVariable");
+    layout.GetVariables().Get("MyRenamedVariable").SetString("Text");
+    gd::ProjectSnapshot otherSnapshot(project, &modifiedSnapshot);
+
+    changeset = gd::ProjectSnapshot::ComputeVariablesChangeset(
+        *modifiedSnapshot.GetLayout("Layout1"),
+        *otherSnapshot.GetLayout("Layout1"));
+    REQUIRE(changeset.removedVariableNames ==
+            std::unordered_set<gd::String>{"MyNewVariable"});
+    REQUIRE(changeset.typeChangedVariableNames ==
+            std::unordered_set<gd::String>{"MyRenamedVariable"});
+    REQUIRE(changeset.valueChangedVariableNames ==
+            std::unordered_set<gd::String>{"MyRenamedVariable"});
+    REQUIRE(changeset.oldToNewVariableNames.empty());
+
+    // Global variables are in the snapshot too.
+    project.GetVariables().Rename("MyGlobalVariable", "MyRenamedGlobal");
+    gd::ProjectSnapshot globalSnapshot(project, &otherSnapshot);
+    changeset = gd::ProjectSnapshot::ComputeVariablesChangeset(
+        otherSnapshot.GetGlobalObjectsAndVariables(),
+        globalSnapshot.GetGlobalObjectsAndVariables());
+    REQUIRE(changeset.oldToNewVariableNames.find("MyGlobalVariable")->second ==
+            "MyRenamedGlobal");
+  }
+
+  SECTION("Variables changesets of different containers or without UUIDs") {
+    gd::SerializerElement originalSerializedVariables;
+    layout.GetVariables().SerializeTo(originalSerializedVariables);
+
+    // Variables without UUIDs are recognized like in
+    // ComputeChangesetForVariablesContainer.
+    layout.GetVariables().InsertNew("MyNewVariable", 2);
+    layout.GetVariables().Get("MyNewVariable").ClearPersistentUuid();
+    layout.GetVariables().Get("MyVariable").ClearPersistentUuid();
+    layout.GetVariables().Rename("MyVariable", "MyRenamedVariable");
+    gd::ProjectSnapshot modifiedSnapshot(project, &snapshot);
+
+    auto changeset = gd::ProjectSnapshot::ComputeVariablesChangeset(
+        *snapshot.GetLayout("Layout1"),
+        *modifiedSnapshot.GetLayout("Layout1"));
+    auto expectedChangeset =
+        gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
+            originalSerializedVariables, layout.GetVariables());
+    REQUIRE(changeset.addedVariableNames ==
+            expectedChangeset.addedVariableNames);
+    REQUIRE(changeset.removedVariableNames ==
+            expectedChangeset.removedVariableNames);
+    REQUIRE(changeset.oldToNewVariableNames ==
+            expectedChangeset.oldToNewVariableNames);
+    REQUIRE(changeset.removedVariableNames ==
+            std::unordered_set<gd::String>{"MyVariable"});
+
+    // Containers with different UUIDs can't be compared.
+    layout.GetVariables().ResetPersistentUuid();
+    gd::ProjectSnapshot otherSnapshot(project, &modifiedSnapshot);
+    changeset = gd::ProjectSnapshot::ComputeVariablesChangeset(
+        *modifiedSnapshot.GetLayout("Layout1"),
+        *otherSnapshot.GetLayout("Layout1"));
+    REQUIRE(changeset.addedVariableNames.empty());
+    REQUIRE(changeset.removedVariableNames.empty());
+    REQUIRE(changeset.valueChangedVariableNames.empty());
+  }
+}
+
+TEST_CASE("ProjectSnapshot - Benchmarks", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = SetupLayout(project, "BigLayout", 20000);
+
+  gd::String json;
+  DoBenchmark("Layout with 20000 instances serialized to JSON", 1, [&]() {
+    json = GetLayoutJson(layout);
+  });
+  REQUIRE(!json.empty());
+
+  gd::ProjectSnapshot firstSnapshot(project);
+  layout.GetVariables().Get("MyVariable").SetValue(42);
+  std::unique_ptr<gd::ProjectSnapshot> secondSnapshot;
+  DoBenchmark(
+      "Snapshot of a layout with 20000 instances after a change", 1, [&]() {
+        secondSnapshot =
+            gd::make_unique<gd::ProjectSnapshot>(project, &firstSnapshot);
+      });
+  REQUIRE(secondSnapshot->GetSharedNodesCount(firstSnapshot) ==
+          firstSnapshot.GetNodesCount() - 1);
+}
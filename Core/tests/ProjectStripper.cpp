@@ -0,0 +1,174 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the stripping of projects for export.
+ */
+#include "GDCore/IDE/ProjectStripper.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+void AddObjectWithDefaultBehavior(const gd::Project &project,
+                                  gd::ObjectsContainer &objectsContainer,
+                                  const gd::String &name) {
+  auto &object = objectsContainer.InsertNewObject(
+      project, "MyExtension::Sprite", name, 0);
+  object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior")
+      ->SetDefaultBehavior(true);
+  object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyOtherBehavior");
+}
+
+void AddEvents(gd::EventsList &events) {
+  gd::StandardEvent event;
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomething");
+  instruction.SetParametersCount(1);
+  instruction.SetParameter(0, "1 + 2");
+  event.GetActions().Insert(instruction);
+  events.InsertEvent(event);
+}
+
+void FillProject(gd::Project &project) {
+  project.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                       "MyGlobalObject", 0);
+  AddObjectWithDefaultBehavior(project, project.GetObjects(),
+                               "MyGlobalObjectWithDefaultBehavior");
+  project.GetObjects().GetObjectGroups().InsertNew("MyGlobalGroup");
+
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  layout.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                      "MyObject", 0);
+  AddObjectWithDefaultBehavior(project, layout.GetObjects(),
+                               "MyObjectWithDefaultBehavior");
+  layout.GetObjects().GetObjectGroups().InsertNew("MyGroup");
+  AddEvents(layout.GetEvents());
+
+  auto &externalEvents = project.InsertNewExternalEvents("MyExternalEvents", 0);
+  externalEvents.SetAssociatedLayout("Scene");
+  AddEvents(externalEvents.GetEvents());
+
+  // An extension with only functions is removed.
+  auto &functionsExtension =
+      project.InsertNewEventsFunctionsExtension("MyFunctionsExtension", 0);
+  functionsExtension.SetFullName("My functions extension");
+  functionsExtension.GetEventsFunctions().InsertNewEventsFunction("MyFunction",
+                                                                  0);
+
+  // An extension with objects is kept.
+  auto &objectsExtension =
+      project.InsertNewEventsFunctionsExtension("MyObjectsExtension", 1);
+  objectsExtension.SetFullName("My objects extension");
+  objectsExtension.SetShortDescription("A short description.");
+  objectsExtension.SetDescription("A description\non several lines.");
+  objectsExtension.SetHelpPath("/my-objects-extension");
+  objectsExtension.SetIconUrl("icon.png");
+  objectsExtension.SetPreviewIconUrl("preview-icon.png");
+  objectsExtension.SetOrigin("MyOrigin", "MyIdentifier");
+  objectsExtension.SetVersion("1.2.3");
+  objectsExtension.GetEventsFunctions().InsertNewEventsFunction("MyFunction",
+                                                                0);
+  objectsExtension.GetEventsBasedBehaviors().InsertNew("MyEventsBasedBehavior",
+                                                       0);
+  auto &eventsBasedObject =
+      objectsExtension.GetEventsBasedObjects().InsertNew("MyEventsBasedObject",
+                                                         0);
+  eventsBasedObject.SetFullName("My events based object");
+  eventsBasedObject.SetDescription("A description.");
+  eventsBasedObject.GetEventsFunctions().InsertNewEventsFunction(
+      "MyObjectFunction", 0);
+  eventsBasedObject.GetPropertyDescriptors().InsertNew("MyProperty", 0);
+  AddObjectWithDefaultBehavior(project, eventsBasedObject.GetObjects(),
+                               "MyChildObject");
+  auto &variant =
+      eventsBasedObject.GetVariants().InsertNewVariant("MyVariant", 0);
+  AddObjectWithDefaultBehavior(project, variant.GetObjects(),
+                               "MyVariantChildObject");
+
+  // An extension with variables is kept.
+  auto &variablesExtension =
+      project.InsertNewEventsFunctionsExtension("MyVariablesExtension", 2);
+  variablesExtension.GetGlobalVariables().InsertNew("MyVariable", 0);
+}
+
+// Copies of objects containers don't keep their folders: copy them as they
+// would be kept by the serialization.
+void CopyObjectsFolders(gd::Project &project,
+                        const gd::ObjectsContainer &objectsContainer,
+                        gd::ObjectsContainer &copiedObjectsContainer) {
+  gd::SerializerElement foldersElement;
+  objectsContainer.SerializeFoldersTo(foldersElement);
+  copiedObjectsContainer.UnserializeFoldersFrom(project, foldersElement);
+}
+
+void CopyProjectObjectsFolders(gd::Project &project,
+                               gd::Project &copiedProject) {
+  CopyObjectsFolders(copiedProject, project.GetObjects(),
+                     copiedProject.GetObjects());
+  CopyObjectsFolders(copiedProject, project.GetLayout("Scene").GetObjects(),
+                     copiedProject.GetLayout("Scene").GetObjects());
+
+  auto &eventsBasedObject =
+      project.GetEventsFunctionsExtension("MyObjectsExtension")
+          .GetEventsBasedObjects()
+          .Get("MyEventsBasedObject");
+  auto &copiedEventsBasedObject =
+      copiedProject.GetEventsFunctionsExtension("MyObjectsExtension")
+          .GetEventsBasedObjects()
+          .Get("MyEventsBasedObject");
+  CopyObjectsFolders(copiedProject, eventsBasedObject.GetObjects(),
+                     copiedEventsBasedObject.GetObjects());
+  CopyObjectsFolders(
+      copiedProject,
+      eventsBasedObject.GetVariants().GetVariant("MyVariant").GetObjects(),
+      copiedEventsBasedObject.GetVariants().GetVariant("MyVariant").GetObjects());
+}
+
+}  // namespace
+
+TEST_CASE("ProjectStripper", "[common]") {
+  SECTION("Serialize a project like a stripped project") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    FillProject(project);
+
+    gd::SerializerElement originalElement;
+    project.SerializeTo(originalElement);
+
+    gd::Project strippedProject = project;
+    CopyProjectObjectsFolders(project, strippedProject);
+    gd::ProjectStripper::StripProjectForExport(strippedProject);
+    gd::SerializerElement expectedElement;
+    strippedProject.SerializeTo(expectedElement);
+    REQUIRE(expectedElement.GetChild("eventsFunctionsExtensions")
+                .GetChildrenCount() == 2);
+
+    gd::SerializerElement element;
+    gd::ProjectStripper::SerializeProjectForExport(project, element);
+    REQUIRE(gd::Serializer::ToJSON(element) ==
+            gd::Serializer::ToJSON(expectedElement));
+
+    // The project itself is not modified.
+    gd::SerializerElement unchangedElement;
+    project.SerializeTo(unchangedElement);
+    REQUIRE(gd::Serializer::ToJSON(unchangedElement) ==
+            gd::Serializer::ToJSON(originalElement));
+  }
+}
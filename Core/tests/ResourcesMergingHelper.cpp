@@ -8,16 +8,18 @@
  */
 #include "GDCore/IDE/Project/ResourcesMergingHelper.h"
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
 #include "GDCore/Tools/SystemStats.h"
 #include "GDCore/Tools/VersionWrapper.h"
+#include "DummyPlatform.h"
 #include "catch.hpp"
 #include "GDCore/IDE/ResourceExposer.h"
-
 class MockFileSystem : public gd::AbstractFileSystem {
  public:
   virtual void MkDir(const gd::String& path){};
@@ -115,4 +117,50 @@ TEST_CASE("ResourcesMergingHelper", "[common]") {
     REQUIRE(resourcesFilenames["MakeAbsolute(subfolder/image3.png)"] ==
             "MakeRelative(MakeAbsolute(subfolder/image3.png))");
   }
+  SECTION("Can keep the files referred directly by events unchanged") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    project.GetResourcesManager().AddResource("Image1", "image1.png", "image");
+    project.GetResourcesManager().AddResource("Audio1", "audio1.wav", "audio");
+
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    gd::StandardEvent standardEvent;
+    gd::Instruction instruction;
+    instruction.SetType("MyExtension::DoSomethingWithResources");
+    instruction.SetParametersCount(3);
+    instruction.SetParameter(0, "");
+    instruction.SetParameter(1, "Image1");
+    instruction.SetParameter(2, "sounds/audio2.wav");
+    standardEvent.GetActions().Insert(instruction);
+    layout.GetEvents().InsertEvent(standardEvent);
+
+    // Only the resources given to the helper are updated.
+    gd::ResourcesContainer resourcesContainer = project.GetResourcesManager();
+    MockFileSystem fs;
+    gd::ResourcesMergingHelper resourcesMerger(resourcesContainer, fs);
+    resourcesMerger.SetBaseDirectory("/game/base/folder/");
+    resourcesMerger.KeepDirectFileReferences();
+
+    gd::ResourceExposer::ExposeWholeProjectResources(project, resourcesMerger);
+
+    REQUIRE(resourcesContainer.GetResource("Audio1").GetFile() ==
+            "FileNameFrom(MakeAbsolute(audio1.wav))");
+    REQUIRE(project.GetResourcesManager().GetResource("Audio1").GetFile() ==
+            "audio1.wav");
+
+    auto &exposedInstruction = dynamic_cast<gd::StandardEvent &>(
+                                   layout.GetEvents().GetEvent(0))
+                                   .GetActions()
+                                   .Get(0);
+    REQUIRE(exposedInstruction.GetParameter(2).GetPlainString() ==
+            "sounds/audio2.wav");
+    REQUIRE(resourcesMerger.GetDirectFileReferencesNewFilename().size() == 1);
+    REQUIRE(resourcesMerger.GetDirectFileReferencesNewFilename()
+                ["sounds/audio2.wav"] ==
+            "FileNameFrom(MakeAbsolute(sounds/audio2.wav))");
+    REQUIRE(resourcesMerger.GetAllResourcesOldAndNewFilename()
+                ["MakeAbsolute(sounds/audio2.wav)"] ==
+            "FileNameFrom(MakeAbsolute(sounds/audio2.wav))");
+  }
 }
@@ -7,18 +7,22 @@
  * @file Tests covering serialization to JSON.
  */
 #include "GDCore/Serialization/Serializer.h"
+
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/Serialization.h"
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/BinarySerializer.h"
 #include "GDCore/Tools/SystemStats.h"
 #include "GDCore/Tools/VersionWrapper.h"
+#include "BenchmarkUtils.h"
+#include "DummyPlatform.h"
 #include "catch.hpp"
-
 using namespace gd;
 
 TEST_CASE("SerializerElement", "[common]") {
@@ -47,6 +51,82 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(copiedElement.GetStringAttribute("attr1") == "attr123 modified");
   }
 
+  SECTION("Children outliving their document, and copies between documents") {
+    std::shared_ptr<SerializerElement> keptChild;
+    {
+      SerializerElement element;
+      element.ConsiderAsArrayOf("item");
+      for (std::size_t i = 0; i < 100; ++i) {
+        SerializerElement& item = element.AddChild("item");
+        item.AddChild("value").SetIntValue(i);
+      }
+      keptChild = element.GetAllChildren()[42].second;
+
+      // Removed children memory is reused by the next ones.
+      element.RemoveChild("item");
+      element.AddChild("item").AddChild("value").SetIntValue(1000);
+      REQUIRE(element.GetChildrenCount() == 1);
+
+      SerializerElement otherElement;
+      otherElement.AddChild("copy") = element;
+      REQUIRE(otherElement.GetChild("copy").ConsideredAsArrayOf() == "item");
+      REQUIRE(otherElement.GetChild("copy")
+                  .GetChild(0)
+                  .GetChild("value")
+                  .GetIntValue() == 1000);
+
+      // Assigning an element from one of its descendants.
+      otherElement = otherElement.GetChild("copy").GetChild(0);
+      REQUIRE(otherElement.GetChild("value").GetIntValue() == 1000);
+    }
+
+    REQUIRE(keptChild->GetChild("value").GetIntValue() == 42);
+    keptChild->AddChild("other").SetStringValue("still usable");
+    REQUIRE(keptChild->GetChild("other").GetStringValue() == "still usable");
+  }
+
+  SECTION("Accessing children of elements with many children") {
+    SerializerElement element;
+    for (std::size_t i = 0; i < 100; ++i) {
+      element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+    }
+    REQUIRE(element.AddChild("child42").GetIntValue() == 42);
+    REQUIRE(element.GetAllChildren().size() == 100);
+    REQUIRE(element.HasChild("child99"));
+    REQUIRE(element.HasChild("notExisting", "child7"));
+    REQUIRE(!element.HasChild("child100"));
+    REQUIRE(element.GetChild("notExisting", 0, "child7").GetIntValue() == 7);
+
+    element.RemoveChild("child3");
+    REQUIRE(!element.HasChild("child3"));
+    REQUIRE(element.GetChild("child4").GetIntValue() == 4);
+    REQUIRE(element.GetAllChildren()[3].first == "child4");
+
+    // Attributes replace the children with the same name, if any.
+    element.RemoveChild("notExisting");
+    element.SetAttribute("attribute", 1);
+    element.SetAttribute("child5", 5);
+    REQUIRE(element.GetAllChildren().size() == 98);
+    REQUIRE(!element.HasChild("child5"));
+    REQUIRE(element.GetChild("child6").GetIntValue() == 6);
+
+    SerializerElement arrayElement;
+    arrayElement.ConsiderAsArrayOf("item", "oldItem");
+    for (std::size_t i = 0; i < 100; ++i) {
+      // Mix named and unnamed children, as loaded from different formats.
+      arrayElement.AddChild(i % 3 == 0 ? "" : "item").SetIntValue(i);
+    }
+    REQUIRE(arrayElement.GetChildrenCount() == 100);
+    for (std::size_t i = 0; i < 100; ++i) {
+      REQUIRE(arrayElement.GetChild(i).GetIntValue() == i);
+      REQUIRE(arrayElement.GetChild("item", i).GetIntValue() == i);
+    }
+
+    SerializerElement copiedArrayElement = arrayElement;
+    REQUIRE(copiedArrayElement.GetChildrenCount() == 100);
+    REQUIRE(copiedArrayElement.GetChild(99).GetIntValue() == 99);
+  }
+
   SECTION("Accessing already existing children, in objects") {
     SerializerElement element;
     element.AddChild("child1").SetStringValue("value123");
@@ -206,6 +286,29 @@ TEST_CASE("Serializer", "[common]") {
     }
   }
 
+  SECTION("Same elements with or without a rapidjson::Document") {
+    auto requireSameJSON = [](const gd::String& originalJSON) {
+      REQUIRE(Serializer::ToJSON(Serializer::FromJSON(originalJSON)) ==
+              Serializer::ToJSON(
+                  Serializer::FromJSONUsingDocument(originalJSON)));
+    };
+
+    requireSameJSON("true");
+    requireSameJSON("-12");
+    requireSameJSON("4294967296");
+    requireSameJSON("1.5e-7");
+    requireSameJSON("null");
+    requireSameJSON("{\"a\":null,\"b\":[null,1]}");
+    requireSameJSON(
+        "{\"hello\":{\"world\":[{},[],3,\"4\"],\"world2\":[-1,\"-2\","
+        "{\"-3\":[-4.5]}]},\"special-\\b\\f\\n\":\"\\u00e9\\t\"}");
+    requireSameJSON(u8"{\"Hello 官话 world\":\"官话\",\"a\":1,\"a\":2}");
+
+    // Invalid JSON gives an empty element.
+    REQUIRE(Serializer::ToJSON(Serializer::FromJSON("{\"a\":[1,}")) ==
+            Serializer::ToJSON(SerializerElement()));
+  }
+
   SECTION("(Deprecated) attributes") {
     gd::String originalJSON = "{\"ok\":true,\"hello\":\"world\"}";
     SerializerElement element = Serializer::FromJSON(originalJSON);
@@ -227,4 +330,228 @@ TEST_CASE("Serializer", "[common]") {
     gd::String json = Serializer::ToJSON(element);
     REQUIRE(json == "{\"hello\":\"world1\",\"ok\":true,\"hello2\":\"world2\"}");
   }
+
+  SECTION("Binary representation") {
+    SECTION("Same elements as with JSON") {
+      for (const gd::String& json : std::vector<gd::String>{
+               "{}",
+               "\"Hello world\"",
+               "{\"a\":1,\"b\":-2.5,\"c\":true,\"d\":\"hello\"}",
+               "[1,2,\"3\",[],{},[{\"a\":[]}]]",
+               "{\"a\":{\"b\":{\"c\":[false,\"\",0]}},\"e\":\"a\"}"}) {
+        SerializerElement element = Serializer::FromJSON(json);
+        std::string binary = BinarySerializer::ToBinary(element);
+        REQUIRE(BinarySerializer::IsBinary(binary.data(), binary.size()));
+        REQUIRE(Serializer::ToJSON(BinarySerializer::FromBinary(binary)) ==
+                json);
+      }
+    }
+
+    SECTION("Attributes, values and arrays of named children") {
+      SerializerElement element;
+      element.SetAttribute("bool", true);
+      element.SetAttribute("int", 42);
+      element.SetAttribute("double", 0.1);
+      element.SetAttribute("string", "Hello");
+      SerializerElement& array = element.AddChild("children");
+      array.ConsiderAsArrayOf("child");
+      array.AddChild("child").SetValue(3);
+      array.AddChild("child").SetValue(-1.5);
+      SerializerValue unknownValue;
+      unknownValue.Set("1.0");
+      element.AddChild("unknown").SetValue(unknownValue);
+
+      SerializerElement readElement =
+          BinarySerializer::FromBinary(BinarySerializer::ToBinary(element));
+      REQUIRE(readElement.GetBoolAttribute("bool") == true);
+      REQUIRE(readElement.GetIntAttribute("int") == 42);
+      REQUIRE(readElement.GetDoubleAttribute("double") == 0.1);
+      REQUIRE(readElement.GetStringAttribute("string") == "Hello");
+      REQUIRE(readElement.GetChild("children").ConsideredAsArrayOf() ==
+              "child");
+      REQUIRE(readElement.GetChild("children").GetChild(1).GetDoubleValue() ==
+              -1.5);
+      REQUIRE(readElement.GetChild("unknown").GetValue().GetString() == "1.0");
+      REQUIRE(Serializer::ToJSON(readElement) == Serializer::ToJSON(element));
+    }
+
+    SECTION("Strings with null characters") {
+      const gd::String string =
+          gd::String::FromUTF32(std::u32string(U"Hello\0world", 11));
+      REQUIRE(string.Raw().size() == 11);
+      SerializerElement element;
+      element.SetAttribute("string", string);
+      element.AddChild("child").SetValue(string);
+
+      SerializerElement readElement =
+          BinarySerializer::FromBinary(BinarySerializer::ToBinary(element));
+      REQUIRE(readElement.GetStringAttribute("string") == string);
+      REQUIRE(readElement.GetChild("child").GetStringValue() == string);
+      REQUIRE(readElement.GetChild("child").GetStringValue().Raw().size() ==
+              11);
+    }
+
+    SECTION("Invalid data") {
+      SerializerElement element = Serializer::FromJSON("{\"a\":[1,2,3]}");
+      std::string binary = BinarySerializer::ToBinary(element);
+      REQUIRE(!BinarySerializer::IsBinary("{}", 2));
+      REQUIRE(!BinarySerializedElement("{}", 2).IsValid());
+
+      // Truncated data is not read.
+      REQUIRE(!BinarySerializedElement(binary.data(), binary.size() - 1)
+                   .IsValid());
+      REQUIRE(Serializer::ToJSON(BinarySerializer::FromBinary(
+                  binary.data(), binary.size() - 1)) ==
+              Serializer::ToJSON(SerializerElement()));
+
+      // A child can't be stored at (or after) the offset of its parent.
+      // The offset of the child "a" is the last field of the root element,
+      // which has no value, no attributes and a single child.
+      std::uint32_t rootOffset = static_cast<unsigned char>(binary[8]) |
+                                 static_cast<unsigned char>(binary[9]) << 8;
+      std::size_t childOffsetPosition = rootOffset + 1 + 1 + 4 + 4 + 4 + 4;
+      REQUIRE(static_cast<unsigned char>(binary[childOffsetPosition]) <
+              rootOffset);
+      for (std::size_t i = 0; i < 4; ++i) {
+        binary[childOffsetPosition + i] = binary[8 + i];
+      }
+      BinarySerializedElement cyclicElement(binary.data(), binary.size());
+      REQUIRE(cyclicElement.IsValid());
+      REQUIRE(!cyclicElement.GetChild("a").IsValid());
+      REQUIRE(Serializer::ToJSON(BinarySerializer::FromBinary(binary)) ==
+              "{\"a\":{}}");
+    }
+
+    SECTION("Reading only a part of a project") {
+      gd::Project project;
+      InsertLayoutsWithEvents(project, 50, 50);
+      SerializerElement projectElement;
+      project.SerializeTo(projectElement);
+      std::string binary = BinarySerializer::ToBinary(projectElement);
+
+      BinarySerializedElement binaryProjectElement(binary.data(),
+                                                   binary.size());
+      REQUIRE(binaryProjectElement.IsValid());
+      BinarySerializedElement layoutsElement =
+          binaryProjectElement.GetChild("layouts");
+      REQUIRE(layoutsElement.ConsideredAsArray());
+      REQUIRE(layoutsElement.GetChildrenCount() == 50);
+      REQUIRE(!layoutsElement.GetChild(50).IsValid());
+      REQUIRE(!binaryProjectElement.HasChild("missing"));
+
+      SerializerElement layoutElement =
+          layoutsElement.GetChild(12).ToSerializerElement();
+      REQUIRE(layoutElement.GetStringAttribute("name") == "Scene 12");
+
+      // Like gd::Project::UnserializeFrom, which names the layouts.
+      gd::Layout layout;
+      layout.SetName(layoutElement.GetStringAttribute("name"));
+      layout.UnserializeFrom(project, layoutElement);
+      REQUIRE(layout.GetName() == "Scene 12");
+      REQUIRE(layout.GetVariables().Count() == 50);
+      REQUIRE(layout.GetEvents().GetEventsCount() == 50);
+    }
+  }
+}
+
+TEST_CASE("Serializer - Benchmarks", "[common]") {
+  SECTION("Parsing JSON with or without a rapidjson::Document") {
+    gd::Project project;
+    InsertLayoutsWithEvents(project, 50, 50);
+    SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+    const gd::String json = Serializer::ToJSON(projectElement);
+
+    SerializerElement streamedElement;
+    DoBenchmark("Serializer::FromJSON of a large project", 1, [&]() {
+      streamedElement = Serializer::FromJSON(json);
+    });
+    SerializerElement documentElement;
+    DoBenchmark(
+        "Serializer::FromJSONUsingDocument of a large project", 1, [&]() {
+          documentElement = Serializer::FromJSONUsingDocument(json);
+        });
+
+    REQUIRE(Serializer::ToJSON(streamedElement) == json);
+    REQUIRE(Serializer::ToJSON(documentElement) == json);
+  }
+
+  SECTION("Serializing and unserializing a large project") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    InsertLayoutsWithEvents(project, 50, 50);
+
+    SerializerElement projectElement;
+    DoBenchmark("Project::SerializeTo of a large project", 1, [&]() {
+      projectElement = SerializerElement();
+      project.SerializeTo(projectElement);
+    });
+    gd::String json;
+    DoBenchmark("Serializer::ToJSON of a large project", 1, [&]() {
+      json = Serializer::ToJSON(projectElement);
+    });
+    SerializerElement parsedElement = Serializer::FromJSON(json);
+    gd::Project unserializedProject;
+    unserializedProject.AddPlatform(platform);
+    DoBenchmark("Project::UnserializeFrom of a large project", 1, [&]() {
+      unserializedProject.UnserializeFrom(parsedElement);
+    });
+
+    REQUIRE(unserializedProject.GetLayoutsCount() == 50);
+  }
+
+  SECTION("Unserializing a project with 10k objects") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    InsertObjects(project, layout, "Object", 10000, true);
+    SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+
+    gd::Project unserializedProject;
+    unserializedProject.AddPlatform(platform);
+    DoBenchmark(
+        "Project::UnserializeFrom with 10000 objects and instances", 1, [&]() {
+          unserializedProject.UnserializeFrom(projectElement);
+        });
+
+    REQUIRE(unserializedProject.GetLayout("Scene")
+                .GetObjects()
+                .GetObjectsCount() == 10000);
+    REQUIRE(unserializedProject.GetLayout("Scene")
+                .GetInitialInstances()
+                .GetInstancesCount() == 10000);
+  }
+
+  SECTION("Reading a large project from its binary representation") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    InsertLayoutsWithEvents(project, 50, 50);
+    SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+    const gd::String json = Serializer::ToJSON(projectElement);
+
+    std::string binary;
+    DoBenchmark("BinarySerializer::ToBinary of a large project", 1, [&]() {
+      binary = BinarySerializer::ToBinary(projectElement);
+    });
+    DoBenchmark("Serializer::FromJSON of a large project", 1, [&]() {
+      Serializer::FromJSON(json);
+    });
+    SerializerElement binaryElement;
+    DoBenchmark("BinarySerializer::FromBinary of a large project", 1, [&]() {
+      binaryElement = BinarySerializer::FromBinary(binary);
+    });
+    DoBenchmark("A single scene read from a large project in binary", 1, [&]() {
+      BinarySerializedElement(binary.data(), binary.size())
+          .GetChild("layouts")
+          .GetChild(25)
+          .ToSerializerElement();
+    });
+
+    REQUIRE(Serializer::ToJSON(binaryElement) == json);
+  }
 }
@@ -12,6 +12,7 @@
 #include <initializer_list>
 #include <map>
 
+#include "BenchmarkUtils.h"
 #include "GDCore/CommonTools.h"
 #include "catch.hpp"
 
@@ -36,4 +37,107 @@ TEST_CASE("String", "[common]") {
     REQUIRE(str.RemoveConsecutiveOccurrences(str.begin(), str.end(), ' ') ==
             "Set animation of NewSprite to ");
   }
-}
\ No newline at end of file
+
+  SECTION("Cached size after modifications") {
+    gd::String str = "Hello";
+    REQUIRE(str.size() == 5);
+    REQUIRE(str[1] == U'e');
+
+    str += u8" été";
+    REQUIRE(str.size() == 9);
+    REQUIRE(str[7] == U't');
+    REQUIRE(str.substr(6, 3) == u8"été");
+    REQUIRE(str.find(u8"té") == 7);
+
+    str.erase(5, 4);
+    REQUIRE(str.size() == 5);
+    REQUIRE(str.find("lo") == 3);
+
+    str.push_back(U'é');
+    REQUIRE(str.size() == 6);
+    REQUIRE(str[5] == U'é');
+    str.pop_back();
+    REQUIRE(str.size() == 5);
+
+    str.replace(0, 1, u8"Ç");
+    REQUIRE(str.size() == 5);
+    REQUIRE(str[4] == U'o');
+    str.replace(0, 1, "Y");
+    str.insert(1, "ay ");
+    REQUIRE(str == "Yay ello");
+    REQUIRE(str.size() == 8);
+    REQUIRE(str.rfind("l") == 6);
+
+    str.Raw() += u8"à";
+    REQUIRE(str.size() == 9);
+    REQUIRE(str[8] == U'à');
+
+    gd::String copy = str;
+    str.clear();
+    REQUIRE(str.size() == 0);
+    REQUIRE(copy.size() == 9);
+
+    gd::String moved = std::move(copy);
+    REQUIRE(moved.size() == 9);
+    copy = "Reused";
+    REQUIRE(copy.size() == 6);
+  }
+}
+
+TEST_CASE("String - Benchmarks", "[common]") {
+  // A large string of generated code, only made of ASCII characters.
+  gd::String str;
+  for (std::size_t i = 0; i < 20000; ++i) {
+    str += "runtimeScene.getObjects(\"MyObject" + gd::String::From(i) +
+           "\");\n";
+  }
+
+  // Size, operator[], substr and find, when decoding the code points from
+  // the start of the string for each operation (which is what gd::String was
+  // always doing).
+  const std::size_t operationsCount = 200;
+  const gd::String &constStr = str;
+  const std::string &rawStr = constStr.Raw();
+  std::size_t decodingResult = 0;
+  DoBenchmark("String operations, decoding the string", 1, [&]() {
+    for (std::size_t i = 0; i < operationsCount; ++i) {
+      std::size_t size = std::distance(constStr.begin(), constStr.end());
+      auto it = constStr.begin();
+      std::advance(it, (i * 7919) % size);
+      decodingResult += size + *it;
+
+      auto substrStart = constStr.begin();
+      std::advance(substrStart, size / 2);
+      auto substrEnd = substrStart;
+      std::advance(substrEnd, 100);
+      decodingResult +=
+          std::string(substrStart.base(), substrEnd.base()).size();
+
+      std::size_t findPos = rawStr.find("MyObject19999");
+      for (auto it = constStr.begin(); it.base() != rawStr.begin() + findPos;
+           ++it) {
+        decodingResult++;
+      }
+    }
+  });
+
+  // The same operations, with the cached size and ASCII strings indexed by
+  // bytes.
+  std::size_t cachedResult = 0;
+  DoBenchmark("String operations, with the cached size", 1, [&]() {
+    for (std::size_t i = 0; i < operationsCount; ++i) {
+      std::size_t size = str.size();
+      cachedResult += size + str[(i * 7919) % size];
+      cachedResult += str.substr(size / 2, 100).Raw().size();
+      cachedResult += str.find("MyObject19999");
+    }
+  });
+
+  REQUIRE(cachedResult == decodingResult);
+
+  gd::String replacedStr = str;
+  DoBenchmark("FindAndReplace", 1, [&]() {
+    replacedStr = replacedStr.FindAndReplace("MyObject1", "MyOtherObject1");
+  });
+  REQUIRE(replacedStr.find("MyObject1") == gd::String::npos);
+}
@@ -0,0 +1,101 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the interned strings used for identifiers.
+ */
+#include "GDCore/Tools/Symbol.h"
+
+#include <unordered_map>
+
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "catch.hpp"
+
+TEST_CASE("Symbol", "[common]") {
+  SECTION("Basics") {
+    gd::Symbol symbol(gd::String("MyObject"));
+    gd::Symbol sameSymbol(gd::String("My") + "Object");
+    gd::Symbol otherSymbol(gd::String("MyOtherObject"));
+
+    REQUIRE(symbol.GetString() == "MyObject");
+    REQUIRE(symbol == sameSymbol);
+    REQUIRE(&symbol.GetString() == &sameSymbol.GetString());
+    REQUIRE(symbol.GetHash() == std::hash<gd::String>()("MyObject"));
+    REQUIRE(symbol != otherSymbol);
+
+    REQUIRE(gd::Symbol().GetString() == "");
+    REQUIRE(gd::Symbol() == gd::Symbol(""));
+
+    std::size_t internedStringsCount = gd::Symbol::GetInternedStringsCount();
+    gd::Symbol anotherSymbol(gd::String("MyObject"));
+    REQUIRE(gd::Symbol::GetInternedStringsCount() == internedStringsCount);
+
+    std::unordered_map<gd::Symbol, int> map;
+    map[symbol] = 1;
+    map[otherSymbol] = 2;
+    REQUIRE(map[sameSymbol] == 1);
+    REQUIRE(map[gd::Symbol(gd::String("MyOtherObject"))] == 2);
+  }
+
+  SECTION("Finding a symbol without interning it") {
+    gd::Symbol symbol(gd::String("MyFoundObject"));
+    gd::Symbol foundSymbol;
+    REQUIRE(gd::Symbol::FindInterned("MyFoundObject", foundSymbol));
+    REQUIRE(foundSymbol == symbol);
+
+    std::size_t internedStringsCount = gd::Symbol::GetInternedStringsCount();
+    REQUIRE(!gd::Symbol::FindInterned("MyNeverUsedObject", foundSymbol));
+    REQUIRE(foundSymbol == symbol);
+
+    // Queries on instances don't intern the names they are given.
+    gd::InitialInstancesContainer instances;
+    instances.InsertNewInitialInstance().SetObjectName("MyFoundObject");
+    REQUIRE(!instances.HasInstancesOfObject("MyNeverUsedObject"));
+    REQUIRE(!instances.IsInstancesCountOfObjectGreaterThan("MyNeverUsedObject",
+                                                           0));
+    REQUIRE(!instances.SomeInstancesAreOnLayer("MyNeverUsedLayer"));
+    REQUIRE(instances.GetLayerInstancesCount("MyNeverUsedLayer") == 0);
+    instances.RemoveInitialInstancesOfObject("MyNeverUsedObject");
+    REQUIRE(instances.GetInstancesCount() == 1);
+    REQUIRE(gd::Symbol::GetInternedStringsCount() == internedStringsCount);
+  }
+
+  SECTION("Instances and instructions") {
+    gd::InitialInstancesContainer instances;
+    gd::InitialInstance& instance1 = instances.InsertNewInitialInstance();
+    instance1.SetObjectName("MyObject");
+    instance1.SetLayer("MyLayer");
+    gd::InitialInstance& instance2 = instances.InsertNewInitialInstance();
+    instance2.SetObjectName("MyObject");
+    REQUIRE(instance2.GetLayer() == "");
+
+    REQUIRE(instance1.GetObjectNameSymbol() == instance2.GetObjectNameSymbol());
+    REQUIRE(&instance1.GetObjectName() == &instance2.GetObjectName());
+    REQUIRE(instances.HasInstancesOfObject("MyObject"));
+    REQUIRE(instances.GetLayerInstancesCount("MyLayer") == 1);
+
+    instances.RenameInstancesOfObject("MyObject", "MyRenamedObject");
+    REQUIRE(instance1.GetObjectName() == "MyRenamedObject");
+    REQUIRE(!instances.HasInstancesOfObject("MyObject"));
+    instances.MoveInstancesToLayer("MyLayer", "");
+    REQUIRE(!instances.SomeInstancesAreOnLayer("MyLayer"));
+    REQUIRE(instances.GetLayerInstancesCount("") == 2);
+
+    gd::Instruction instruction("MyExtension::DoSomething");
+    gd::Instruction otherInstruction;
+    REQUIRE(otherInstruction.GetType() == "");
+    otherInstruction.SetType("MyExtension::DoSomething");
+    REQUIRE(instruction.GetTypeSymbol() == otherInstruction.GetTypeSymbol());
+    REQUIRE(instruction.GetType() == "MyExtension::DoSomething");
+  }
+
+  SECTION("Memory") {
+    // Symbols are used instead of strings (plus their characters) in instances
+    // and instructions.
+    REQUIRE(sizeof(gd::Symbol) < sizeof(gd::String));
+  }
+}
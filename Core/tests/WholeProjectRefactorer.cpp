@@ -1580,6 +1580,54 @@ TEST_CASE("WholeProjectRefactorer", "[common]") {
                 "RenamedObjectWithMyBehavior.GetObjectNumber() + RenamedObjectWithMyBehavior.MyVariable + RenamedObjectWithMyBehavior.MyStructureVariable.Child");
       }
     }
+
+    SECTION("Expressions not using the object are not parsed") {
+      gd::Project project;
+      gd::Platform platform;
+      SetupProjectWithDummyPlatform(project, platform);
+      auto &layout = project.InsertNewLayout("Scene", 0);
+      layout.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                          "MyObject", 0);
+      auto &otherLayout = project.InsertNewLayout("OtherScene", 1);
+
+      auto addAction = [](gd::EventsList &events, const gd::String &value) {
+        gd::StandardEvent event;
+        gd::Instruction action;
+        action.SetType("MyExtension::DoSomething");
+        action.SetParametersCount(1);
+        action.SetParameter(0, gd::Expression(value));
+        event.GetActions().Insert(action);
+        events.InsertEvent(event);
+      };
+      for (std::size_t i = 0; i < 100; ++i) {
+        addAction(layout.GetEvents(), "1 + 2 * MyExtension::GetNumber()");
+        addAction(otherLayout.GetEvents(), "1 + 2 * MyExtension::GetNumber()");
+      }
+      addAction(layout.GetEvents(), "MyObject.GetObjectNumber()");
+
+      gd::Expression::ResetParsesCount();
+      gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+          project, layout, "MyObject", "MyRenamedObject",
+          /* isObjectGroup=*/false);
+      gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+          project, otherLayout, "MyObject", "MyRenamedObject",
+          /* isObjectGroup=*/false);
+
+      // Only the expression using the object was parsed.
+      REQUIRE(gd::Expression::GetParsesCount() == 1);
+      REQUIRE(layout.GetEvents()
+                  .GetEvent(100)
+                  .GetAllActionsVectors()[0]
+                  ->Get(0)
+                  .GetParameter(0)
+                  .GetPlainString() == "MyRenamedObject.GetObjectNumber()");
+      REQUIRE(layout.GetEvents()
+                  .GetEvent(0)
+                  .GetAllActionsVectors()[0]
+                  ->Get(0)
+                  .GetParameter(0)
+                  .GetPlainString() == "1 + 2 * MyExtension::GetNumber()");
+    }
   }
 
   SECTION("Group renamed (in layout)") {
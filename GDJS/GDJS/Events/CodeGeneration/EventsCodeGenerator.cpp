@@ -44,6 +44,27 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
     const gd::EventsList& events,
     gd::String functionPostEventsCode,
     gd::String functionReturnCode) {
+  gd::CodeOutput output;
+  GenerateEventsListCompleteFunctionCode(codeGenerator,
+                                         fullyQualifiedFunctionName,
+                                         functionArgumentsCode,
+                                         functionPreEventsCode,
+                                         events,
+                                         functionPostEventsCode,
+                                         functionReturnCode,
+                                         output);
+  return output.ToString();
+}
+
+void EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
+    gdjs::EventsCodeGenerator& codeGenerator,
+    gd::String fullyQualifiedFunctionName,
+    gd::String functionArgumentsCode,
+    gd::String functionPreEventsCode,
+    const gd::EventsList& events,
+    gd::String functionPostEventsCode,
+    gd::String functionReturnCode,
+    gd::CodeOutput& output) {
   // Prepare the global context
   unsigned int maxDepthLevelReached = 0;
   gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
@@ -78,27 +99,31 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   idToCallbackMapCode +=
       codeGenerator.GetCodeNamespace() + ".idToCallbackMap = new Map();\n";
 
-  gd::String output =
-      // clang-format off
+  // The code outside main and the events code are the largest parts of the
+  // code: they are appended without being copied.
+  // clang-format off
+  output +=
       codeGenerator.GetCodeNamespace() + " = {};\n" +
       localVariablesInitializationCode +
       idToCallbackMapCode +
       globalDeclarations +
-      globalObjectLists + "\n\n" +
-      codeGenerator.GetCustomCodeOutsideMain() + "\n\n" +
+      globalObjectLists + "\n\n";
+  output += codeGenerator.GetCustomCodeOutsideMain();
+  output +=
+      "\n\n" +
       fullyQualifiedFunctionName + " = function(" +
         functionArgumentsCode +
       ") {\n" +
         functionPreEventsCode + "\n" +
-        globalObjectListsReset + "\n" +
-        wholeEventsCode + "\n" +
+        globalObjectListsReset + "\n";
+  output += std::move(wholeEventsCode);
+  output +=
+        "\n" +
         globalObjectListsReset + "\n" +
         functionPostEventsCode + "\n" +
         functionReturnCode + "\n" +
       "}\n";
   // clang-format on
-
-  return output;
 }
 
 gd::String EventsCodeGenerator::GenerateLayoutCode(
@@ -108,23 +133,42 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
     std::set<gd::String>& includeFiles,
     gd::DiagnosticReport& diagnosticReport,
     bool compilationForRuntime) {
+  gd::CodeOutput output;
+  GenerateLayoutCode(project,
+                     scene,
+                     codeNamespace,
+                     includeFiles,
+                     diagnosticReport,
+                     compilationForRuntime,
+                     output);
+  return output.ToString();
+}
+
+void EventsCodeGenerator::GenerateLayoutCode(
+    const gd::Project& project,
+    const gd::Layout& scene,
+    const gd::String& codeNamespace,
+    std::set<gd::String>& includeFiles,
+    gd::DiagnosticReport& diagnosticReport,
+    bool compilationForRuntime,
+    gd::CodeOutput& output) {
   EventsCodeGenerator codeGenerator(project, scene);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
 
-  gd::String output = GenerateEventsListCompleteFunctionCode(
+  GenerateEventsListCompleteFunctionCode(
       codeGenerator,
       codeGenerator.GetCodeNamespaceAccessor() + "func",
       "runtimeScene",
       "runtimeScene.getOnceTriggers().startNewFrame();\n",
       scene.GetEvents(),
       "",
-      "return;\n");
+      "return;\n",
+      output);
 
   includeFiles.insert(codeGenerator.GetIncludeFiles().begin(),
                       codeGenerator.GetIncludeFiles().end());
-  return output;
 }
 
 gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
@@ -1207,8 +1251,11 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // List of objects, conditions booleans and any variables used by events
   // are stored in static variables that are globally available by the whole
   // code.
-  AddCustomCodeOutsideMain(functionName + " = function(" + parametersCode +
-                           ") {\n" + code + "\n" + "};");
+  gd::CodeOutput functionCode;
+  functionCode += functionName + " = function(" + parametersCode + ") {\n";
+  functionCode += std::move(code);
+  functionCode += "\n};";
+  AddCustomCodeOutsideMain(functionCode);
 
   // Replace the code of the events by the call to the function. This does not
   // interfere with the objects picking as the lists are in static variables
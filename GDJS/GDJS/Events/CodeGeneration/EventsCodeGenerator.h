@@ -55,6 +55,19 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
                                        gd::DiagnosticReport& diagnosticReport,
                                        bool compilationForRuntime = false);
 
+  /**
+   * Generate JavaScript for executing events of a scene, appending it to an
+   * output instead of returning it, so that the code is not copied.
+   *
+   * \see GenerateLayoutCode
+   */
+  static void GenerateLayoutCode(const gd::Project& project,
+                                 const gd::Layout& scene,
+                                 const gd::String& codeNamespace,
+                                 std::set<gd::String>& includeFiles,
+                                 gd::DiagnosticReport& diagnosticReport,
+                                 bool compilationForRuntime,
+                                 gd::CodeOutput& output);
   /**
    * Generate JavaScript for executing events of an events based function.
    *
@@ -392,6 +405,16 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       gd::String functionPostEventsCode,
       gd::String functionReturnCode);
 
+  static void GenerateEventsListCompleteFunctionCode(
+      gdjs::EventsCodeGenerator& codeGenerator,
+      gd::String fullyQualifiedFunctionName,
+      gd::String functionArgumentsCode,
+      gd::String functionPreEventsCode,
+      const gd::EventsList& events,
+      gd::String functionPostEventsCode,
+      gd::String functionReturnCode,
+      gd::CodeOutput& output);
+
   /**
    * \brief Generate the declarations of all the booleans required to run
    * events.
@@ -13,18 +13,35 @@ gd::String LayoutCodeGenerator::GenerateLayoutCompleteCode(
     std::set<gd::String>& includeFiles,
       gd::DiagnosticReport& diagnosticReport,
     bool compilationForRuntime) {
+  gd::CodeOutput output;
+  GenerateLayoutCompleteCode(
+      layout, includeFiles, diagnosticReport, compilationForRuntime, output);
+  return output.ToString();
+}
+
+void LayoutCodeGenerator::GenerateLayoutCompleteCode(
+    const gd::Layout& layout,
+    std::set<gd::String>& includeFiles,
+    gd::DiagnosticReport& diagnosticReport,
+    bool compilationForRuntime,
+    gd::CodeOutput& output) {
   gd::String sceneMangledName =
       gd::SceneNameMangler::Get()->GetMangledSceneName(layout.GetName());
   gd::String codeNamespace = "gdjs." + sceneMangledName + "Code";
 
-  gd::String layoutCode = EventsCodeGenerator::GenerateLayoutCode(
-      project, layout, codeNamespace, includeFiles, diagnosticReport, compilationForRuntime);
+  EventsCodeGenerator::GenerateLayoutCode(project,
+                                          layout,
+                                          codeNamespace,
+                                          includeFiles,
+                                          diagnosticReport,
+                                          compilationForRuntime,
+                                          output);
 
   // Export the symbols to avoid them being stripped by the Closure Compiler:
   gd::String exportCode =
       "gdjs['" + sceneMangledName + "Code']" + " = " + codeNamespace + ";\n";
 
-  return layoutCode + "\n" + exportCode;
+  output += "\n" + exportCode;
 }
 
 }  // namespace gdjs
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Events/CodeGeneration/CodeOutput.h"
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
 
 namespace gdjs {
@@ -35,6 +36,17 @@ class LayoutCodeGenerator {
       gd::DiagnosticReport& diagnosticReport,
       bool compilationForRuntime);
 
+  /**
+   * \brief Generate the complete code for the events of the specified scene,
+   * appending it to an output instead of returning it.
+   */
+  void GenerateLayoutCompleteCode(
+      const gd::Layout& layout,
+      std::set<gd::String>& includeFiles,
+      gd::DiagnosticReport& diagnosticReport,
+      bool compilationForRuntime,
+      gd::CodeOutput& output);
+
  private:
   const gd::Project& project;
 };
@@ -140,58 +140,76 @@ void JsPlatform::ReloadBuiltinExtensions() {
 #if defined(EMSCRIPTEN) // When compiling with emscripten, hardcode extensions
                         // to load.
   std::cout << "* Loading other extensions... ";
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPlatformBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDestroyOutsideBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTiledSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDraggableBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTopDownMovementBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSTextObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSParticleSystemExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPanelSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSAnchorBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPrimitiveDrawingExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTextEntryObjectExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSInventoryExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSLinkedObjectsExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSSystemInfoExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSShopifyExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPathfindingBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPhysicsBehaviorExtension()));
-  std::cout.flush();
+  // These extensions are only declared when they are used, so that their
+  // metadata are not all created at startup.
+  AddLazyExtension("PlatformBehavior", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPlatformBehaviorExtension());
+  });
+  AddLazyExtension("DestroyOutsideBehavior", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSDestroyOutsideBehaviorExtension());
+  });
+  AddLazyExtension("TiledSpriteObject", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTiledSpriteObjectExtension());
+  });
+  AddLazyExtension("DraggableBehavior", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSDraggableBehaviorExtension());
+  });
+  AddLazyExtension("TopDownMovementBehavior", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTopDownMovementBehaviorExtension());
+  });
+  AddLazyExtension("TextObject", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTextObjectExtension());
+  });
+  AddLazyExtension("ParticleSystem", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSParticleSystemExtension());
+  });
+  AddLazyExtension("PanelSpriteObject", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPanelSpriteObjectExtension());
+  });
+  AddLazyExtension("AnchorBehavior", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSAnchorBehaviorExtension());
+  });
+  AddLazyExtension("PrimitiveDrawing", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPrimitiveDrawingExtension());
+  });
+  AddLazyExtension("TextEntryObject", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTextEntryObjectExtension());
+  });
+  AddLazyExtension("Inventory", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSInventoryExtension());
+  });
+  AddLazyExtension("LinkedObjects", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSLinkedObjectsExtension());
+  });
+  AddLazyExtension("SystemInfo", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSSystemInfoExtension());
+  });
+  AddLazyExtension("Shopify", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSShopifyExtension());
+  });
+  AddLazyExtension("PathfindingBehavior", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPathfindingBehaviorExtension());
+  });
+  AddLazyExtension("PhysicsBehavior", [] {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPhysicsBehaviorExtension());
+  });
 #endif
   std::cout << "done." << std::endl;
 };
@@ -0,0 +1,130 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/IDE/EventsCodeCache.h"
+
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+
+/**
+ * Hash the element with FNV-1a, starting from the given hash. The result is
+ * the same for every run of the program.
+ */
+std::uint64_t HashElement(const gd::SerializerElement &element,
+                          std::uint64_t hash) {
+  const gd::String json = gd::Serializer::ToJSON(element);
+  for (unsigned char byte : json.Raw()) {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+}  // namespace
+
+namespace gdjs {
+
+EventsCodeCache *EventsCodeCache::_singleton = nullptr;
+
+std::uint64_t EventsCodeCache::ComputeProjectHash(const gd::Project &project,
+                                                  bool compilationForRuntime) {
+  gd::SerializerElement element;
+  element.SetAttribute("compilationForRuntime", compilationForRuntime);
+
+  const gd::Platform &platform = project.GetCurrentPlatform();
+  element.SetAttribute("platform", platform.GetName());
+  element.SetAttribute("extensionsVersion",
+                       gd::String::From(platform.GetExtensionsVersion()));
+
+  project.GetObjects().SerializeObjectsTo(element.AddChild("objects"));
+  project.GetObjects().GetObjectGroups().SerializeTo(
+      element.AddChild("objectsGroups"));
+  project.GetVariables().SerializeTo(element.AddChild("variables"));
+
+  gd::SerializerElement &externalEventsElement =
+      element.AddChild("externalEvents");
+  externalEventsElement.ConsiderAsArrayOf("externalEvents");
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    project.GetExternalEvents(i).SerializeTo(
+        externalEventsElement.AddChild("externalEvents"));
+  }
+
+  gd::SerializerElement &extensionsElement =
+      element.AddChild("eventsFunctionsExtensions");
+  extensionsElement.ConsiderAsArrayOf("eventsFunctionsExtension");
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    project.GetEventsFunctionsExtension(i).SerializeTo(
+        extensionsElement.AddChild("eventsFunctionsExtension"));
+  }
+
+  return HashElement(element, 14695981039346656037ULL);
+}
+
+std::uint64_t EventsCodeCache::ComputeSceneHash(const gd::Layout &layout,
+                                                std::uint64_t projectHash) {
+  gd::SerializerElement element;
+  element.SetAttribute("name", layout.GetName());
+  layout.GetObjects().SerializeObjectsTo(element.AddChild("objects"));
+  layout.GetObjects().GetObjectGroups().SerializeTo(
+      element.AddChild("objectsGroups"));
+  layout.GetVariables().SerializeTo(element.AddChild("variables"));
+  layout.GetEvents().SerializeTo(element.AddChild("events"));
+
+  return HashElement(element, projectHash);
+}
+
+bool EventsCodeCache::Find(const gd::String &filename,
+                           std::uint64_t hash,
+                           SceneCode &sceneCode) const {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = scenesCode.find(filename);
+  if (it == scenesCode.end() || it->second.hash != hash) return false;
+
+  sceneCode = it->second;
+  return true;
+}
+
+void EventsCodeCache::Store(const gd::String &filename,
+                            std::uint64_t hash,
+                            const std::set<gd::String> &includes,
+                            const gd::DiagnosticReport &diagnosticReport) {
+  std::lock_guard<std::mutex> lock(mutex);
+  SceneCode &sceneCode = scenesCode[filename];
+  sceneCode.hash = hash;
+  sceneCode.includes = includes;
+  sceneCode.diagnostics.clear();
+  for (std::size_t i = 0; i < diagnosticReport.Count(); ++i) {
+    sceneCode.diagnostics.push_back(diagnosticReport.Get(i));
+  }
+}
+
+void EventsCodeCache::Remove(const gd::String &filename) {
+  std::lock_guard<std::mutex> lock(mutex);
+  scenesCode.erase(filename);
+}
+
+EventsCodeCache &EventsCodeCache::Get() {
+  if (nullptr == _singleton) _singleton = new EventsCodeCache;
+
+  return *_singleton;
+}
+
+void EventsCodeCache::DestroySingleton() {
+  if (nullptr != _singleton) {
+    delete _singleton;
+    _singleton = nullptr;
+  }
+}
+
+}  // namespace gdjs
@@ -0,0 +1,111 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDJS_EVENTSCODECACHE_H
+#define GDJS_EVENTSCODECACHE_H
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class Layout;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Remember the code generated for the scenes of projects, so that a
+ * scene is generated (and written) again only if it changed since the last
+ * export.
+ *
+ * A scene is identified by the file where its code is written, and its code
+ * is identified by a hash of everything used to generate it: the events,
+ * objects, groups and variables of the scene, the global objects, groups and
+ * variables, the external events, the events functions extensions, the
+ * extensions of the platform and the generation options.
+ *
+ * The cache is kept for the whole lifetime of the program, as an exporter is
+ * usually created for each preview. It's only used for previews: exports of
+ * games always generate all the scenes (and make the cache forget the files
+ * they overwrite). It can be used by several exporters at the same time.
+ *
+ * \see ExporterHelper::ExportScenesEventsCode
+ */
+class EventsCodeCache {
+ public:
+  /**
+   * \brief What must be restored when the code of a scene is not generated
+   * again.
+   */
+  struct SceneCode {
+    std::uint64_t hash;
+    std::set<gd::String> includes;
+    std::vector<gd::ProjectDiagnostic> diagnostics;
+  };
+
+  /**
+   * \brief Compute the hash of what is used by all scenes of the project.
+   */
+  static std::uint64_t ComputeProjectHash(const gd::Project &project,
+                                          bool compilationForRuntime);
+
+  /**
+   * \brief Compute the hash of a scene, given the hash of the project
+   * computed with ComputeProjectHash.
+   */
+  static std::uint64_t ComputeSceneHash(const gd::Layout &layout,
+                                        std::uint64_t projectHash);
+
+  /**
+   * \brief Copy the scene code stored for the file in \a sceneCode and return
+   * true if it has the same hash. Return false otherwise.
+   */
+  bool Find(const gd::String &filename,
+            std::uint64_t hash,
+            SceneCode &sceneCode) const;
+
+  /**
+   * \brief Store the scene code written in the file.
+   */
+  void Store(const gd::String &filename,
+             std::uint64_t hash,
+             const std::set<gd::String> &includes,
+             const gd::DiagnosticReport &diagnosticReport);
+
+  /**
+   * \brief Forget the scene code stored for the file (because something else
+   * was written in it).
+   */
+  void Remove(const gd::String &filename);
+
+  /**
+   * \brief Forget everything stored in the cache.
+   */
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    scenesCode.clear();
+  }
+
+  static EventsCodeCache &Get();
+  static void DestroySingleton();
+
+ private:
+  EventsCodeCache(){};
+  virtual ~EventsCodeCache(){};
+  static EventsCodeCache *_singleton;
+
+  std::unordered_map<gd::String, SceneCode>
+      scenesCode;  ///< The code of scenes, by filename.
+  mutable std::mutex mutex;  ///< Protects scenesCode.
+};
+
+}  // namespace gdjs
+
+#endif  // GDJS_EVENTSCODECACHE_H
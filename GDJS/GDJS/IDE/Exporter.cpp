@@ -42,7 +42,7 @@ static void InsertUnique(std::vector<gd::String> &container, gd::String str) {
 }
 
 Exporter::Exporter(gd::AbstractFileSystem &fileSystem, gd::String gdjsRoot_)
-    : fs(fileSystem), gdjsRoot(gdjsRoot_) {
+    : fs(fileSystem), gdjsRoot(gdjsRoot_), codeGenerationThreadsCount(1) {
   SetCodeOutputDirectory(fs.GetTempDir() + "/GDTemporaries/JSCodeTemp");
 }
 
@@ -51,11 +51,13 @@ Exporter::~Exporter() {}
 bool Exporter::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
   return helper.ExportProjectForPixiPreview(options, includesFiles);
 }
 
 bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
   gd::Project exportedProject = options.project;
 
   auto usedExtensionsResult =
@@ -202,7 +204,7 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
   return true;
 }
 
-void Exporter::SerializeProjectData(const gd::Project &project,
+void Exporter::SerializeProjectData(gd::Project &project,
                                     const PreviewExportOptions &options,
                                     gd::SerializerElement &projectDataElement) {
   std::vector<gd::InGameEditorResourceMetadata> noInGameEditorResources;
@@ -65,6 +65,16 @@ class Exporter {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Change the number of threads used to generate the code of the
+   * scenes (1 by default).
+   *
+   * \see ExporterHelper::SetCodeGenerationThreadsCount
+   */
+  void SetCodeGenerationThreadsCount(std::size_t threadsCount) {
+    codeGenerationThreadsCount = threadsCount;
+  }
+
   /**
    * \brief Serialize a project without its events to JSON
    *
@@ -72,7 +82,7 @@ class Exporter {
    * \param options The content of the extra configuration
    * \param projectDataElement The element where the project data is serialized
    */
-  void SerializeProjectData(const gd::Project &project,
+  void SerializeProjectData(gd::Project &project,
                             const PreviewExportOptions &options,
                             gd::SerializerElement &projectDataElement);
 
@@ -101,6 +111,8 @@ private:
                              ///< be then copied to the final output directory.
   std::vector<gd::String>
       includesFiles; ///< The list of scripts files - useful for hot-reloading
+  std::size_t codeGenerationThreadsCount;  ///< The number of threads used to
+                                           ///< generate the code of scenes.
 };
 
 }  // namespace gdjs
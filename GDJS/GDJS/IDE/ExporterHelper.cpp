@@ -10,15 +10,22 @@
 #endif
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <exception>
 #include <fstream>
 #include <functional>
 #include <sstream>
 #include <streambuf>
 #include <string>
+#if !defined(EMSCRIPTEN)
+#include <thread>
+#endif
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/CodeGeneration/CodeOutput.h"
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
 #include "GDCore/Events/CodeGeneration/EffectsCodeGenerator.h"
+#include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/DependencyMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/InGameEditorResourceMetadata.h"
@@ -46,6 +53,8 @@
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
+#include "GDJS/IDE/EventsCodeCache.h"
+#include "GDJS/IDE/ProjectExportOverlay.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
 
@@ -104,7 +113,10 @@ static gd::String CleanProjectName(gd::String projectName) {
 ExporterHelper::ExporterHelper(gd::AbstractFileSystem &fileSystem,
                                gd::String gdjsRoot_,
                                gd::String codeOutputDir_)
-    : fs(fileSystem), gdjsRoot(gdjsRoot_), codeOutputDir(codeOutputDir_) {};
+    : fs(fileSystem),
+      gdjsRoot(gdjsRoot_),
+      codeOutputDir(codeOutputDir_),
+      codeGenerationThreadsCount(1) {};
 
 bool ExporterHelper::ExportProjectForPixiPreview(
     const PreviewExportOptions &options,
@@ -127,32 +139,35 @@ bool ExporterHelper::ExportProjectForPixiPreview(
 
   std::vector<gd::InGameEditorResourceMetadata> inGameEditorResources;
 
-  // TODO Try to remove side effects to avoid the copy
-  // that destroys the AST in cache.
-  gd::Project exportedProject = options.project;
+  // The project is neither modified nor copied: the parts changed by the
+  // export (resources filenames, loading screen, watermark and authors) are
+  // changed in an overlay, applied when the project data is serialized.
+  gd::Project &project = options.project;
   const gd::Project &immutableProject = options.project;
-  previousTime = LogTimeSpent("Project cloning", previousTime);
+  ProjectExportOverlay exportOverlay(immutableProject);
+  previousTime = LogTimeSpent("Project export overlay creation", previousTime);
 
   if (options.isInGameEdition) {
     if (options.shouldReloadProjectData ||
         options.shouldGenerateScenesEventsCode ||
         options.shouldClearExportFolder) {
-      auto projectDirectory = fs.DirNameFrom(exportedProject.GetProjectFile());
+      auto projectDirectory = fs.DirNameFrom(project.GetProjectFile());
       gd::ResourcesMergingHelper resourcesMergingHelper(
-          exportedProject.GetResourcesManager(), fs);
+          exportOverlay.GetResourcesManager(), fs);
       resourcesMergingHelper.SetBaseDirectory(projectDirectory);
       resourcesMergingHelper.SetShouldUseOriginalAbsoluteFilenames();
-      gd::ResourceExposer::ExposeWholeProjectResources(exportedProject,
+      resourcesMergingHelper.KeepDirectFileReferences();
+      gd::ResourceExposer::ExposeWholeProjectResources(project,
                                                         resourcesMergingHelper);
-
+      exportOverlay.GetDirectFileReferencesNewFilename() =
+          resourcesMergingHelper.GetDirectFileReferencesNewFilename();
       previousTime = LogTimeSpent("Resource path resolving", previousTime);
     }
     gd::LogStatus("Resource export is skipped");
   } else {
     // Export resources (*before* generating events as some resources filenames
     // may be updated)
-    ExportResources(fs, exportedProject, options.exportPath);
-
+    ExportResources(fs, project, exportOverlay, options.exportPath);
     previousTime = LogTimeSpent("Resource export", previousTime);
   }
 
@@ -163,7 +178,8 @@ bool ExporterHelper::ExportProjectForPixiPreview(
     // Stay compatible with text objects declaring their font as just a filename
     // without a font resource - by manually adding these resources.
     AddDeprecatedFontFilesToFontResources(
-        fs, exportedProject.GetResourcesManager(), options.exportPath);
+        fs, exportOverlay.GetResourcesManager(), options.exportPath);
+    exportOverlay.AddDirectFontFileReferencesResources();
     // end of compatibility code
   }
 
@@ -171,7 +187,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   std::vector<gd::SourceFileMetadata> &usedSourceFiles = noUsedSourceFiles;
   if (options.shouldReloadLibraries || options.shouldClearExportFolder) {
     auto usedExtensionsResult =
-        gd::UsedExtensionsFinder::ScanProject(exportedProject);
+        gd::UsedExtensionsFinder::ScanProject(project);
     usedSourceFiles = usedExtensionsResult.GetUsedSourceFiles();
 
     // Export engine libraries
@@ -224,9 +240,9 @@ bool ExporterHelper::ExportProjectForPixiPreview(
       // Export all event-based objects because they can be edited even if they
       // are not used yet.
       for (std::size_t e = 0;
-           e < exportedProject.GetEventsFunctionsExtensionsCount(); e++) {
+           e < immutableProject.GetEventsFunctionsExtensionsCount(); e++) {
         auto &eventsFunctionsExtension =
-            exportedProject.GetEventsFunctionsExtension(e);
+            immutableProject.GetEventsFunctionsExtension(e);
 
         for (auto &&eventsBasedObjectUniquePtr :
              eventsFunctionsExtension.GetEventsBasedObjects()
@@ -234,7 +250,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
           auto eventsBasedObject = eventsBasedObjectUniquePtr.get();
 
           auto metadata = gd::MetadataProvider::GetExtensionAndObjectMetadata(
-              exportedProject.GetCurrentPlatform(),
+              immutableProject.GetCurrentPlatform(),
               gd::PlatformExtension::GetObjectFullType(
                   eventsFunctionsExtension.GetName(),
                   eventsBasedObject->GetName()));
@@ -245,7 +261,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                metadata.GetMetadata().GetDefaultBehaviors()) {
             auto behaviorMetadata =
                 gd::MetadataProvider::GetExtensionAndBehaviorMetadata(
-                    exportedProject.GetCurrentPlatform(), behaviorType);
+                    immutableProject.GetCurrentPlatform(), behaviorType);
             for (auto &&includeFile :
                  behaviorMetadata.GetMetadata().includeFiles) {
               InsertUnique(includesFiles, includeFile);
@@ -257,7 +273,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
 
     // Export effects (after engine libraries as they auto-register themselves to
     // the engine)
-    ExportEffectIncludes(exportedProject, includesFiles);
+    ExportEffectIncludes(project, includesFiles);
 
     previousTime = LogTimeSpent("Include files export", previousTime);
   }
@@ -288,28 +304,28 @@ bool ExporterHelper::ExportProjectForPixiPreview(
 
     if (options.fullLoadingScreen) {
       // Use project properties fallback to set empty properties
-      if (exportedProject.GetAuthorIds().empty() &&
+      if (exportOverlay.GetAuthorIds().empty() &&
           !options.fallbackAuthorId.empty()) {
-        exportedProject.GetAuthorIds().push_back(options.fallbackAuthorId);
+        exportOverlay.GetAuthorIds().push_back(options.fallbackAuthorId);
       }
-      if (exportedProject.GetAuthorUsernames().empty() &&
+      if (exportOverlay.GetAuthorUsernames().empty() &&
           !options.fallbackAuthorUsername.empty()) {
-        exportedProject.GetAuthorUsernames().push_back(
+        exportOverlay.GetAuthorUsernames().push_back(
             options.fallbackAuthorUsername);
       }
     } else {
       // Most of the time, we skip the logo and minimum duration so that
       // the preview start as soon as possible.
-      exportedProject.GetLoadingScreen()
+      exportOverlay.GetLoadingScreen()
           .ShowGDevelopLogoDuringLoadingScreen(false)
           .SetMinDuration(0);
-      exportedProject.GetWatermark().ShowGDevelopWatermark(false);
+      exportOverlay.GetWatermark().ShowGDevelopWatermark(false);
     }
 
     gd::SerializerElement runtimeGameOptions;
     ExporterHelper::SerializeRuntimeGameOptions(fs, gdjsRoot, options,
                                                     includesFiles, runtimeGameOptions);
-    ExportProjectData(fs, exportedProject, codeOutputDir + "/data.js",
+    ExportProjectData(fs, project, exportOverlay, codeOutputDir + "/data.js",
                       runtimeGameOptions, options.isInGameEdition,
                       inGameEditorResources);
     includesFiles.push_back(codeOutputDir + "/data.js");
@@ -329,7 +345,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
     // generation.
     if (options.shouldGenerateScenesEventsCode || options.shouldClearExportFolder) {
       // Create the index file
-      if (!ExportIndexFile(exportedProject, gdjsRoot + "/Runtime/index.html",
+      if (!ExportIndexFile(immutableProject, gdjsRoot + "/Runtime/index.html",
                            options.exportPath, includesFiles, usedSourceFiles,
                            options.nonRuntimeScriptsCacheBurst,
                            "gdjs.runtimeGameOptions")) {
@@ -348,13 +364,24 @@ gd::String ExporterHelper::ExportProjectData(
     gd::AbstractFileSystem &fs, gd::Project &project, gd::String filename,
     const gd::SerializerElement &runtimeGameOptions, bool isInGameEdition,
     const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources) {
+  ProjectExportOverlay exportOverlay(project);
+  return ExportProjectData(fs, project, exportOverlay, filename,
+                           runtimeGameOptions, isInGameEdition,
+                           inGameEditorResources);
+}
+
+gd::String ExporterHelper::ExportProjectData(
+    gd::AbstractFileSystem &fs, gd::Project &project,
+    ProjectExportOverlay &exportOverlay, gd::String filename,
+    const gd::SerializerElement &runtimeGameOptions, bool isInGameEdition,
+    const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources) {
   fs.MkDir(fs.DirNameFrom(filename));
 
   gd::SerializerElement projectDataElement;
-  ExporterHelper::StripAndSerializeProjectData(project, projectDataElement,
+  ExporterHelper::StripAndSerializeProjectData(project, exportOverlay,
+                                                projectDataElement,
                                                 isInGameEdition,
                                                 inGameEditorResources);
-
   // Save the project to JSON
   gd::String output =
       "gdjs.projectData = " + gd::Serializer::ToJSON(projectDataElement) +
@@ -512,11 +539,11 @@ void ExporterHelper::SerializeRuntimeGameOptions(
 }
 
 void ExporterHelper::AddInGameEditorResources(
-    gd::Project &project,
+    gd::ResourcesContainer &resourcesContainer,
     std::set<gd::String> &projectUsedResources,
     const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources) {
   for (const auto &inGameEditorResource : inGameEditorResources) {
-    project.GetResourcesManager().AddResource(
+    resourcesContainer.AddResource(
         inGameEditorResource.GetResourceName(),
         inGameEditorResource.GetFilePath(),
         inGameEditorResource.GetKind());
@@ -525,17 +552,18 @@ void ExporterHelper::AddInGameEditorResources(
 }
 
 void ExporterHelper::SerializeProjectData(gd::AbstractFileSystem &fs,
-                                          const gd::Project &project,
+                                          gd::Project &project,
                                           const PreviewExportOptions &options,
                                           gd::SerializerElement &rootElement,
                                           const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources) {
-  gd::Project clonedProject = project;
+  ProjectExportOverlay exportOverlay(project);
 
   // Replace all resource file paths with the one used in exported projects.
   auto projectDirectory = fs.DirNameFrom(project.GetProjectFile());
   gd::ResourcesMergingHelper resourcesMergingHelper(
-      clonedProject.GetResourcesManager(), fs);
+      exportOverlay.GetResourcesManager(), fs);
   resourcesMergingHelper.SetBaseDirectory(projectDirectory);
+  resourcesMergingHelper.KeepDirectFileReferences();
   if (options.isInGameEdition) {
     resourcesMergingHelper.SetShouldUseOriginalAbsoluteFilenames();
   } else {
@@ -546,39 +574,45 @@ void ExporterHelper::SerializeProjectData(gd::AbstractFileSystem &fs,
   if (!options.fullLoadingScreen) {
     // Most of the time, we skip the logo and minimum duration so that
     // the preview start as soon as possible.
-    clonedProject.GetLoadingScreen()
+    exportOverlay.GetLoadingScreen()
         .ShowGDevelopLogoDuringLoadingScreen(false)
         .SetMinDuration(0);
-    clonedProject.GetWatermark().ShowGDevelopWatermark(false);
+    exportOverlay.GetWatermark().ShowGDevelopWatermark(false);
   }
 
-  gd::ResourceExposer::ExposeWholeProjectResources(clonedProject,
+  gd::ResourceExposer::ExposeWholeProjectResources(project,
                                                    resourcesMergingHelper);
+  exportOverlay.GetDirectFileReferencesNewFilename() =
+      resourcesMergingHelper.GetDirectFileReferencesNewFilename();
 
-  ExporterHelper::StripAndSerializeProjectData(clonedProject, rootElement,
+  ExporterHelper::StripAndSerializeProjectData(project, exportOverlay,
+                                                rootElement,
                                                 options.isInGameEdition,
                                                 inGameEditorResources);
 }
 
 void ExporterHelper::StripAndSerializeProjectData(
-    gd::Project &project, gd::SerializerElement &rootElement,
-    bool isInGameEdition,
+    gd::Project &project, ProjectExportOverlay &exportOverlay,
+    gd::SerializerElement &rootElement, bool isInGameEdition,
     const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources) {
+  gd::ResourcesContainer &resourcesContainer =
+      exportOverlay.GetResourcesManager();
   auto projectUsedResources =
-      gd::SceneResourcesFinder::FindProjectResources(project);
+      gd::SceneResourcesFinder::FindProjectResources(project,
+                                                     resourcesContainer);
 
   if (isInGameEdition) {
     // All used in-game editor resources must be always loaded and available.
     ExporterHelper::AddInGameEditorResources(
-        project, projectUsedResources, inGameEditorResources);
+        resourcesContainer, projectUsedResources, inGameEditorResources);
   }
-
   std::unordered_map<gd::String, std::set<gd::String>> scenesUsedResources;
   for (std::size_t layoutIndex = 0;
        layoutIndex < project.GetLayoutsCount(); layoutIndex++) {
     auto &layout = project.GetLayout(layoutIndex);
     scenesUsedResources[layout.GetName()] =
-        gd::SceneResourcesFinder::FindSceneResources(project, layout);
+        gd::SceneResourcesFinder::FindSceneResources(project, layout,
+                                                     resourcesContainer);
   }
 
   std::unordered_map<gd::String, std::set<gd::String>>
@@ -595,7 +629,8 @@ void ExporterHelper::StripAndSerializeProjectData(
           eventsFunctionsExtension.GetName(), eventsBasedObject->GetName());
       eventsBasedObjectVariantsUsedResources[eventsBasedObjectType] =
           gd::SceneResourcesFinder::FindEventsBasedObjectVariantResources(
-              project, eventsBasedObject->GetDefaultVariant());
+              project, eventsBasedObject->GetDefaultVariant(),
+              resourcesContainer);
 
       for (auto &&eventsBasedObjectVariant :
            eventsBasedObject->GetVariants().GetInternalVector()) {
@@ -605,16 +640,16 @@ void ExporterHelper::StripAndSerializeProjectData(
             eventsBasedObjectVariant->GetName());
         eventsBasedObjectVariantsUsedResources[variantType] =
             gd::SceneResourcesFinder::FindEventsBasedObjectVariantResources(
-                project, *eventsBasedObjectVariant);
+                project, *eventsBasedObjectVariant, resourcesContainer);
       }
     }
   }
 
-  // Strip the project (*after* generating events as the events may use stripped
-  // things (objects groups...))
-  gd::ProjectStripper::StripProjectForExport(project);
-
-  project.SerializeTo(rootElement);
+  // Serialize the project as if it was stripped (it's done *after* generating
+  // events as the events may use stripped things (objects groups...)), with
+  // the parts changed by the export.
+  gd::ProjectStripper::SerializeProjectForExport(project, rootElement);
+  exportOverlay.SerializeTo(rootElement);
   SerializeUsedResources(rootElement, projectUsedResources, scenesUsedResources,
                          eventsBasedObjectVariantsUsedResources);
   if (isInGameEdition) {
@@ -1286,28 +1321,132 @@ bool ExporterHelper::ExportScenesEventsCode(
     bool exportForPreview) {
   fs.MkDir(outputDir);
 
-  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+  // The code of each scene is generated in its own output, so that scenes can
+  // be generated in parallel and still be written in the order of the scenes.
+  struct SceneCode {
+    gd::String filename;
+    std::uint64_t hash;
+    bool isUnchanged;
+    gd::CodeOutput eventsOutput;
     std::set<gd::String> eventsIncludes;
+    gd::DiagnosticReport *diagnosticReport;
+  };
+  std::vector<SceneCode> scenesCode(project.GetLayoutsCount());
+
+  // For previews, scenes that did not change since the last export (and are
+  // still in the output directory) are neither generated nor written again.
+  EventsCodeCache &eventsCodeCache = EventsCodeCache::Get();
+  std::uint64_t projectHash =
+      exportForPreview ? EventsCodeCache::ComputeProjectHash(project, false)
+                       : 0;
+  std::vector<std::size_t> scenesToGenerate;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
     const gd::Layout &layout = project.GetLayout(i);
-
-    auto &diagnosticReport =
-        wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
+    SceneCode &sceneCode = scenesCode[i];
+    sceneCode.filename = outputDir + "/" + "code" + gd::String::From(i) + ".js";
+    sceneCode.diagnosticReport =
+        &wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
             layout.GetName());
+    sceneCode.isUnchanged = false;
+    if (!exportForPreview) {
+      scenesToGenerate.push_back(i);
+      continue;
+    }
+
+    sceneCode.hash = EventsCodeCache::ComputeSceneHash(layout, projectHash);
+    EventsCodeCache::SceneCode cachedSceneCode;
+    sceneCode.isUnchanged =
+        eventsCodeCache.Find(
+            sceneCode.filename, sceneCode.hash, cachedSceneCode) &&
+        fs.FileExists(sceneCode.filename);
+    if (sceneCode.isUnchanged) {
+      sceneCode.eventsIncludes = std::move(cachedSceneCode.includes);
+      for (auto &diagnostic : cachedSceneCode.diagnostics)
+        sceneCode.diagnosticReport->Add(diagnostic);
+    } else {
+      scenesToGenerate.push_back(i);
+    }
+  }
+
+  auto generateSceneCode = [&project, &scenesCode, exportForPreview](
+                               std::size_t i) {
+    SceneCode &sceneCode = scenesCode[i];
     LayoutCodeGenerator layoutCodeGenerator(project);
-    gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, diagnosticReport, !exportForPreview);
-    gd::String filename =
-        outputDir + "/" + "code" + gd::String::From(i) + ".js";
+    layoutCodeGenerator.GenerateLayoutCompleteCode(project.GetLayout(i),
+                                                   sceneCode.eventsIncludes,
+                                                   *sceneCode.diagnosticReport,
+                                                   !exportForPreview,
+                                                   sceneCode.eventsOutput);
+  };
 
-    // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
-      for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+  std::size_t threadsCount =
+      std::min(codeGenerationThreadsCount, scenesToGenerate.size());
+#if !defined(EMSCRIPTEN)
+  if (threadsCount > 1) {
+    // Create what is lazily created on first use before starting the
+    // threads.
+    project.GetCurrentPlatform().GetMetadataIndex();
+    gd::SceneNameMangler::Get();
+    EventsCodeNameMangler::Get();
+
+    std::atomic<std::size_t> nextIndex(0);
+    std::vector<std::exception_ptr> exceptions(threadsCount);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < threadsCount; ++t) {
+      threads.emplace_back(
+          [&scenesToGenerate, &generateSceneCode, &nextIndex, &exceptions, t]() {
+            try {
+              for (std::size_t i = nextIndex++; i < scenesToGenerate.size();
+                   i = nextIndex++) {
+                generateSceneCode(scenesToGenerate[i]);
+              }
+            } catch (...) {
+              exceptions[t] = std::current_exception();
+            }
+          });
+    }
+    for (auto &thread : threads) thread.join();
+    for (auto &exception : exceptions) {
+      if (exception) std::rethrow_exception(exception);
+    }
+  } else
+#endif
+  {
+    for (std::size_t i : scenesToGenerate) {
+      generateSceneCode(i);
+    }
+  }
 
-      InsertUnique(includesFiles, filename);
-    } else {
-      lastError = _("Unable to write ") + filename;
-      return false;
+  // Export the code, and merge the includes in the order of the scenes.
+  std::set<gd::String> alreadyIncludedFiles(includesFiles.begin(),
+                                            includesFiles.end());
+  auto insertUnique = [&includesFiles,
+                       &alreadyIncludedFiles](const gd::String &include) {
+    if (alreadyIncludedFiles.insert(include).second)
+      includesFiles.push_back(include);
+  };
+  for (auto &sceneCode : scenesCode) {
+    if (!sceneCode.isUnchanged) {
+      // The code is concatenated only when written, and released just after.
+      bool isWritten = fs.WriteToFile(sceneCode.filename,
+                                      sceneCode.eventsOutput.ToString());
+      sceneCode.eventsOutput = gd::CodeOutput();
+      if (!isWritten) {
+        lastError = _("Unable to write ") + sceneCode.filename;
+        return false;
+      }
+      if (exportForPreview)
+        eventsCodeCache.Store(sceneCode.filename,
+                              sceneCode.hash,
+                              sceneCode.eventsIncludes,
+                              *sceneCode.diagnosticReport);
+      else
+        eventsCodeCache.Remove(sceneCode.filename);
     }
+
+    for (auto &include : sceneCode.eventsIncludes) insertUnique(include);
+
+    insertUnique(sceneCode.filename);
   }
 
   return true;
@@ -1399,6 +1538,16 @@ void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
       project, fs, exportDir, true, false, false);
 }
 
+void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
+                                     gd::Project &project,
+                                     ProjectExportOverlay &exportOverlay,
+                                     gd::String exportDir) {
+  gd::ProjectResourcesCopier::CopyAllResourcesTo(
+      project, exportOverlay.GetResourcesManager(),
+      exportOverlay.GetDirectFileReferencesNewFilename(), fs, exportDir, false,
+      false);
+}
+
 void ExporterHelper::AddDeprecatedFontFilesToFontResources(
     gd::AbstractFileSystem &fs,
     gd::ResourcesContainer &resourcesManager,
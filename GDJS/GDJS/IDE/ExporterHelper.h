@@ -28,7 +28,10 @@ class InGameEditorResourceMetadata;
 }  // namespace gd
 
 namespace gdjs {
+class ProjectExportOverlay;
+}  // namespace gdjs
 
+namespace gdjs {
 /**
  * \brief The options used to export a project for a preview.
  */
@@ -496,17 +499,29 @@ class ExporterHelper {
       const gd::SerializerElement &runtimeGameOptions, bool isInGameEdition,
       const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources);
 
+  /**
+   * \brief Export a project without its events and options to 2 JS variables,
+   * without modifying the project: the parts changed by the export are taken
+   * from \a exportOverlay.
+   *
+   * \see ExportProjectData
+   */
+  static gd::String ExportProjectData(
+      gd::AbstractFileSystem &fs, gd::Project &project,
+      ProjectExportOverlay &exportOverlay, gd::String filename,
+      const gd::SerializerElement &runtimeGameOptions, bool isInGameEdition,
+      const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources);
   /**
    * \brief Serialize a project without its events to JSON
    *
    * \param fs The abstract file system to use to write the file
-   * \param project The project to be exported.
+   * \param project The project to be exported. It is not modified.
    * \param options The content of the extra configuration
    * \param projectDataElement The element where the project data is serialized
    * \param inGameEditorResources The list of in-game editor resources to be used.
    */
   static void SerializeProjectData(gd::AbstractFileSystem &fs,
-                                   const gd::Project &project,
+                                   gd::Project &project,
                                    const PreviewExportOptions &options,
                                    gd::SerializerElement &projectDataElement,
                                    const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources);
@@ -543,6 +558,21 @@ class ExporterHelper {
                               gd::Project &project,
                               gd::String exportDir);
 
+  /**
+   * \brief Copy all the resources of the project to to the export directory,
+   * updating the resources filenames of \a exportOverlay instead of the ones
+   * of the project.
+   *
+   * \param fs The abstract file system to use
+   * \param project The project with resources to be exported. It is not
+   * modified.
+   * \param exportOverlay The overlay with the resources to be exported.
+   * \param exportDir The directory where the preview must be created.
+   */
+  static void ExportResources(gd::AbstractFileSystem &fs,
+                              gd::Project &project,
+                              ProjectExportOverlay &exportOverlay,
+                              gd::String exportDir);
   /**
    * \brief Add libraries files to the list of includes.
    */
@@ -585,6 +615,13 @@ class ExporterHelper {
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   *
+   * \note Scenes are generated by as many threads as set with
+   * SetCodeGenerationThreadsCount. The generated files are the same whatever
+   * the number of threads.
+   *
+   * \note For previews, scenes that did not change since the last export to
+   * the same directory are not generated again (see gdjs::EventsCodeCache).
    */
   bool ExportScenesEventsCode(
       const gd::Project &project,
@@ -736,6 +773,17 @@ class ExporterHelper {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Change the number of threads used to generate the code of the
+   * scenes.
+   *
+   * By default, this is set to 1: scenes are generated one after the other.
+   * This is ignored when compiled with Emscripten.
+   */
+  void SetCodeGenerationThreadsCount(std::size_t threadsCount) {
+    codeGenerationThreadsCount = threadsCount;
+  }
+
   static void AddDeprecatedFontFilesToFontResources(
       gd::AbstractFileSystem &fs,
       gd::ResourcesContainer &resourcesManager,
@@ -749,6 +797,8 @@ class ExporterHelper {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::size_t codeGenerationThreadsCount;  ///< The number of threads used to
+                                           ///< generate the code of scenes.
 
  private:
    static void
@@ -760,19 +810,21 @@ class ExporterHelper {
                               &eventsBasedObjectVariantsUsedResources);
 
    /**
-    * \brief Strip a project and serialize it to JSON.
+    * \brief Serialize a project, stripped and with the parts of the overlay,
+    * to JSON. The project is not modified.
     */
    static void StripAndSerializeProjectData(gd::Project &project,
+                                             ProjectExportOverlay &exportOverlay,
                                              gd::SerializerElement &rootElement,
                                              bool isInGameEdition,
                                              const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources);
 
    /**
     * \brief Add additional resources that are used by the in-game editor to the
-    * project.
+    * exported resources.
     */
    static void
-   AddInGameEditorResources(gd::Project &project,
+   AddInGameEditorResources(gd::ResourcesContainer &resourcesContainer,
                             std::set<gd::String> &projectUsedResources,
                             const std::vector<gd::InGameEditorResourceMetadata> &inGameEditorResources);
 };
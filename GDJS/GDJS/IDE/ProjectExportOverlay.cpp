@@ -0,0 +1,72 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/IDE/ProjectExportOverlay.h"
+
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+
+void SerializeStringsTo(const std::vector<gd::String> &strings,
+                        gd::SerializerElement &element) {
+  element = gd::SerializerElement();
+  element.ConsiderAsArray();
+  for (const auto &string : strings) {
+    element.AddChild("").SetStringValue(string);
+  }
+}
+
+}  // namespace
+
+namespace gdjs {
+
+ProjectExportOverlay::ProjectExportOverlay(const gd::Project &project)
+    : resourcesContainer(project.GetResourcesManager()),
+      loadingScreen(project.GetLoadingScreen()),
+      watermark(project.GetWatermark()),
+      authorIds(project.GetAuthorIds()),
+      authorUsernames(project.GetAuthorUsernames()) {}
+
+void ProjectExportOverlay::AddDirectFontFileReferencesResources() {
+  for (const auto &it : directFileReferencesNewFilename) {
+    const gd::String &reference = it.first;
+    const gd::String &newFilename = it.second;
+    if (resourcesContainer.HasResource(reference) ||
+        !resourcesContainer.HasResource(newFilename))
+      continue;
+
+    const gd::Resource &resource = resourcesContainer.GetResource(newFilename);
+    if (resource.GetKind() != "font") continue;
+
+    resourcesContainer.AddResource(reference, resource.GetFile(), "font");
+  }
+}
+
+void ProjectExportOverlay::SerializeTo(
+    gd::SerializerElement &projectElement) const {
+  gd::SerializerElement &propertiesElement =
+      projectElement.GetChild("properties");
+
+  gd::SerializerElement &loadingScreenElement =
+      propertiesElement.GetChild("loadingScreen");
+  loadingScreenElement = gd::SerializerElement();
+  loadingScreen.SerializeTo(loadingScreenElement);
+
+  gd::SerializerElement &watermarkElement =
+      propertiesElement.GetChild("watermark");
+  watermarkElement = gd::SerializerElement();
+  watermark.SerializeTo(watermarkElement);
+
+  SerializeStringsTo(authorIds, propertiesElement.GetChild("authorIds"));
+  SerializeStringsTo(authorUsernames,
+                     propertiesElement.GetChild("authorUsernames"));
+
+  gd::SerializerElement &resourcesElement = projectElement.GetChild("resources");
+  resourcesElement = gd::SerializerElement();
+  resourcesContainer.SerializeTo(resourcesElement);
+}
+
+}  // namespace gdjs
@@ -0,0 +1,107 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "GDCore/Project/LoadingScreen.h"
+#include "GDCore/Project/ResourcesContainer.h"
+#include "GDCore/Project/Watermark.h"
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class SerializerElement;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief The parts of a project which are changed to export it: the resources
+ * (with their exported filenames), the loading screen, the watermark and the
+ * authors.
+ *
+ * These parts are copied from the project, so that a project can be exported
+ * without being modified or entirely copied: the exported project data is the
+ * stripped serialization of the project (see
+ * gd::ProjectStripper::SerializeProjectForExport) where these parts are
+ * replaced by the ones of the overlay.
+ *
+ * \see ExporterHelper::ExportProjectForPixiPreview
+ */
+class ProjectExportOverlay {
+ public:
+  /**
+   * \brief Create an overlay with the parts of the project that are changed by
+   * exports.
+   */
+  ProjectExportOverlay(const gd::Project &project);
+  virtual ~ProjectExportOverlay(){};
+
+  /**
+   * \brief Return the resources to be exported.
+   */
+  gd::ResourcesContainer &GetResourcesManager() { return resourcesContainer; }
+
+  /**
+   * \brief Return the loading screen to be exported.
+   */
+  gd::LoadingScreen &GetLoadingScreen() { return loadingScreen; }
+
+  /**
+   * \brief Return the watermark to be exported.
+   */
+  gd::Watermark &GetWatermark() { return watermark; }
+
+  /**
+   * \brief Return the author ids to be exported.
+   */
+  std::vector<gd::String> &GetAuthorIds() { return authorIds; }
+
+  /**
+   * \brief Return the author usernames to be exported.
+   */
+  std::vector<gd::String> &GetAuthorUsernames() { return authorUsernames; }
+
+  /**
+   * \brief Return the new filenames of the files referred directly by objects
+   * and events (instead of with a resource), by their original reference.
+   *
+   * \see gd::ResourcesMergingHelper::KeepDirectFileReferences
+   */
+  std::map<gd::String, gd::String> &GetDirectFileReferencesNewFilename() {
+    return directFileReferencesNewFilename;
+  }
+
+  /**
+   * \brief Add a font resource named like each font file referred directly by
+   * objects and events, when a font resource was added for its new filename
+   * (see ExporterHelper::AddDeprecatedFontFilesToFontResources).
+   *
+   * The references are not changed in the exported project, so they must
+   * find the font with their original name.
+   */
+  void AddDirectFontFileReferencesResources();
+
+  /**
+   * \brief Replace, in a serialized project, the parts changed by the export
+   * by the ones of the overlay.
+   */
+  void SerializeTo(gd::SerializerElement &projectElement) const;
+
+ private:
+  gd::ResourcesContainer resourcesContainer;
+  gd::LoadingScreen loadingScreen;
+  gd::Watermark watermark;
+  std::vector<gd::String> authorIds;
+  std::vector<gd::String> authorUsernames;
+  std::map<gd::String, gd::String>
+      directFileReferencesNewFilename;  ///< The new filenames of the files
+                                        ///< referred directly by objects and
+                                        ///< events, by their reference.
+};
+
+}  // namespace gdjs
@@ -0,0 +1,152 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the cache of the code generated for scenes.
+ */
+#include "GDJS/IDE/EventsCodeCache.h"
+
+#include <thread>
+#include <vector>
+
+#include "ExportTestsUtils.h"
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDJS/IDE/ExporterHelper.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * Export the code of the scenes and return the files that were written.
+ */
+std::vector<gd::String> ExportScenesEventsCode(
+    InMemoryFileSystem &fs,
+    const gd::Project &project,
+    bool exportForPreview,
+    std::vector<gd::String> &includesFiles,
+    const gd::String &outputDir = "/export/code") {
+  fs.writtenFiles.clear();
+  includesFiles.clear();
+  gdjs::ExporterHelper helper(fs, "/gdjs-root", outputDir);
+  gd::WholeProjectDiagnosticReport diagnosticReport;
+  REQUIRE(helper.ExportScenesEventsCode(
+      project, outputDir, includesFiles, diagnosticReport, exportForPreview));
+
+  return fs.writtenFiles;
+}
+
+}  // namespace
+
+TEST_CASE("EventsCodeCache", "[common]") {
+  gdjs::EventsCodeCache::Get().Clear();
+
+  gd::Project project;
+  SetupProjectWithScenes(project, 2);
+  InMemoryFileSystem fs;
+  std::vector<gd::String> includesFiles;
+  const gd::String code0 = "/export/code/code0.js";
+  const gd::String code1 = "/export/code/code1.js";
+  const std::vector<gd::String> allCodeFiles = {code0, code1};
+
+  REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles) ==
+          allCodeFiles);
+  const auto firstFiles = fs.files;
+  const auto firstIncludesFiles = includesFiles;
+  REQUIRE(firstFiles.at(code0).find("runtimeScene.getScene().getVariables()") !=
+          gd::String::npos);
+
+  SECTION("Unchanged scenes are not generated again") {
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles).empty());
+    REQUIRE(includesFiles == firstIncludesFiles);
+    REQUIRE(fs.files == firstFiles);
+  }
+
+  SECTION("Scenes missing from the output are generated again") {
+    fs.files.erase(code1);
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles) ==
+            std::vector<gd::String>{code1});
+    REQUIRE(fs.files == firstFiles);
+  }
+
+  SECTION("Changed scenes are generated again") {
+    AddSetVariableEvent(project.GetLayout(1).GetEvents(), "MyVariable", "3");
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles) ==
+            std::vector<gd::String>{code1});
+    REQUIRE(fs.files.at(code0) == firstFiles.at(code0));
+    REQUIRE(fs.files.at(code1) != firstFiles.at(code1));
+
+    project.GetLayout(0).GetVariables().InsertNew("MyOtherVariable");
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles) ==
+            std::vector<gd::String>{code0});
+  }
+
+  SECTION("Scenes are generated again when what they use changed") {
+    project.GetVariables().InsertNew("MyOtherGlobalVariable");
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles) ==
+            allCodeFiles);
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles).empty());
+
+    AddSetVariableEvent(
+        project.GetExternalEvents("MyExternalEvents").GetEvents(),
+        "MyGlobalVariable",
+        "4");
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles) ==
+            allCodeFiles);
+    REQUIRE(fs.files.at(code0) != firstFiles.at(code0));
+
+    project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles) ==
+            allCodeFiles);
+  }
+
+  SECTION("Exports of games don't use the cache") {
+    REQUIRE(gdjs::EventsCodeCache::ComputeProjectHash(project, true) !=
+            gdjs::EventsCodeCache::ComputeProjectHash(project, false));
+
+    REQUIRE(ExportScenesEventsCode(fs, project, false, includesFiles) ==
+            allCodeFiles);
+    REQUIRE(ExportScenesEventsCode(fs, project, false, includesFiles) ==
+            allCodeFiles);
+
+    // The files were overwritten by the code for the game, so the code for
+    // the preview is generated again.
+    REQUIRE(ExportScenesEventsCode(fs, project, true, includesFiles) ==
+            allCodeFiles);
+    REQUIRE(fs.files == firstFiles);
+  }
+
+  SECTION("Several exports at the same time") {
+    std::vector<InMemoryFileSystem> fileSystems(4);
+    std::vector<int> failuresCounts(fileSystems.size(), 0);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < fileSystems.size(); ++i) {
+      // Assertions are only done in the main thread.
+      threads.emplace_back([&, i]() {
+        const gd::String outputDir = "/export/code" + gd::String::From(i);
+        for (std::size_t j = 0; j < 3; ++j) {
+          fileSystems[i].writtenFiles.clear();
+          std::vector<gd::String> threadIncludesFiles;
+          gdjs::ExporterHelper helper(fileSystems[i], "/gdjs-root", outputDir);
+          gd::WholeProjectDiagnosticReport diagnosticReport;
+          if (!helper.ExportScenesEventsCode(project,
+                                             outputDir,
+                                             threadIncludesFiles,
+                                             diagnosticReport,
+                                             true))
+            failuresCounts[i]++;
+        }
+      });
+    }
+    for (auto &thread : threads) thread.join();
+
+    for (std::size_t i = 0; i < fileSystems.size(); ++i) {
+      REQUIRE(failuresCounts[i] == 0);
+      // The last export skipped the scenes generated by the first one.
+      REQUIRE(fileSystems[i].writtenFiles.empty());
+      REQUIRE(fileSystems[i].files.size() == 2);
+    }
+  }
+}
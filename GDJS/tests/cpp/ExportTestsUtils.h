@@ -0,0 +1,139 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/String.h"
+#include "GDJS/Extensions/JsPlatform.h"
+
+/**
+ * \brief A file system keeping the files in memory, and remembering the
+ * files written to it.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  InMemoryFileSystem(){};
+  virtual ~InMemoryFileSystem(){};
+
+  virtual void MkDir(const gd::String& path) {}
+  virtual bool DirExists(const gd::String& path) { return true; }
+  virtual bool FileExists(const gd::String& path) {
+    return files.find(path) != files.end();
+  }
+  virtual bool ClearDir(const gd::String& directory) {
+    for (auto it = files.begin(); it != files.end();) {
+      if (it->first.find(directory + "/") == 0)
+        it = files.erase(it);
+      else
+        ++it;
+    }
+    return true;
+  }
+  virtual gd::String GetTempDir() { return "/tmp"; }
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    std::size_t position = file.rfind("/");
+    return position == gd::String::npos ? file : file.substr(position + 1);
+  }
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    std::size_t position = file.rfind("/");
+    return position == gd::String::npos ? "" : file.substr(0, position);
+  }
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  }
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (filename.find(baseDirectory + "/") != 0) return false;
+
+    filename = filename.substr(baseDirectory.size() + 1);
+    return true;
+  }
+  virtual bool CopyFile(const gd::String& file,
+                        const gd::String& destination) {
+    files[destination] = files[file];
+    return true;
+  }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    files[file] = content;
+    writtenFiles.push_back(file);
+    return true;
+  }
+  virtual gd::String ReadFile(const gd::String& file) {
+    auto it = files.find(file);
+    return it != files.end() ? it->second : "";
+  }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    return {};
+  }
+
+  std::map<gd::String, gd::String> files;
+  std::vector<gd::String> writtenFiles;  ///< In the order of the writes.
+};
+
+/**
+ * \brief Add an event setting a variable to a value.
+ */
+inline void AddSetVariableEvent(gd::EventsList& events,
+                                const gd::String& variableName,
+                                const gd::String& value) {
+  gd::Instruction action;
+  action.SetType("SetNumberVariable");
+  action.SetParametersCount(3);
+  action.SetParameter(0, gd::Expression(variableName));
+  action.SetParameter(1, gd::Expression("="));
+  action.SetParameter(2, gd::Expression(value));
+
+  gd::StandardEvent event;
+  event.SetType("BuiltinCommonInstructions::Standard");
+  event.GetActions().Insert(action);
+  events.InsertEvent(event);
+}
+
+/**
+ * \brief Set up a project using the JS platform, with scenes having events
+ * and including the same external events.
+ */
+inline void SetupProjectWithScenes(gd::Project& project,
+                                   std::size_t scenesCount) {
+  project.AddPlatform(gdjs::JsPlatform::Get());
+  project.GetVariables().InsertNew("MyGlobalVariable").SetValue(1);
+
+  gd::ExternalEvents& externalEvents =
+      project.InsertNewExternalEvents("MyExternalEvents", 0);
+  AddSetVariableEvent(
+      externalEvents.GetEvents(), "MyGlobalVariable", "MyGlobalVariable + 1");
+
+  for (std::size_t i = 0; i < scenesCount; ++i) {
+    gd::Layout& layout = project.InsertNewLayout(
+        "Scene" + gd::String::From(i), project.GetLayoutsCount());
+    layout.GetVariables().InsertNew("MyVariable").SetValue(i);
+    AddSetVariableEvent(
+        layout.GetEvents(), "MyVariable", "MyVariable * 2 + MyGlobalVariable");
+
+    gd::LinkEvent linkEvent;
+    linkEvent.SetType("BuiltinCommonInstructions::Link");
+    linkEvent.SetTarget("MyExternalEvents");
+    layout.GetEvents().InsertEvent(linkEvent);
+  }
+}
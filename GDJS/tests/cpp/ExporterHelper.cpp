@@ -0,0 +1,54 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the export of the code of scenes.
+ */
+#include "GDJS/IDE/ExporterHelper.h"
+
+#include <vector>
+
+#include "ExportTestsUtils.h"
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "catch.hpp"
+
+TEST_CASE("ExporterHelper", "[common]") {
+  SECTION("Scenes code generated in parallel is the same as in serial") {
+    gd::Project project;
+    SetupProjectWithScenes(project, 7);
+
+    auto exportScenesEventsCode = [&](std::size_t threadsCount,
+                                      InMemoryFileSystem &fs,
+                                      std::vector<gd::String> &includesFiles) {
+      gdjs::ExporterHelper helper(fs, "/gdjs-root", "/export/code");
+      helper.SetCodeGenerationThreadsCount(threadsCount);
+      gd::WholeProjectDiagnosticReport diagnosticReport;
+      REQUIRE(helper.ExportScenesEventsCode(
+          project, "/export/code", includesFiles, diagnosticReport, false));
+    };
+
+    InMemoryFileSystem serialFs;
+    std::vector<gd::String> serialIncludesFiles;
+    exportScenesEventsCode(1, serialFs, serialIncludesFiles);
+    REQUIRE(serialFs.files.size() == 7);
+    // The external events are generated in each scene.
+    REQUIRE(serialFs.files.at("/export/code/code6.js")
+                .find("runtimeScene.getGame().getVariables()") !=
+            gd::String::npos);
+
+    for (std::size_t threadsCount : {2, 4, 16}) {
+      InMemoryFileSystem parallelFs;
+      std::vector<gd::String> parallelIncludesFiles;
+      exportScenesEventsCode(threadsCount, parallelFs, parallelIncludesFiles);
+
+      REQUIRE(parallelIncludesFiles == serialIncludesFiles);
+      REQUIRE(parallelFs.files.size() == serialFs.files.size());
+      for (const auto &file : serialFs.files) {
+        INFO(file.first);
+        REQUIRE(parallelFs.files.at(file.first).Raw() == file.second.Raw());
+      }
+    }
+  }
+}
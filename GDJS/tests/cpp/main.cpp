@@ -0,0 +1,13 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Main file for the native tests of GDevelop JS Platform (what can't be
+ * tested from GDevelop.js, like exports using threads).
+ *
+ * Please write any new test in a separate file.
+ */
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
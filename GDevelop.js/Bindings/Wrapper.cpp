@@ -39,6 +39,7 @@
 #include <GDCore/IDE/Events/EventsTypesLister.h>
 #include <GDCore/IDE/Events/EventsVariablesFinder.h>
 #include <GDCore/IDE/Events/ExpressionCompletionFinder.h>
+#include <GDCore/IDE/Events/ExpressionCompletionSession.h>
 #include <GDCore/IDE/Events/ExpressionNodeLocationFinder.h>
 #include <GDCore/IDE/Events/ExpressionTypeFinder.h>
 #include <GDCore/IDE/Events/ExpressionValidator.h>
@@ -62,6 +63,7 @@
 #include <GDCore/IDE/Project/ResourcesRenamer.h>
 #include <GDCore/IDE/Project/EventsBasedObjectDependencyFinder.h>
 #include <GDCore/IDE/ProjectBrowserHelper.h>
+#include <GDCore/IDE/ProjectSnapshot.h>
 #include <GDCore/IDE/PropertyFunctionGenerator.h>
 #include <GDCore/IDE/UnfilledRequiredBehaviorPropertyProblem.h>
 #include <GDCore/IDE/VariableInstructionSwitcher.h>
@@ -77,6 +79,7 @@
 #include <GDCore/Project/ExternalLayout.h>
 #include <GDCore/Project/InitialInstance.h>
 #include <GDCore/Project/InitialInstancesContainer.h>
+#include <GDCore/Project/InitialInstancesSpatialIndex.h>
 #include <GDCore/Project/Layout.h>
 #include <GDCore/Project/LayersContainer.h>
 #include <GDCore/Project/MeasurementBaseUnit.h>
@@ -97,6 +100,7 @@
 #include <GDCore/Project/VariablesContainer.h>
 #include <GDCore/Project/VariablesContainersList.h>
 #include <GDCore/Project/QuickCustomization.h>
+#include <GDCore/Serialization/BinarySerializer.h>
 #include <GDCore/Serialization/Serializer.h>
 #include <GDCore/Serialization/SerializerElement.h>
 #include <GDCore/IDE/ObjectAssetSerializer.h>
@@ -377,6 +381,47 @@ class InitialInstanceJSFunctorWrapper : public gd::InitialInstanceFunctor {
   virtual void invoke(gd::InitialInstance *instance){};
 };
 
+/**
+ * \brief Hold the binary representation of an element (see
+ * gd::BinarySerializer), so that JavaScript can read or write it directly in
+ * the WASM memory, instead of going through each element with the bindings.
+ *
+ * \see gd.Serializer.toJSObject and gd.Serializer.fromJSObject in postjs.js.
+ */
+class SerializerElementBinaryBuffer {
+ public:
+  SerializerElementBinaryBuffer(){};
+
+  void Serialize(const gd::SerializerElement &element) {
+    buffer = gd::BinarySerializer::ToBinary(element);
+  }
+
+  void UnserializeInto(gd::SerializerElement &element) const {
+    gd::BinarySerializedElement(buffer.data(), buffer.size())
+        .UnserializeInto(element);
+  }
+
+  /**
+   * \brief Resize the buffer, to write the binary representation of an element
+   * in it, and return the address of the data.
+   */
+  size_t Resize(size_t size) {
+    buffer.resize(size);
+    return GetData();
+  }
+
+  /**
+   * \brief Free the memory used by the buffer.
+   */
+  void Clear() { std::string().swap(buffer); }
+
+  size_t GetData() const { return reinterpret_cast<size_t>(buffer.data()); }
+  size_t GetSize() const { return buffer.size(); }
+
+ private:
+  std::string buffer;
+};
+
 // Implement some std::vector<*> erase methods as free functions as there is no
 // easy way to properly expose the erase method :'(
 void removeFromVectorPolygon2d(std::vector<Polygon2d> &vec, size_t pos) {
@@ -549,6 +594,7 @@ typedef std::vector<gd::PropertyDescriptorChoice> VectorPropertyDescriptorChoice
 #define STATIC_GetSafeName GetSafeName
 #define STATIC_ToJSON ToJSON
 #define STATIC_FromJSON(x) FromJSON(x)
+#define STATIC_FromJSONUsingDocument(x) FromJSONUsingDocument(x)
 #define STATIC_SerializeTo SerializeTo
 #define STATIC_IsObject IsObject
 #define STATIC_IsBehavior IsBehavior
@@ -740,6 +786,7 @@ typedef std::vector<gd::PropertyDescriptorChoice> VectorPropertyDescriptorChoice
   ApplyRefactoringForGroupVariablesContainer
 #define STATIC_ComputeChangesetForVariablesContainer \
   ComputeChangesetForVariablesContainer
+#define STATIC_ComputeVariablesChangeset ComputeVariablesChangeset
 #define STATIC_MergeVariableContainers MergeVariableContainers
 #define STATIC_FillAnyVariableBetweenObjects FillAnyVariableBetweenObjects
 #define STATIC_ApplyChangesToVariants ApplyChangesToVariants
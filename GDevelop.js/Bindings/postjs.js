@@ -177,8 +177,8 @@ var adaptNamingConventions = function (gd) {
     return arr;
   };
 
-  // Add gd.Serializer.fromJSObject which is much faster than manually parsing
-  // JSON with gd.Serializer.fromJSON.
+  // Add gd.Serializer.fromJSObjectElementByElement which is much faster than
+  // manually parsing JSON with gd.Serializer.fromJSON.
   const elementFromJSObject = function (object, element) {
     if (typeof object === 'number') {
       element.setDoubleValue(object);
@@ -202,7 +202,7 @@ var adaptNamingConventions = function (gd) {
     }
   };
 
-  gd.Serializer.fromJSObject = function (object) {
+  gd.Serializer.fromJSObjectElementByElement = function (object) {
     var element = new gd.SerializerElement();
     elementFromJSObject(object, element);
 
@@ -221,7 +221,7 @@ var adaptNamingConventions = function (gd) {
     return null;
   };
 
-  gd.Serializer.toJSObject = function (element) {
+  gd.Serializer.toJSObjectElementByElement = function (element) {
     if (!element.isValueUndefined()) {
       return valueToJSObject(element.getValue());
     } else if (element.consideredAsArray()) {
@@ -235,7 +235,7 @@ var adaptNamingConventions = function (gd) {
           i
         );
         const serializerElement = sharedPtrSerializerElement.get();
-        array.push(gd.Serializer.toJSObject(serializerElement));
+        array.push(gd.Serializer.toJSObjectElementByElement(serializerElement));
         sharedPtrSerializerElement.reset();
       }
 
@@ -249,7 +249,7 @@ var adaptNamingConventions = function (gd) {
       for (let i = 0; i < attributeNames.size(); ++i) {
         const name = attributeNames.at(i);
         const serializerValue = attributes.get(name);
-        object[name] = valueToJSObject(element.getValue());
+        object[name] = valueToJSObject(serializerValue);
       }
 
       const children = element.getAllChildren();
@@ -261,7 +261,9 @@ var adaptNamingConventions = function (gd) {
           i
         );
         const serializerElement = sharedPtrSerializerElement.get();
-        object[name] = gd.Serializer.toJSObject(serializerElement);
+        object[name] = gd.Serializer.toJSObjectElementByElement(
+          serializerElement
+        );
         sharedPtrSerializerElement.reset();
       }
       return object;
@@ -269,6 +271,250 @@ var adaptNamingConventions = function (gd) {
     return null;
   };
 
+  // Add gd.Serializer.fromJSObject and gd.Serializer.toJSObject, which convert
+  // the whole tree of elements from/to its binary representation
+  // (see gd::BinarySerializer) in a single buffer of the WASM memory, instead
+  // of calling the bindings for each element, name and value.
+  const binaryFormatVersion = 1;
+  const binaryHeaderSize = 24;
+  const binaryValueTypes = {
+    undefined: 0,
+    unknown: 1,
+    boolean: 2,
+    string: 3,
+    int: 4,
+    double: 5,
+  };
+  const binaryIsArrayFlag = 1;
+
+  const getBinaryValueSize = function (type) {
+    switch (type) {
+      case binaryValueTypes.boolean:
+        return 1;
+      case binaryValueTypes.unknown:
+      case binaryValueTypes.string:
+      case binaryValueTypes.int:
+        return 4;
+      case binaryValueTypes.double:
+        return 8;
+      default:
+        return 0;
+    }
+  };
+
+  let binaryBuffer = null;
+  const getBinaryBuffer = function () {
+    if (!binaryBuffer) binaryBuffer = new gd.SerializerElementBinaryBuffer();
+    return binaryBuffer;
+  };
+
+  const binaryToJSObject = function (data, size) {
+    // The view is made after the binary representation is written, as the
+    // memory (and so HEAPU8) changes when it grows.
+    const view = new DataView(HEAPU8.buffer, data, size);
+    if (
+      size < binaryHeaderSize ||
+      view.getUint32(4, true) !== binaryFormatVersion
+    )
+      return null;
+
+    const stringsTableOffset = view.getUint32(12, true);
+    const strings = new Array(view.getUint32(16, true));
+    const readString = function (index) {
+      let string = strings[index];
+      if (string === undefined) {
+        // Strings are stored once, prefixed by their length.
+        const stringOffset = view.getUint32(
+          stringsTableOffset + index * 4,
+          true
+        );
+        string = UTF8ToString(
+          data + stringOffset + 4,
+          view.getUint32(stringOffset, true)
+        );
+        strings[index] = string;
+      }
+      return string;
+    };
+    const readValue = function (position) {
+      switch (view.getUint8(position)) {
+        case binaryValueTypes.boolean:
+          return view.getUint8(position + 1) !== 0;
+        case binaryValueTypes.string:
+          return readString(view.getUint32(position + 1, true));
+        case binaryValueTypes.int:
+          return view.getInt32(position + 1, true);
+        case binaryValueTypes.double:
+          return view.getFloat64(position + 1, true);
+        default:
+          return null;
+      }
+    };
+    const readElement = function (offset) {
+      const valueType = view.getUint8(offset);
+      if (valueType !== binaryValueTypes.undefined) return readValue(offset);
+
+      let position = offset + 1;
+      const isArray = (view.getUint8(position) & binaryIsArrayFlag) !== 0;
+      position += 1 + 4;
+
+      const result = isArray ? [] : {};
+      const attributesCount = view.getUint32(position, true);
+      position += 4;
+      for (let i = 0; i < attributesCount; ++i) {
+        if (!isArray) {
+          result[readString(view.getUint32(position, true))] = readValue(
+            position + 4
+          );
+        }
+        position += 5 + getBinaryValueSize(view.getUint8(position + 4));
+      }
+
+      const childrenCount = view.getUint32(position, true);
+      position += 4;
+      for (let i = 0; i < childrenCount; ++i) {
+        const child = readElement(view.getUint32(position + 4, true));
+        if (isArray) result.push(child);
+        else result[readString(view.getUint32(position, true))] = child;
+        position += 8;
+      }
+      return result;
+    };
+
+    return readElement(view.getUint32(8, true));
+  };
+
+  const jsObjectToBinary = function (object) {
+    let bytes = new Uint8Array(4096);
+    let view = new DataView(bytes.buffer);
+    let size = binaryHeaderSize;
+    const reserve = function (additionalSize) {
+      if (size + additionalSize <= bytes.length) return;
+
+      const newBytes = new Uint8Array(
+        Math.max(bytes.length * 2, size + additionalSize)
+      );
+      newBytes.set(bytes);
+      bytes = newBytes;
+      view = new DataView(bytes.buffer);
+    };
+    const writeUint8 = function (value) {
+      reserve(1);
+      view.setUint8(size, value);
+      size += 1;
+    };
+    const writeUint32 = function (value) {
+      reserve(4);
+      view.setUint32(size, value, true);
+      size += 4;
+    };
+
+    const strings = [];
+    const stringIndices = new Map();
+    const getStringIndex = function (string) {
+      let index = stringIndices.get(string);
+      if (index === undefined) {
+        index = strings.length;
+        strings.push(string);
+        stringIndices.set(string, index);
+      }
+      return index;
+    };
+
+    // Children are written before their parent, values are stored as
+    // gd.SerializerElement.setDoubleValue, setStringValue and setBoolValue do.
+    const writeElement = function (object) {
+      let childrenNames = null;
+      let childrenOffsets = null;
+      if (Array.isArray(object)) {
+        childrenOffsets = object.map(writeElement);
+      } else if (typeof object === 'object' && object !== null) {
+        childrenNames = [];
+        childrenOffsets = [];
+        for (const childName in object) {
+          if (object.hasOwnProperty(childName)) {
+            childrenNames.push(childName);
+            childrenOffsets.push(writeElement(object[childName]));
+          }
+        }
+      }
+
+      const offset = size;
+      if (typeof object === 'number') {
+        writeUint8(binaryValueTypes.double);
+        reserve(8);
+        view.setFloat64(size, object, true);
+        size += 8;
+      } else if (typeof object === 'string') {
+        writeUint8(binaryValueTypes.string);
+        writeUint32(getStringIndex(object));
+      } else if (typeof object === 'boolean') {
+        writeUint8(binaryValueTypes.boolean);
+        writeUint8(object ? 1 : 0);
+      } else {
+        writeUint8(binaryValueTypes.undefined);
+      }
+      writeUint8(Array.isArray(object) ? binaryIsArrayFlag : 0);
+      writeUint32(getStringIndex(''));
+      writeUint32(0); // No attributes.
+
+      const childrenCount = childrenOffsets ? childrenOffsets.length : 0;
+      writeUint32(childrenCount);
+      for (let i = 0; i < childrenCount; ++i) {
+        writeUint32(getStringIndex(childrenNames ? childrenNames[i] : ''));
+        writeUint32(childrenOffsets[i]);
+      }
+      return offset;
+    };
+    const rootOffset = writeElement(object);
+
+    // The strings table: the offsets of the strings, then the strings
+    // prefixed by their length and null-terminated.
+    const stringsTableOffset = size;
+    reserve(strings.length * 4);
+    size += strings.length * 4;
+    const textEncoder = new TextEncoder();
+    for (let i = 0; i < strings.length; ++i) {
+      const encodedString = textEncoder.encode(strings[i]);
+      view.setUint32(stringsTableOffset + i * 4, size, true);
+      writeUint32(encodedString.length);
+      reserve(encodedString.length);
+      bytes.set(encodedString, size);
+      size += encodedString.length;
+      writeUint8(0);
+    }
+
+    bytes.set([71, 68, 83, 69], 0); // "GDSE"
+    view.setUint32(4, binaryFormatVersion, true);
+    view.setUint32(8, rootOffset, true);
+    view.setUint32(12, stringsTableOffset, true);
+    view.setUint32(16, strings.length, true);
+    view.setUint32(20, size, true);
+    return bytes.subarray(0, size);
+  };
+
+  gd.Serializer.fromJSObject = function (object) {
+    const element = new gd.SerializerElement();
+    const bytes = jsObjectToBinary(object);
+
+    const buffer = getBinaryBuffer();
+    const data = buffer.resize(bytes.length);
+    HEAPU8.set(bytes, data);
+    buffer.unserializeInto(element);
+    buffer.clear();
+
+    return element;
+  };
+
+  gd.Serializer.toJSObject = function (element) {
+    const buffer = getBinaryBuffer();
+    buffer.serialize(element);
+    const object = binaryToJSObject(buffer.getData(), buffer.getSize());
+    buffer.clear();
+
+    return object;
+  };
+
   //Preserve backward compatibility with some alias for methods:
   gd.VectorString.prototype.get = gd.VectorString.prototype.at;
   gd.VectorPlatformExtension.prototype.get =
@@ -244,6 +244,58 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.ProjectSnapshot', function () {
+    it('shares unchanged parts and gives the changes', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      layout.resetPersistentUuid();
+      layout.getVariables().insertNew('MyVariable', 0);
+      layout.getVariables().insertNew('MyOtherVariable', 1);
+      layout.getVariables().resetPersistentUuid();
+      layout.getInitialInstances().insertNewInitialInstance();
+      layout.getInitialInstances().insertNewInitialInstance();
+
+      const serializedLayout = new gd.SerializerElement();
+      layout.serializeTo(serializedLayout);
+      const snapshot = new gd.ProjectSnapshot(project, null);
+      const unchangedSnapshot = new gd.ProjectSnapshot(project, snapshot);
+      expect(unchangedSnapshot.getSharedNodesCount(snapshot)).toBe(
+        snapshot.getNodesCount()
+      );
+      expect(
+        gd.ProjectSnapshot.computeVariablesChangeset(
+          snapshot.getLayout('Scene'),
+          unchangedSnapshot.getLayout('Scene')
+        ).hasRemovedVariables()
+      ).toBe(false);
+
+      layout.getVariables().remove('MyOtherVariable');
+      const modifiedSnapshot = new gd.ProjectSnapshot(project, snapshot);
+      expect(modifiedSnapshot.getSharedNodesCount(snapshot)).toBe(
+        snapshot.getNodesCount() - 1
+      );
+      expect(
+        gd.ProjectSnapshot.computeVariablesChangeset(
+          snapshot.getLayout('Scene'),
+          modifiedSnapshot.getLayout('Scene')
+        ).hasRemovedVariables()
+      ).toBe(true);
+
+      // The layout can be restored from the snapshot.
+      const restoredLayout = snapshot.getLayout('Scene').toSerializerElement();
+      expect(gd.Serializer.toJSON(restoredLayout)).toBe(
+        gd.Serializer.toJSON(serializedLayout)
+      );
+
+      restoredLayout.delete();
+      serializedLayout.delete();
+      modifiedSnapshot.delete();
+      unchangedSnapshot.delete();
+      snapshot.delete();
+      project.delete();
+    });
+  });
+
   describe('gd.Layer', function () {
     it('can have a name and visibility', function () {
       const layer = new gd.Layer();
@@ -746,6 +798,41 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.InitialInstancesSpatialIndex', function () {
+    it('finds instances in a rectangle', function () {
+      const container = new gd.InitialInstancesContainer();
+      const addInstance = (objectName, layer, x, y) => {
+        const instance = container.insertNewInitialInstance();
+        instance.setObjectName(objectName);
+        instance.setLayer(layer);
+        instance.setX(x);
+        instance.setY(y);
+      };
+      addInstance('MyObject1', '', 10, 10);
+      addInstance('MyObject2', '', 300, 20);
+      addInstance('MyObject3', '', 5000, 5000);
+      addInstance('MyObject4', 'OtherLayer', 10, 10);
+
+      const index = new gd.InitialInstancesSpatialIndex(256);
+      index.build(container);
+      expect(index.getLayerInstancesCount('')).toBe(3);
+      expect(index.getLayerInstancesCount('OtherLayer')).toBe(1);
+
+      const objectNames = [];
+      const functor = new gd.InitialInstanceJSFunctor();
+      functor.invoke = function (instance) {
+        instance = gd.wrapPointer(instance, gd.InitialInstance);
+        objectNames.push(instance.getObjectName());
+      };
+      index.iterateOverInstancesInRectangle(functor, '', 0, 0, 400, 100);
+      expect(objectNames.sort()).toEqual(['MyObject1', 'MyObject2']);
+
+      functor.delete();
+      index.delete();
+      container.delete();
+    });
+  });
+
   describe('gd.InitialInstance', function () {
     let project = null;
     let layout = null;
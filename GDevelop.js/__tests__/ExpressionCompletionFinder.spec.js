@@ -53,6 +53,27 @@ describe('gd.ExpressionCompletionFinder', function () {
       completionDescriptionAsStrings.push(completionDescription.toString());
     }
 
+    // A completion session must give the same completions.
+    const session = new gd.ExpressionCompletionSession(
+      gd.JsPlatform.get(),
+      projectScopedContainers,
+      type
+    );
+    const sessionCompletionDescriptions = session.getCompletionDescriptionsFor(
+      expression,
+      Math.max(0, caretPosition - 1)
+    );
+    const sessionCompletionDescriptionAsStrings = [];
+    for (let i = 0; i < sessionCompletionDescriptions.size(); i++) {
+      sessionCompletionDescriptionAsStrings.push(
+        sessionCompletionDescriptions.at(i).toString()
+      );
+    }
+    expect(sessionCompletionDescriptionAsStrings).toEqual(
+      completionDescriptionAsStrings
+    );
+
+    session.delete();
     parser.delete();
     eventsFunction.delete();
     return completionDescriptionAsStrings;
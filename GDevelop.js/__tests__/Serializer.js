@@ -140,5 +140,39 @@ describe('libGD.js object serialization', function() {
       checkJsonParseAndStringify('[{"a":1},2]');
       checkJsonParseAndStringify('{"7":[],"a":[1,2,{"b":3},{"c":[4,5]},6]}');
     });
+    it('should give the same results as element by element conversions', function() {
+      const json =
+        '{"a":[1,2.5,-3,{"b":true},{"c":[4,5]},"官话"],"d":false,"e":{},"7":[]}';
+      const object = JSON.parse(json);
+
+      const element = gd.Serializer.fromJSObject(object);
+      const elementByElement = gd.Serializer.fromJSObjectElementByElement(
+        object
+      );
+      expect(gd.Serializer.toJSON(element)).toBe(
+        gd.Serializer.toJSON(elementByElement)
+      );
+      expect(gd.Serializer.toJSObject(element)).toEqual(
+        gd.Serializer.toJSObjectElementByElement(elementByElement)
+      );
+      element.delete();
+      elementByElement.delete();
+    });
+    it('should convert values stored as attributes, like JSON does', function() {
+      const obj = new gd.TextObject('testObject');
+      obj.setText('Text of the object, with 官话 characters');
+
+      const serializedObject = new gd.SerializerElement();
+      obj.serializeTo(serializedObject);
+      const expectedObject = JSON.parse(gd.Serializer.toJSON(serializedObject));
+      expect(gd.Serializer.toJSObject(serializedObject)).toEqual(
+        expectedObject
+      );
+      expect(
+        gd.Serializer.toJSObjectElementByElement(serializedObject)
+      ).toEqual(expectedObject);
+      serializedObject.delete();
+      obj.delete();
+    });
   });
 });
@@ -29,8 +29,14 @@ describe.skip('gd.Serializer benchmarks', function () {
       .add('fromJSON', () => {
         gd.Serializer.fromJSON(json);
       })
+      .add('fromJSONUsingDocument', () => {
+        gd.Serializer.fromJSONUsingDocument(json);
+      })
       .add('JSON.parse + fromJSObject', () => {
         gd.Serializer.fromJSObject(JSON.parse(json));
+      })
+      .add('JSON.parse + fromJSObjectElementByElement', () => {
+        gd.Serializer.fromJSObjectElementByElement(JSON.parse(json));
       });
 
     console.log(benchmarkSuite.run());
@@ -47,6 +53,9 @@ describe.skip('gd.Serializer benchmarks', function () {
       })
       .add('fromJSObject', () => {
         gd.Serializer.fromJSObject(jsObject);
+      })
+      .add('fromJSObjectElementByElement', () => {
+        gd.Serializer.fromJSObjectElementByElement(jsObject);
       });
 
     console.log(benchmarkSuite.run());
@@ -64,6 +73,11 @@ describe.skip('gd.Serializer benchmarks', function () {
       })
       .add('toJSObject + JSON.stringify', () => {
         var outputJson = JSON.stringify(gd.Serializer.toJSObject(element));
+      })
+      .add('toJSObjectElementByElement + JSON.stringify', () => {
+        var outputJson = JSON.stringify(
+          gd.Serializer.toJSObjectElementByElement(element)
+        );
       });
 
     console.log(benchmarkSuite.run());
@@ -81,6 +95,9 @@ describe.skip('gd.Serializer benchmarks', function () {
       })
       .add('toJSObject', () => {
         gd.Serializer.toJSObject(element);
+      })
+      .add('toJSObjectElementByElement', () => {
+        gd.Serializer.toJSObjectElementByElement(element);
       });
 
     console.log(benchmarkSuite.run());
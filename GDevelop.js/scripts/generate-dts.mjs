@@ -83,6 +83,8 @@ const extraClassAttributes = {
   Serializer: [
     'static fromJSObject(object: Object): gdSerializerElement;',
     'static toJSObject(element: gdSerializerElement): any;',
+    'static fromJSObjectElementByElement(object: Object): gdSerializerElement;',
+    'static toJSObjectElementByElement(element: gdSerializerElement): any;',
   ],
 };
 
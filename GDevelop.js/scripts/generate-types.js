@@ -347,6 +347,8 @@ type CustomObjectConfiguration_EdgeAnchor = 0 | 1 | 2 | 3 | 4`
       `declare class gdSerializer {
   static fromJSObject(object: Object): gdSerializerElement;
   static toJSObject(element: gdSerializerElement): any;
+  static fromJSObjectElementByElement(object: Object): gdSerializerElement;
+  static toJSObjectElementByElement(element: gdSerializerElement): any;
 `,
       'types/gdserializer.js'
     );
@@ -497,6 +499,13 @@ type CustomObjectConfiguration_EdgeAnchor = 0 | 1 | 2 | 3 | 4`
       'type: string, description: string, optionalObjectType?: string, parameterIsOptional?: boolean',
       'types/gdmultipleinstructionmetadata.js'
     );
+    // Passing null is also tolerated for pointers:
+    shell.sed(
+      '-i',
+      'previousSnapshot: gdProjectSnapshot',
+      'previousSnapshot: gdProjectSnapshot | null',
+      'types/gdprojectsnapshot.js'
+    );
 
     // Add a notice that the file is auto-generated.
     shell.sed(
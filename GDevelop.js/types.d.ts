@@ -812,6 +812,9 @@ export class Layout extends EmscriptenObject {
   getBackgroundColorBlue(): number;
   setWindowDefaultTitle(name: string): void;
   getWindowDefaultTitle(): string;
+  resetPersistentUuid(): Layout;
+  clearPersistentUuid(): Layout;
+  getPersistentUuid(): string;
   getInitialInstances(): InitialInstancesContainer;
   getVariables(): VariablesContainer;
   getObjects(): ObjectsContainer;
@@ -1253,6 +1256,14 @@ export class InitialInstancesContainer extends EmscriptenObject {
   unserializeFrom(element: SerializerElement): void;
 }
 
+export class InitialInstancesSpatialIndex extends EmscriptenObject {
+  constructor(cellSize: number);
+  build(instances: InitialInstancesContainer): void;
+  clear(): void;
+  getLayerInstancesCount(layerName: string): number;
+  iterateOverInstancesInRectangle(func: InitialInstanceFunctor, layerName: string, left: number, top: number, right: number, bottom: number): void;
+}
+
 export class HighestZOrderFinder extends EmscriptenObject {
   constructor();
   restrictSearchToLayer(layer: string): void;
@@ -1321,8 +1332,21 @@ export class SharedPtrSerializerElement extends EmscriptenObject {
 export class Serializer extends EmscriptenObject {
   static toJSON(element: SerializerElement): string;
   static fromJSON(json: string): SerializerElement;
+  static fromJSONUsingDocument(json: string): SerializerElement;
   static fromJSObject(object: Object): gdSerializerElement;
   static toJSObject(element: gdSerializerElement): any;
+  static fromJSObjectElementByElement(object: Object): gdSerializerElement;
+  static toJSObjectElementByElement(element: gdSerializerElement): any;
+}
+
+export class SerializerElementBinaryBuffer extends EmscriptenObject {
+  constructor();
+  serialize(element: SerializerElement): void;
+  unserializeInto(element: SerializerElement): void;
+  resize(size: number): number;
+  clear(): void;
+  getData(): number;
+  getSize(): number;
 }
 
 export class ObjectAssetSerializer extends EmscriptenObject {
@@ -2066,6 +2090,24 @@ export class WholeProjectRefactorer extends EmscriptenObject {
   static updateBehaviorsSharedData(project: Project): void;
 }
 
+export class ProjectSnapshotElement extends EmscriptenObject {
+  getKey(): string;
+  getName(): string;
+  toSerializerElement(): SerializerElement;
+  getNodesCount(): number;
+}
+
+export class ProjectSnapshot extends EmscriptenObject {
+  constructor(project: Project, previousSnapshot: ProjectSnapshot);
+  getGlobalObjectsAndVariables(): ProjectSnapshotElement;
+  getLayout(name: string): ProjectSnapshotElement;
+  getExternalEvents(name: string): ProjectSnapshotElement;
+  getExternalLayout(name: string): ProjectSnapshotElement;
+  getNodesCount(): number;
+  getSharedNodesCount(other: ProjectSnapshot): number;
+  static computeVariablesChangeset(oldElement: ProjectSnapshotElement, newElement: ProjectSnapshotElement): VariablesChangeset;
+}
+
 export class BehaviorParameterFiller extends EmscriptenObject {
   static fillBehaviorParameters(platform: Platform, projectScopedContainers: ProjectScopedContainers, instructionMetadata: InstructionMetadata, instruction: Instruction): boolean;
 }
@@ -2235,6 +2277,12 @@ export class ExpressionCompletionFinder extends EmscriptenObject {
   getCompletionDescriptions(): VectorExpressionCompletionDescription;
 }
 
+export class ExpressionCompletionSession extends EmscriptenObject {
+  constructor(platform: Platform, projectScopedContainers: ProjectScopedContainers, rootType: string);
+  getCompletionDescriptionsFor(expression: string, location: number): VectorExpressionCompletionDescription;
+  invalidateIdentifiersIndex(): void;
+}
+
 export class ExpressionNodeLocationFinder extends EmscriptenObject {
   static getNodeAtPosition(node: ExpressionNode, searchedPosition: number): ExpressionNode;
 }
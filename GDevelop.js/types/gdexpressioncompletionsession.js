@@ -0,0 +1,8 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdExpressionCompletionSession {
+  constructor(platform: gdPlatform, projectScopedContainers: gdProjectScopedContainers, rootType: string): void;
+  getCompletionDescriptionsFor(expression: string, location: number): gdVectorExpressionCompletionDescription;
+  invalidateIdentifiersIndex(): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdInitialInstancesSpatialIndex {
+  constructor(cellSize: number): void;
+  build(instances: gdInitialInstancesContainer): void;
+  clear(): void;
+  getLayerInstancesCount(layerName: string): number;
+  iterateOverInstancesInRectangle(func: gdInitialInstanceFunctor, layerName: string, left: number, top: number, right: number, bottom: number): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -9,6 +9,9 @@ declare class gdLayout {
   getBackgroundColorBlue(): number;
   setWindowDefaultTitle(name: string): void;
   getWindowDefaultTitle(): string;
+  resetPersistentUuid(): gdLayout;
+  clearPersistentUuid(): gdLayout;
+  getPersistentUuid(): string;
   getInitialInstances(): gdInitialInstancesContainer;
   getVariables(): gdVariablesContainer;
   getObjects(): gdObjectsContainer;
@@ -0,0 +1,13 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdProjectSnapshot {
+  constructor(project: gdProject, previousSnapshot: gdProjectSnapshot | null): void;
+  getGlobalObjectsAndVariables(): gdProjectSnapshotElement;
+  getLayout(name: string): gdProjectSnapshotElement;
+  getExternalEvents(name: string): gdProjectSnapshotElement;
+  getExternalLayout(name: string): gdProjectSnapshotElement;
+  getNodesCount(): number;
+  getSharedNodesCount(other: gdProjectSnapshot): number;
+  static computeVariablesChangeset(oldElement: gdProjectSnapshotElement, newElement: gdProjectSnapshotElement): gdVariablesChangeset;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
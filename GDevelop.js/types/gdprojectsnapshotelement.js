@@ -0,0 +1,9 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdProjectSnapshotElement {
+  getKey(): string;
+  getName(): string;
+  toSerializerElement(): gdSerializerElement;
+  getNodesCount(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -2,9 +2,12 @@
 declare class gdSerializer {
   static fromJSObject(object: Object): gdSerializerElement;
   static toJSObject(element: gdSerializerElement): any;
+  static fromJSObjectElementByElement(object: Object): gdSerializerElement;
+  static toJSObjectElementByElement(element: gdSerializerElement): any;
 
   static toJSON(element: gdSerializerElement): string;
   static fromJSON(json: string): gdSerializerElement;
+  static fromJSONUsingDocument(json: string): gdSerializerElement;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
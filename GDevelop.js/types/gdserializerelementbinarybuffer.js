@@ -0,0 +1,12 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdSerializerElementBinaryBuffer {
+  constructor(): void;
+  serialize(element: gdSerializerElement): void;
+  unserializeInto(element: gdSerializerElement): void;
+  resize(size: number): number;
+  clear(): void;
+  getData(): number;
+  getSize(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
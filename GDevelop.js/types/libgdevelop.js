@@ -133,6 +133,7 @@ declare class libGDevelop {
   JavaScriptResource: Class<gdJavaScriptResource>;
   InitialInstance: Class<gdInitialInstance>;
   InitialInstancesContainer: Class<gdInitialInstancesContainer>;
+  InitialInstancesSpatialIndex: Class<gdInitialInstancesSpatialIndex>;
   HighestZOrderFinder: Class<gdHighestZOrderFinder>;
   InitialInstanceFunctor: Class<gdInitialInstanceFunctor>;
   InitialInstanceJSFunctorWrapper: Class<gdInitialInstanceJSFunctorWrapper>;
@@ -141,6 +142,7 @@ declare class libGDevelop {
   SerializerElement: Class<gdSerializerElement>;
   SharedPtrSerializerElement: Class<gdSharedPtrSerializerElement>;
   Serializer: Class<gdSerializer>;
+  SerializerElementBinaryBuffer: Class<gdSerializerElementBinaryBuffer>;
   ObjectAssetSerializer: Class<gdObjectAssetSerializer>;
   InstructionsList: Class<gdInstructionsList>;
   Instruction: Class<gdInstruction>;
@@ -191,6 +193,8 @@ declare class libGDevelop {
   ResourceExposer: Class<gdResourceExposer>;
   VariablesChangeset: Class<gdVariablesChangeset>;
   WholeProjectRefactorer: Class<gdWholeProjectRefactorer>;
+  ProjectSnapshotElement: Class<gdProjectSnapshotElement>;
+  ProjectSnapshot: Class<gdProjectSnapshot>;
   BehaviorParameterFiller: Class<gdBehaviorParameterFiller>;
   InstructionValidator: Class<gdInstructionValidator>;
   ObjectTools: Class<gdObjectTools>;
@@ -219,6 +223,7 @@ declare class libGDevelop {
   ExpressionCompletionDescription: Class<gdExpressionCompletionDescription>;
   VectorExpressionCompletionDescription: Class<gdVectorExpressionCompletionDescription>;
   ExpressionCompletionFinder: Class<gdExpressionCompletionFinder>;
+  ExpressionCompletionSession: Class<gdExpressionCompletionSession>;
   ExpressionNodeLocationFinder: Class<gdExpressionNodeLocationFinder>;
   ExpressionTypeFinder: Class<gdExpressionTypeFinder>;
   ExpressionNode: Class<gdExpressionNode>;